@@ -7,6 +7,10 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [x] Renderer: Merging compatible draw calls across draw lists (ImGuiBackendFlags_RendererHasBatchedDrawCmds) [Desktop OpenGL only!, with the persistent-mapped ring buffer]
+//  [x] Renderer: Persistent-mapped ring buffer for vertex/index buffers with GL 4.4+ or GL_ARB_buffer_storage [Desktop OpenGL only!]
+//  [x] Renderer: Instanced rectangles and glyphs, expanded in vertex shader (ImGuiBackendFlags_RendererHasInstances) [Desktop OpenGL 3.3+ and OpenGL ES 3.0+ only, opt-in with IMGUI_IMPL_OPENGL_ENABLE_INSTANCING]
+//  [x] Renderer: Compact 12 bytes vertices (ImGuiBackendFlags_RendererHasCompactVtx) [Desktop OpenGL 3.2+ only, opt-in with IMGUI_IMPL_OPENGL_ENABLE_COMPACT_VTX]
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -23,6 +27,12 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Desktop GL 3.2+: Removed support for ImGuiBackendFlags_RendererHasMergedBuffers (flag removed), as filling merged buffers added a CPU copy of all vertices/indices per frame. Compact vertices are uploaded once per frame, indices once per draw list.
+//  2026-10-18: OpenGL: Desktop GL 4.4+ or GL_ARB_buffer_storage: batched draw commands are rendered from the ring buffer, written with ImDrawData::WriteMergedBuffers() without going through merged buffers.
+//  2026-10-18: OpenGL: Desktop GL 3.2+: Added support for ImGuiBackendFlags_RendererHasCompactVtx, uploading ImDrawData::CompactVtxBuffer when valid. Opt-in with '#define IMGUI_IMPL_OPENGL_ENABLE_COMPACT_VTX'.
+//  2026-10-18: OpenGL: Desktop GL 3.3+ and GL ES 3.0+: Added support for ImGuiBackendFlags_RendererHasInstances, drawing ImDrawInstance with glDrawArraysInstanced() and a second shader program. Opt-in with '#define IMGUI_IMPL_OPENGL_ENABLE_INSTANCING'.
+//  2026-10-18: OpenGL: Desktop GL 3.2+: Added support for ImGuiBackendFlags_RendererHasBatchedDrawCmds, rendering ImDrawData::MergedCmdBuffer when available.
+//  2026-10-18: OpenGL: Desktop GL 4.4+ or GL_ARB_buffer_storage: upload vertex/index buffers into a triple-buffered persistent-mapped ring buffer synchronized with glFenceSync(). Can be disabled with '#define IMGUI_IMPL_OPENGL_DISABLE_BUFFER_STORAGE'.
 //  2025-06-11: OpenGL: Added support for ImGuiBackendFlags_RendererHasTextures, for dynamic font atlas. Removed ImGui_ImplOpenGL3_CreateFontsTexture() and ImGui_ImplOpenGL3_DestroyFontsTexture().
 //  2025-06-04: OpenGL: Made GLES 3.20 contexts not access GL_CONTEXT_PROFILE_MASK nor GL_PRIMITIVE_RESTART. (#8664)
 //  2025-02-18: OpenGL: Lazily reinitialize embedded GL loader for when calling backend from e.g. other DLL boundaries. (#8406)
@@ -210,11 +220,33 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
 #endif
 
+// Desktop GL 4.4+ (or GL_ARB_buffer_storage) has glBufferStorage() for persistent-mapped buffers, used along with glFenceSync() and glDrawElementsBaseVertex() (3.2+).
+// Draw lists are copied into them directly, so batched draw commands (ImGuiBackendFlags_RendererHasBatchedDrawCmds) are only used along with it.
+// You may '#define IMGUI_IMPL_OPENGL_DISABLE_BUFFER_STORAGE' to always use the glBufferData() path.
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3) && defined(GL_VERSION_4_4) && !defined(IMGUI_IMPL_OPENGL_DISABLE_BUFFER_STORAGE)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+#define IMGUI_IMPL_OPENGL_RING_BUFFER_FRAMES    3   // Number of frames the GPU may be behind before we wait on a fence
+#endif
+
+// Compact vertices (ImDrawVertCompact) are uploaded along with ImDrawData::MergedIdxBuffer, requiring glDrawElementsBaseVertex() (3.2+).
+// This is opt-in with '#define IMGUI_IMPL_OPENGL_ENABLE_COMPACT_VTX': it reduces vertex upload size by 40% (e.g. for remote/streaming sessions),
+// at the cost of a conversion pass on the CPU and 1/8th pixel precision. The persistent-mapped ring buffer is not used along with it.
+#if defined(IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET) && defined(IMGUI_IMPL_OPENGL_ENABLE_COMPACT_VTX)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_COMPACT_VTX
+#endif
+
 // Desktop GL 3.3+ and GL ES 3.0+ have glBindSampler()
 #if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3))
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0+ have glVertexAttribDivisor() and glDrawArraysInstanced(), used to expand ImDrawInstance in the vertex shader (which also needs GLSL 1.30+ for gl_VertexID).
+// This is opt-in with '#define IMGUI_IMPL_OPENGL_ENABLE_INSTANCING': it reduces vertex data by ~40% but slightly increases the number of draw calls,
+// as instanced commands can't be merged with interleaved triangle commands (borders, rounded shapes). Mostly worth it with bandwidth-limited GPU/drivers.
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3)) && defined(IMGUI_IMPL_OPENGL_ENABLE_INSTANCING)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -240,13 +272,33 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
-    unsigned int    VboHandle, ElementsHandle;
+    GLuint          InstShaderHandle;        // Shader program expanding ImDrawInstance, when UseInstancing
+    GLint           InstAttribLocationTex;
+    GLint           InstAttribLocationProjMtx;
+    GLuint          InstAttribLocationPosMin;
+    GLuint          InstAttribLocationPosMax;
+    GLuint          InstAttribLocationUVMin;
+    GLuint          InstAttribLocationUVMax;
+    GLuint          InstAttribLocationColor;
+    unsigned int    VboHandle, ElementsHandle, InstVboHandle;
     GLsizeiptr      VertexBufferSize;
     GLsizeiptr      IndexBufferSize;
     bool            HasPolygonMode;
     bool            HasClipOrigin;
     bool            UseBufferSubData;
+    bool            HasBufferStorage;
+    bool            UseRingBuffer;           // Upload into persistent-mapped VboHandle/ElementsHandle. See ImGui_ImplOpenGL3_RingBufferReserve().
+    bool            UseInstancing;           // Draw ImDrawCmd::InstCount commands. See ImGui_ImplOpenGL3_UploadInstances().
+    bool            UseCompactVtx;           // Upload ImDrawData::CompactVtxBuffer when valid. See ImGui_ImplOpenGL3_UseCompactVtx().
     ImVector<char>  TempBuffer;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    int             RingFrameIndex;
+    int             RingVtxCapacity;         // Per frame, in vertices
+    int             RingIdxCapacity;         // Per frame, in indices
+    ImDrawVert*     RingVtxMapped;
+    ImDrawIdx*      RingIdxMapped;
+    GLsync          RingFences[IMGUI_IMPL_OPENGL_RING_BUFFER_FRAMES];
+#endif
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -404,6 +456,32 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
         if (extension != nullptr && strcmp(extension, "GL_ARB_clip_control") == 0)
             bd->HasClipOrigin = true;
+        if (extension != nullptr && strcmp(extension, "GL_ARB_buffer_storage") == 0)
+            bd->HasBufferStorage = true;
+    }
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    // When using the persistent-mapped ring buffer we copy each draw list directly into it with ImDrawData::WriteMergedBuffers().
+    if (bd->GlVersion >= 440)
+        bd->HasBufferStorage = true;
+    bd->UseRingBuffer = (bd->HasBufferStorage && bd->GlVersion >= 320 && !bd->GlProfileIsES3);
+    if (bd->UseRingBuffer)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasBatchedDrawCmds; // We can render ImDrawData::MergedCmdBuffer, reducing draw calls.
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+    int glsl_version_number = 0;
+    sscanf(bd->GlslVersionString, "#version %d", &glsl_version_number);
+    bd->UseInstancing = (bd->GlVersion >= 330 || bd->GlProfileIsES3) && glsl_version_number >= 130;
+    if (bd->UseInstancing)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasInstances; // We can render ImDrawCmd::InstCount instances of ImDrawList::InstBuffer[].
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_COMPACT_VTX
+    bd->UseCompactVtx = (bd->GlVersion >= 320);
+    if (bd->UseCompactVtx)
+    {
+        bd->UseRingBuffer = false;
+        io.BackendFlags &= ~ImGuiBackendFlags_RendererHasBatchedDrawCmds; // Compact vertices are used along with each draw list's IdxBuffer, not batched.
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasCompactVtx;    // We can upload ImDrawData::CompactVtxBuffer instead of ImDrawVert.
     }
 #endif
 
@@ -419,7 +497,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasBatchedDrawCmds | ImGuiBackendFlags_RendererHasInstances | ImGuiBackendFlags_RendererHasCompactVtx);
     IM_DELETE(bd);
 }
 
@@ -435,6 +513,15 @@ void    ImGui_ImplOpenGL3_NewFrame()
             IM_ASSERT(0 && "ImGui_ImplOpenGL3_CreateDeviceObjects() failed!");
 }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_COMPACT_VTX
+// Compact vertices are only valid if all vertices could be converted this frame (see ImDrawData::BuildCompactVtxBuffer())
+static bool ImGui_ImplOpenGL3_UseCompactVtx(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    return bd->UseCompactVtx && draw_data->TotalVtxCount > 0 && draw_data->CompactVtxBuffer.Size == draw_data->TotalVtxCount;
+}
+#endif
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
@@ -477,13 +564,32 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 #if defined(GL_CLIP_ORIGIN)
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
 #endif
-    const float ortho_projection[4][4] =
+    float ortho_projection[4][4] =
     {
         { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
         { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+    if (bd->InstShaderHandle)
+    {
+        glUseProgram(bd->InstShaderHandle);
+        glUniform1i(bd->InstAttribLocationTex, 0);
+        glUniformMatrix4fv(bd->InstAttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    }
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_COMPACT_VTX
+    // Fold ImDrawVertCompact position decoding (CompactVtxOrigin + pos / IM_DRAWVERT_COMPACT_POS_SCALE) into the projection matrix
+    const bool use_compact_vtx = ImGui_ImplOpenGL3_UseCompactVtx(draw_data);
+    if (use_compact_vtx)
+    {
+        ortho_projection[3][0] += ortho_projection[0][0] * draw_data->CompactVtxOrigin.x;
+        ortho_projection[3][1] += ortho_projection[1][1] * draw_data->CompactVtxOrigin.y;
+        ortho_projection[0][0] /= IM_DRAWVERT_COMPACT_POS_SCALE;
+        ortho_projection[1][1] /= IM_DRAWVERT_COMPACT_POS_SCALE;
+    }
+#endif
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
@@ -504,11 +610,195 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_COMPACT_VTX
+    if (use_compact_vtx)
+    {
+        GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,          GL_FALSE, sizeof(ImDrawVertCompact), (GLvoid*)offsetof(ImDrawVertCompact, pos)));
+        GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE,  sizeof(ImDrawVertCompact), (GLvoid*)offsetof(ImDrawVertCompact, uv)));
+        GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE,  GL_TRUE,  sizeof(ImDrawVertCompact), (GLvoid*)offsetof(ImDrawVertCompact, col)));
+        return;
+    }
+#endif
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
+// Upload vertex/index buffers
+// - OpenGL drivers are in a very sorry state nowadays....
+//   During 2021 we attempted to switch from glBufferData() to orphaning+glBufferSubData() following reports
+//   of leaks on Intel GPU when using multi-viewports on Windows.
+// - After this we kept hearing of various display corruptions issues. We started disabling on non-Intel GPU, but issues still got reported on Intel.
+// - We are now back to using exclusively glBufferData(). So bd->UseBufferSubData IS ALWAYS FALSE in this code.
+//   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
+// - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
+// 'vtx_data' may be nullptr to only upload indices, when vertices were uploaded for the whole frame.
+static void ImGui_ImplOpenGL3_UploadBuffers(const void* vtx_data, int vtx_count, int vtx_stride, const ImDrawIdx* idx_data, int idx_count)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const GLsizeiptr vtx_buffer_size = (GLsizeiptr)vtx_count * vtx_stride;
+    const GLsizeiptr idx_buffer_size = (GLsizeiptr)idx_count * (int)sizeof(ImDrawIdx);
+    if (bd->UseBufferSubData)
+    {
+        if (vtx_data != nullptr && bd->VertexBufferSize < vtx_buffer_size)
+        {
+            bd->VertexBufferSize = vtx_buffer_size;
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, nullptr, GL_STREAM_DRAW));
+        }
+        if (bd->IndexBufferSize < idx_buffer_size)
+        {
+            bd->IndexBufferSize = idx_buffer_size;
+            GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, nullptr, GL_STREAM_DRAW));
+        }
+        if (vtx_data != nullptr)
+            GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)vtx_data));
+        GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)idx_data));
+    }
+    else
+    {
+        if (vtx_data != nullptr)
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)vtx_data, GL_STREAM_DRAW));
+        GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)idx_data, GL_STREAM_DRAW));
+    }
+}
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+// Instances (Desktop GL 3.3+ or GL ES 3.0+)
+// - All ImDrawList::InstBuffer[] are uploaded once per frame into InstVboHandle, read through a second VAO with a divisor of 1 on all attributes.
+// - Each ImDrawInstance is drawn as a 4 vertices triangle strip, expanded in the vertex shader using gl_VertexID.
+//   We don't rely on glDrawArraysInstancedBaseInstance() (GL 4.2) so attribute pointers are re-specified for each draw command.
+static GLuint ImGui_ImplOpenGL3_UploadInstances(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const ImDrawInstance* inst_data = draw_data->MergedInstBuffer.Data;
+    if (draw_data->MergedInstBuffer.Size != draw_data->TotalInstCount)
+    {
+        bd->TempBuffer.resize(draw_data->TotalInstCount * (int)sizeof(ImDrawInstance));
+        draw_data->WriteMergedBuffers(nullptr, nullptr, (ImDrawInstance*)(void*)bd->TempBuffer.Data);
+        inst_data = (const ImDrawInstance*)(void*)bd->TempBuffer.Data;
+    }
+
+    GLuint inst_vertex_array_object = 0;
+    GL_CALL(glGenVertexArrays(1, &inst_vertex_array_object));
+    glBindVertexArray(inst_vertex_array_object);
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->InstVboHandle));
+    GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)draw_data->TotalInstCount * (int)sizeof(ImDrawInstance), (const GLvoid*)inst_data, GL_STREAM_DRAW));
+    const GLuint attrib_locations[] = { bd->InstAttribLocationPosMin, bd->InstAttribLocationPosMax, bd->InstAttribLocationUVMin, bd->InstAttribLocationUVMax, bd->InstAttribLocationColor };
+    for (GLuint attrib_location : attrib_locations)
+    {
+        GL_CALL(glEnableVertexAttribArray(attrib_location));
+        GL_CALL(glVertexAttribDivisor(attrib_location, 1));
+    }
+    return inst_vertex_array_object;
+}
+
+static void ImGui_ImplOpenGL3_SetupInstanceAttribs(unsigned int inst_offset)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const size_t base = (size_t)inst_offset * sizeof(ImDrawInstance);
+    GL_CALL(glVertexAttribPointer(bd->InstAttribLocationPosMin, 2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawInstance), (GLvoid*)(base + offsetof(ImDrawInstance, pos_min))));
+    GL_CALL(glVertexAttribPointer(bd->InstAttribLocationPosMax, 2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawInstance), (GLvoid*)(base + offsetof(ImDrawInstance, pos_max))));
+    GL_CALL(glVertexAttribPointer(bd->InstAttribLocationUVMin,  2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawInstance), (GLvoid*)(base + offsetof(ImDrawInstance, uv_min))));
+    GL_CALL(glVertexAttribPointer(bd->InstAttribLocationUVMax,  2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawInstance), (GLvoid*)(base + offsetof(ImDrawInstance, uv_max))));
+    GL_CALL(glVertexAttribPointer(bd->InstAttribLocationColor,  4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawInstance), (GLvoid*)(base + offsetof(ImDrawInstance, col))));
+}
+
+// Switch between ImDrawVert and ImDrawInstance program/attributes
+static void ImGui_ImplOpenGL3_SetInstanceState(bool use_instances, GLuint vertex_array_object, GLuint inst_vertex_array_object)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    glUseProgram(use_instances ? bd->InstShaderHandle : bd->ShaderHandle);
+    glBindVertexArray(use_instances ? inst_vertex_array_object : vertex_array_object);
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, use_instances ? bd->InstVboHandle : bd->VboHandle));
+}
+#endif
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+// Persistent-mapped ring buffer (Desktop GL 4.4+ or GL_ARB_buffer_storage)
+// - VboHandle/ElementsHandle get immutable storage for IMGUI_IMPL_OPENGL_RING_BUFFER_FRAMES frames worth of vertices/indices, mapped once.
+// - Each ImGui_ImplOpenGL3_RenderDrawData() call copies draw lists into the next frame slot, after waiting on the fence of its previous use.
+//   With 3 slots the fence is normally signaled already, so we don't stall and the driver doesn't need to orphan/reallocate anything.
+// - When a frame doesn't fit, buffers are recreated larger. OpenGL defers deletion of buffers still in use by the GPU.
+static void ImGui_ImplOpenGL3_DestroyRingBuffer()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    for (GLsync& fence : bd->RingFences)
+        if (fence != nullptr)
+        {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    bd->RingVtxCapacity = bd->RingIdxCapacity = 0;
+    bd->RingVtxMapped = nullptr; // Buffers are implicitly unmapped when deleted.
+    bd->RingIdxMapped = nullptr;
+}
+
+// Return true if VboHandle/ElementsHandle have been recreated, in which case render state needs to be setup again.
+// May disable bd->UseRingBuffer if mapping fails.
+static bool ImGui_ImplOpenGL3_RingBufferReserve(int vtx_count, int idx_count)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (vtx_count <= bd->RingVtxCapacity && idx_count <= bd->RingIdxCapacity)
+        return false;
+
+    ImGui_ImplOpenGL3_DestroyRingBuffer();
+    GL_CALL(glDeleteBuffers(1, &bd->VboHandle));
+    GL_CALL(glDeleteBuffers(1, &bd->ElementsHandle));
+    GL_CALL(glGenBuffers(1, &bd->VboHandle));
+    GL_CALL(glGenBuffers(1, &bd->ElementsHandle));
+
+    // Note that binding GL_ELEMENT_ARRAY_BUFFER modifies our own temporary VAO, which is bound at this point.
+    bd->RingVtxCapacity = vtx_count + vtx_count / 2;
+    bd->RingIdxCapacity = idx_count + idx_count / 2;
+    const GLsizeiptr vtx_buffer_size = (GLsizeiptr)bd->RingVtxCapacity * IMGUI_IMPL_OPENGL_RING_BUFFER_FRAMES * (int)sizeof(ImDrawVert);
+    const GLsizeiptr idx_buffer_size = (GLsizeiptr)bd->RingIdxCapacity * IMGUI_IMPL_OPENGL_RING_BUFFER_FRAMES * (int)sizeof(ImDrawIdx);
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+    GL_CALL(glBufferStorage(GL_ARRAY_BUFFER, vtx_buffer_size, nullptr, flags));
+    bd->RingVtxMapped = (ImDrawVert*)glMapBufferRange(GL_ARRAY_BUFFER, 0, vtx_buffer_size, flags);
+    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle));
+    GL_CALL(glBufferStorage(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, nullptr, flags));
+    bd->RingIdxMapped = (ImDrawIdx*)glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, flags);
+
+    if (bd->RingVtxMapped == nullptr || bd->RingIdxMapped == nullptr)
+    {
+        // Fallback to glBufferData() path, which needs buffers with mutable storage.
+        ImGui_ImplOpenGL3_DestroyRingBuffer();
+        GL_CALL(glDeleteBuffers(1, &bd->VboHandle));
+        GL_CALL(glDeleteBuffers(1, &bd->ElementsHandle));
+        GL_CALL(glGenBuffers(1, &bd->VboHandle));
+        GL_CALL(glGenBuffers(1, &bd->ElementsHandle));
+        bd->UseRingBuffer = false;
+    }
+    return true;
+}
+
+// Copy all draw lists into next frame slot. Output offsets of the first vertex/index of the slot.
+static void ImGui_ImplOpenGL3_RingBufferWrite(ImDrawData* draw_data, int* out_vtx_offset, int* out_idx_offset)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const int frame_index = bd->RingFrameIndex;
+    bd->RingFrameIndex = (bd->RingFrameIndex + 1) % IMGUI_IMPL_OPENGL_RING_BUFFER_FRAMES;
+
+    // Wait for the GPU to be done with this slot
+    if (GLsync fence = bd->RingFences[frame_index])
+    {
+        GLenum wait_result;
+        do
+            wait_result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000); // Timeout in nanoseconds
+        while (wait_result == GL_TIMEOUT_EXPIRED);
+        glDeleteSync(fence);
+        bd->RingFences[frame_index] = nullptr;
+    }
+
+    *out_vtx_offset = frame_index * bd->RingVtxCapacity;
+    *out_idx_offset = frame_index * bd->RingIdxCapacity;
+
+    // Copy each draw list straight into the ring, rebasing indices of batched commands on the way (see ImDrawData::BatchDrawCmds())
+    draw_data->WriteMergedBuffers(bd->RingVtxMapped + *out_vtx_offset, bd->RingIdxMapped + *out_idx_offset, nullptr);
+}
+#endif // #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -583,45 +873,72 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
+    // Upload vertex/index buffers for the whole frame at once into the persistent-mapped ring buffer when available,
+    // or vertices only when using compact vertices (see ImGuiBackendFlags_RendererHasCompactVtx), with indices uploaded for each draw list.
+    // Both require glDrawElementsBaseVertex() as indices are relative to each draw list.
+    int global_vtx_offset = 0;
+    int global_idx_offset = 0;
+    bool use_ring_buffer = false;
+    bool use_compact_vtx = false;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (bd->UseRingBuffer)
+    {
+        if (ImGui_ImplOpenGL3_RingBufferReserve(draw_data->TotalVtxCount, draw_data->TotalIdxCount))
+            ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+        if (bd->UseRingBuffer)
+        {
+            ImGui_ImplOpenGL3_RingBufferWrite(draw_data, &global_vtx_offset, &global_idx_offset);
+            use_ring_buffer = true;
+        }
+    }
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_COMPACT_VTX
+    if (ImGui_ImplOpenGL3_UseCompactVtx(draw_data))
+    {
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)draw_data->CompactVtxBuffer.size_in_bytes(), (const GLvoid*)draw_data->CompactVtxBuffer.Data, GL_STREAM_DRAW));
+        bd->VertexBufferSize = (GLsizeiptr)draw_data->CompactVtxBuffer.size_in_bytes();
+        use_compact_vtx = true;
+    }
+#endif
+
+    // Upload instances for the whole frame at once (see ImGuiBackendFlags_RendererHasInstances)
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+    GLuint inst_vertex_array_object = 0;
+    int global_inst_offset = 0;
+    bool inst_state = false;
+    if (bd->InstShaderHandle && draw_data->TotalInstCount > 0)
+    {
+        inst_vertex_array_object = ImGui_ImplOpenGL3_UploadInstances(draw_data);
+        ImGui_ImplOpenGL3_SetInstanceState(false, vertex_array_object, inst_vertex_array_object);
+    }
+#endif
+
     // Render command lists
-    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    // When batched commands were filled by Render() (see ImGuiBackendFlags_RendererHasBatchedDrawCmds), render them as a single list: their offsets are already relative to merged buffers.
+    const bool use_batched_cmds = use_ring_buffer && draw_data->MergedCmdBuffer.Size > 0;
+    const int cmd_lists_count = use_batched_cmds ? 1 : draw_data->CmdListsCount;
+    for (int n = 0; n < cmd_lists_count; n++)
     {
         const ImDrawList* draw_list = draw_data->CmdLists[n];
+        if (use_compact_vtx)
+            ImGui_ImplOpenGL3_UploadBuffers(nullptr, 0, 0, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size);
+        else if (!use_ring_buffer)
+            ImGui_ImplOpenGL3_UploadBuffers(draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size, (int)sizeof(ImDrawVert), draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size);
 
-        // Upload vertex/index buffers
-        // - OpenGL drivers are in a very sorry state nowadays....
-        //   During 2021 we attempted to switch from glBufferData() to orphaning+glBufferSubData() following reports
-        //   of leaks on Intel GPU when using multi-viewports on Windows.
-        // - After this we kept hearing of various display corruptions issues. We started disabling on non-Intel GPU, but issues still got reported on Intel.
-        // - We are now back to using exclusively glBufferData(). So bd->UseBufferSubData IS ALWAYS FALSE in this code.
-        //   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
-        // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
-        const GLsizeiptr vtx_buffer_size = (GLsizeiptr)draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
-        const GLsizeiptr idx_buffer_size = (GLsizeiptr)draw_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
-        if (bd->UseBufferSubData)
+        const ImVector<ImDrawCmd>& cmd_buffer = use_batched_cmds ? draw_data->MergedCmdBuffer : draw_list->CmdBuffer;
+        for (int cmd_i = 0; cmd_i < cmd_buffer.Size; cmd_i++)
         {
-            if (bd->VertexBufferSize < vtx_buffer_size)
-            {
-                bd->VertexBufferSize = vtx_buffer_size;
-                GL_CALL(glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, nullptr, GL_STREAM_DRAW));
-            }
-            if (bd->IndexBufferSize < idx_buffer_size)
+            const ImDrawCmd* pcmd = &cmd_buffer[cmd_i];
+            if (use_batched_cmds)
+                draw_list = draw_data->MergedCmdParentLists[cmd_i];
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+            const bool cmd_uses_instances = (pcmd->UserCallback == nullptr && pcmd->InstCount > 0);
+            if (cmd_uses_instances != inst_state)
             {
-                bd->IndexBufferSize = idx_buffer_size;
-                GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, nullptr, GL_STREAM_DRAW));
+                ImGui_ImplOpenGL3_SetInstanceState(cmd_uses_instances, vertex_array_object, inst_vertex_array_object);
+                inst_state = cmd_uses_instances;
             }
-            GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data));
-            GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)draw_list->IdxBuffer.Data));
-        }
-        else
-        {
-            GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data, GL_STREAM_DRAW));
-            GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)draw_list->IdxBuffer.Data, GL_STREAM_DRAW));
-        }
-
-        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
-        {
-            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+#endif
             if (pcmd->UserCallback != nullptr)
             {
                 // User callback, registered via ImDrawList::AddCallback()
@@ -644,20 +961,50 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 
                 // Bind texture, Draw
                 GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+                if (cmd_uses_instances)
+                {
+                    ImGui_ImplOpenGL3_SetupInstanceAttribs(pcmd->InstOffset + global_inst_offset);
+                    GL_CALL(glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)pcmd->InstCount));
+                    continue;
+                }
+#endif
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
-                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
+                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)((pcmd->IdxOffset + global_idx_offset) * sizeof(ImDrawIdx)), (GLint)(pcmd->VtxOffset + global_vtx_offset)));
                 else
 #endif
                 GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
             }
         }
+        if (use_ring_buffer || use_compact_vtx)
+            global_vtx_offset += draw_list->VtxBuffer.Size;
+        if (use_ring_buffer)
+            global_idx_offset += draw_list->IdxBuffer.Size;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+        if (inst_state)
+        {
+            ImGui_ImplOpenGL3_SetInstanceState(false, vertex_array_object, inst_vertex_array_object); // Next list may upload into VboHandle/ElementsHandle
+            inst_state = false;
+        }
+        global_inst_offset += draw_list->InstBuffer.Size;
+#endif
     }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    // Signal when the GPU is done reading this frame slot
+    if (use_ring_buffer)
+        bd->RingFences[(bd->RingFrameIndex + IMGUI_IMPL_OPENGL_RING_BUFFER_FRAMES - 1) % IMGUI_IMPL_OPENGL_RING_BUFFER_FRAMES] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
+
     // Destroy the temporary VAO
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
 #endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+    if (inst_vertex_array_object != 0)
+        GL_CALL(glDeleteVertexArrays(1, &inst_vertex_array_object));
+#endif
 
     // Restore modified GL state
     // This "glIsProgram()" check is required because if the program is "pending deletion" at the time of binding backup, it will have been deleted by now and will cause an OpenGL error. See #6220.
@@ -893,6 +1240,24 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
         "}\n";
 
+    // Expand ImDrawInstance into a 4 vertices triangle strip: (0,0) (1,0) (0,1) (1,1). Compatible with GLSL 1.30+ and GLSL ES 3.00.
+    const GLchar* vertex_shader_instanced_glsl_130 =
+        "uniform mat4 ProjMtx;\n"
+        "in vec2 InstPosMin;\n"
+        "in vec2 InstPosMax;\n"
+        "in vec2 InstUVMin;\n"
+        "in vec2 InstUVMax;\n"
+        "in vec4 InstColor;\n"
+        "out vec2 Frag_UV;\n"
+        "out vec4 Frag_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+        "    Frag_UV = mix(InstUVMin, InstUVMax, corner);\n"
+        "    Frag_Color = InstColor;\n"
+        "    gl_Position = ProjMtx * vec4(mix(InstPosMin, InstPosMax, corner),0,1);\n"
+        "}\n";
+
     const GLchar* fragment_shader_glsl_120 =
         "#ifdef GL_ES\n"
         "    precision mediump float;\n"
@@ -988,6 +1353,52 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     glDetachShader(bd->ShaderHandle, vert_handle);
     glDetachShader(bd->ShaderHandle, frag_handle);
     glDeleteShader(vert_handle);
+
+    // Create instancing program, sharing the fragment shader.
+    // On failure, keep rendering without instances (ImGui::NewFrame() hasn't read io.BackendFlags yet).
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+    if (bd->UseInstancing)
+    {
+        const GLchar* vertex_shader_instanced_with_version[2] = { bd->GlslVersionString, vertex_shader_instanced_glsl_130 };
+        GLuint inst_vert_handle;
+        GL_CALL(inst_vert_handle = glCreateShader(GL_VERTEX_SHADER));
+        glShaderSource(inst_vert_handle, 2, vertex_shader_instanced_with_version, nullptr);
+        glCompileShader(inst_vert_handle);
+        if (CheckShader(inst_vert_handle, "instanced vertex shader"))
+        {
+            bd->InstShaderHandle = glCreateProgram();
+            glAttachShader(bd->InstShaderHandle, inst_vert_handle);
+            glAttachShader(bd->InstShaderHandle, frag_handle);
+            glLinkProgram(bd->InstShaderHandle);
+            glDetachShader(bd->InstShaderHandle, inst_vert_handle);
+            glDetachShader(bd->InstShaderHandle, frag_handle);
+            if (!CheckProgram(bd->InstShaderHandle, "instanced shader program"))
+            {
+                glDeleteProgram(bd->InstShaderHandle);
+                bd->InstShaderHandle = 0;
+            }
+        }
+        glDeleteShader(inst_vert_handle);
+        if (bd->InstShaderHandle)
+        {
+            bd->InstAttribLocationTex = glGetUniformLocation(bd->InstShaderHandle, "Texture");
+            bd->InstAttribLocationProjMtx = glGetUniformLocation(bd->InstShaderHandle, "ProjMtx");
+            bd->InstAttribLocationPosMin = (GLuint)glGetAttribLocation(bd->InstShaderHandle, "InstPosMin");
+            bd->InstAttribLocationPosMax = (GLuint)glGetAttribLocation(bd->InstShaderHandle, "InstPosMax");
+            bd->InstAttribLocationUVMin = (GLuint)glGetAttribLocation(bd->InstShaderHandle, "InstUVMin");
+            bd->InstAttribLocationUVMax = (GLuint)glGetAttribLocation(bd->InstShaderHandle, "InstUVMax");
+            bd->InstAttribLocationColor = (GLuint)glGetAttribLocation(bd->InstShaderHandle, "InstColor");
+            glGenBuffers(1, &bd->InstVboHandle);
+        }
+        else
+        {
+            bd->UseInstancing = false;
+            ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_RendererHasInstances;
+        }
+    }
+#else
+    IM_UNUSED(vertex_shader_instanced_glsl_130);
+#endif
     glDeleteShader(frag_handle);
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
@@ -1016,9 +1427,14 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    ImGui_ImplOpenGL3_DestroyRingBuffer();
+#endif
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    if (bd->InstVboHandle)  { glDeleteBuffers(1, &bd->InstVboHandle); bd->InstVboHandle = 0; }
+    if (bd->InstShaderHandle) { glDeleteProgram(bd->InstShaderHandle); bd->InstShaderHandle = 0; }
 
     // Destroy all textures
     for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
@@ -0,0 +1,848 @@
+// dear imgui: Renderer Backend for CPU software rasterization
+// This doesn't need a GPU: output is written into a RGBA framebuffer in memory, which you can save, compare or blit.
+// Useful for headless rendering (e.g. screenshot tests, server-side rendering), or as a reference renderer.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+//  [X] Renderer: Multi-threaded rasterization by screen tiles.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// How it works:
+// - Commands are converted into triangles ("setup"): vertex positions are snapped to 1/16th of a pixel, edge functions are computed
+//   with integer math, and attributes (UV, color) are turned into gradients. Setup is spread over threads in batches of triangles.
+// - Triangles are binned into screen tiles, in submission order.
+// - Threads pick tiles and rasterize their triangles, row by row. A top-left fill rule is used so that adjacent triangles
+//   never touch the same pixel twice, which matters for anti-aliased fringes. Blending matches a GPU using
+//   glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA), with 8-bit integer math.
+// - Output only depends on the draw data: it is identical regardless of the number of threads and of SSE2 availability.
+
+// CHANGELOG
+// (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: Initial version.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_softraster.h"
+#include <math.h>       // floorf
+#include <stdint.h>     // intptr_t
+#include <string.h>     // memset, memcpy
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+// SSE2 is used to blend 4 pixels at a time. Define IMGUI_IMPL_SOFTRASTER_DISABLE_SSE to disable.
+#if !defined(IMGUI_IMPL_SOFTRASTER_DISABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && (IM_COL32_A_SHIFT == 24)
+#define IMGUI_IMPL_SOFTRASTER_USE_SSE
+#include <emmintrin.h>
+#endif
+
+// Clang/GCC warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-macros"                      // warning: macro is not used
+#pragma clang diagnostic ignored "-Wsign-conversion"                    // warning: implicit conversion changes signedness
+#endif
+
+// Size in pixels of the screen tiles distributed to threads
+#ifndef IMGUI_IMPL_SOFTRASTER_TILE_SIZE
+#define IMGUI_IMPL_SOFTRASTER_TILE_SIZE     64
+#endif
+#define IMGUI_IMPL_SOFTRASTER_SETUP_BATCH   1024        // Number of triangles per setup job
+#define IMGUI_IMPL_SOFTRASTER_SUBPIXELS     16          // Vertex positions are snapped to 1/16th of a pixel
+#define IMGUI_IMPL_SOFTRASTER_MAX_COORD     4194304.0f  // Vertex positions are clamped to +/- this many pixels, so edge functions fit in 64-bit integers
+
+enum ImGui_ImplSoftRaster_TriFlags_
+{
+    ImGui_ImplSoftRaster_TriFlags_None          = 0,        // Constant color, stored in Col (already multiplied by texel)
+    ImGui_ImplSoftRaster_TriFlags_InterpolateCol= 1 << 0,   // Color varies (e.g. anti-aliased fringes, gradients)
+    ImGui_ImplSoftRaster_TriFlags_SampleTex     = 1 << 1,   // UV varies (e.g. text, images)
+};
+
+// Triangle after setup
+struct ImGui_ImplSoftRaster_Tri
+{
+    ImS64               EdgeC[3];       // Edge functions E(x,y) = A*x + B*y + C, in subpixel units. Pixels which center have all 3 values >= 0 are inside.
+    int                 EdgeA[3];
+    int                 EdgeB[3];
+    int                 MinX, MinY;     // Bounding box in pixels, intersected with clipping rectangle and framebuffer. Empty if culled.
+    int                 MaxX, MaxY;
+    int                 Flags;          // ImGui_ImplSoftRaster_TriFlags_
+    ImU32               Col;            // Color when not interpolated
+    ImU32               Texel;          // Texel when not sampled
+    const ImGui_ImplSoftRaster_Texture* Tex;
+    float               Attr[6][3];     // U, V, then color channels in memory order: value at center of pixel (MinX, MinY), d/dx, d/dy
+};
+
+// Batch of triangles from a ImDrawCmd
+struct ImGui_ImplSoftRaster_SetupJob
+{
+    const ImDrawVert*   VtxBuffer;
+    const ImDrawIdx*    IdxBuffer;
+    const ImGui_ImplSoftRaster_Texture* Tex;
+    int                 TriCount;
+    int                 TriOffset;      // Index of first triangle in Tris[]
+    int                 ClipMinX, ClipMinY, ClipMaxX, ClipMaxY;
+};
+
+struct ImGui_ImplSoftRaster_Data;
+typedef void (*ImGui_ImplSoftRaster_JobFunc)(ImGui_ImplSoftRaster_Data* bd, int item_idx);
+
+struct ImGui_ImplSoftRaster_Data
+{
+    int                 ThreadsCount;
+    ImVector<ImGui_ImplSoftRaster_SetupJob> SetupJobs;
+    ImVector<ImGui_ImplSoftRaster_Tri>      Tris;
+    int                 TrisCount;
+    ImVector<int>       TileTriOffsets; // Range of TileTriIndices[] for each tile (+1 entry)
+    ImVector<int>       TileTriIndices;
+    ImVector<int>       TileTriCursors;
+
+    // Current framebuffer
+    unsigned char*      Pixels;
+    int                 Width;
+    int                 Height;
+    int                 Pitch;
+    int                 TilesCountX;
+    int                 TilesCountY;
+    ImVec2              ClipOff;
+    ImVec2              ClipScale;
+
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+    ImVector<std::thread*>  Workers;
+    std::mutex              JobMutex;
+    std::condition_variable JobStartCond;
+    std::condition_variable JobDoneCond;
+    int                     JobGeneration;
+    int                     JobWorkersPending;
+    bool                    JobQuit;
+    ImGui_ImplSoftRaster_JobFunc JobFunc;
+    int                     JobItemsCount;
+    std::atomic<int>        JobNextItem;
+#endif
+
+    ImGui_ImplSoftRaster_Data()
+    {
+        ThreadsCount = 1;
+        TrisCount = 0;
+        Pixels = nullptr;
+        Width = Height = Pitch = TilesCountX = TilesCountY = 0;
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+        JobGeneration = JobWorkersPending = 0;
+        JobQuit = false;
+        JobFunc = nullptr;
+        JobItemsCount = 0;
+        JobNextItem = 0;
+#endif
+    }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplSoftRaster_Data* ImGui_ImplSoftRaster_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoftRaster_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Threading
+//-----------------------------------------------------------------------------
+
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+static void ImGui_ImplSoftRaster_ProcessJobItems(ImGui_ImplSoftRaster_Data* bd)
+{
+    for (int item_idx = bd->JobNextItem.fetch_add(1); item_idx < bd->JobItemsCount; item_idx = bd->JobNextItem.fetch_add(1))
+        bd->JobFunc(bd, item_idx);
+}
+
+static void ImGui_ImplSoftRaster_WorkerThread(ImGui_ImplSoftRaster_Data* bd)
+{
+    int last_generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(bd->JobMutex);
+            bd->JobStartCond.wait(lock, [&]() { return bd->JobQuit || bd->JobGeneration != last_generation; });
+            if (bd->JobQuit)
+                return;
+            last_generation = bd->JobGeneration;
+        }
+        ImGui_ImplSoftRaster_ProcessJobItems(bd);
+        {
+            std::lock_guard<std::mutex> lock(bd->JobMutex);
+            if (--bd->JobWorkersPending == 0)
+                bd->JobDoneCond.notify_one();
+        }
+    }
+}
+#endif
+
+// Call func(bd, item_idx) for all items_count items, distributed over worker threads and the calling thread.
+static void ImGui_ImplSoftRaster_RunJob(ImGui_ImplSoftRaster_Data* bd, ImGui_ImplSoftRaster_JobFunc func, int items_count)
+{
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+    if (bd->Workers.Size > 0 && items_count > 1)
+    {
+        {
+            std::lock_guard<std::mutex> lock(bd->JobMutex);
+            bd->JobFunc = func;
+            bd->JobItemsCount = items_count;
+            bd->JobNextItem = 0;
+            bd->JobWorkersPending = bd->Workers.Size;
+            bd->JobGeneration++;
+        }
+        bd->JobStartCond.notify_all();
+        ImGui_ImplSoftRaster_ProcessJobItems(bd);
+        std::unique_lock<std::mutex> lock(bd->JobMutex);
+        bd->JobDoneCond.wait(lock, [&]() { return bd->JobWorkersPending == 0; });
+        return;
+    }
+#endif
+    for (int item_idx = 0; item_idx < items_count; item_idx++)
+        func(bd, item_idx);
+}
+
+//-----------------------------------------------------------------------------
+// Pixel helpers
+//-----------------------------------------------------------------------------
+
+static inline int   ImGui_ImplSoftRaster_Min(int a, int b)  { return a < b ? a : b; }
+static inline int   ImGui_ImplSoftRaster_Max(int a, int b)  { return a > b ? a : b; }
+static inline ImU32 ImGui_ImplSoftRaster_Div255(ImU32 x)    { return (x + 128 + ((x + 128) >> 8)) >> 8; } // == round(x / 255) for x <= 255*255
+
+// Floor/ceil of a / b, with b > 0
+static inline ImS64 ImGui_ImplSoftRaster_FloorDiv(ImS64 a, ImS64 b) { return (a >= 0) ? a / b : -((-a + b - 1) / b); }
+static inline ImS64 ImGui_ImplSoftRaster_CeilDiv(ImS64 a, ImS64 b)  { return -ImGui_ImplSoftRaster_FloorDiv(-a, b); }
+
+// Multiply color by texel, per channel
+static inline ImU32 ImGui_ImplSoftRaster_Modulate(ImU32 col, ImU32 texel)
+{
+    if (texel == 0xFFFFFFFF)
+        return col;
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ImGui_ImplSoftRaster_Div255(((col >> shift) & 0xFF) * ((texel >> shift) & 0xFF)) << shift;
+    return out;
+}
+
+// Blend with source alpha. Destination alpha accumulates coverage (source * 1 + destination * (1 - source alpha))
+static inline ImU32 ImGui_ImplSoftRaster_Blend(ImU32 dst, ImU32 src)
+{
+    const ImU32 a = (src >> IM_COL32_A_SHIFT) & 0xFF;
+    if (a == 0)
+        return dst;
+    if (a == 255)
+        return src;
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ImGui_ImplSoftRaster_Div255(((src >> shift) & 0xFF) * (shift == IM_COL32_A_SHIFT ? 255 : a) + ((dst >> shift) & 0xFF) * (255 - a)) << shift;
+    return out;
+}
+
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE
+static inline __m128i ImGui_ImplSoftRaster_Div255_SSE(__m128i x)
+{
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+// Return per-channel multipliers for 2 pixels in 16-bit lanes: source alpha for color channels, 255 for alpha channel.
+static inline __m128i ImGui_ImplSoftRaster_SrcFactor_SSE(__m128i src16)
+{
+    const __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm_or_si128(_mm_and_si128(a, _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1)), _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0));
+}
+
+// Same as ImGui_ImplSoftRaster_Blend() for 4 pixels
+static inline __m128i ImGui_ImplSoftRaster_Blend4_SSE(__m128i dst, __m128i src)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c255 = _mm_set1_epi16(255);
+    __m128i s_lo = _mm_unpacklo_epi8(src, zero);
+    __m128i s_hi = _mm_unpackhi_epi8(src, zero);
+    __m128i inv_lo = _mm_sub_epi16(c255, _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_lo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)));
+    __m128i inv_hi = _mm_sub_epi16(c255, _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_hi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)));
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(s_lo, ImGui_ImplSoftRaster_SrcFactor_SSE(s_lo)), _mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), inv_lo));
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(s_hi, ImGui_ImplSoftRaster_SrcFactor_SSE(s_hi)), _mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), inv_hi));
+    return _mm_packus_epi16(ImGui_ImplSoftRaster_Div255_SSE(lo), ImGui_ImplSoftRaster_Div255_SSE(hi));
+}
+#endif
+
+// Blend a constant color over a span of pixels
+static void ImGui_ImplSoftRaster_BlendSpanSolid(ImU32* dst, int count, ImU32 src)
+{
+    const ImU32 a = (src >> IM_COL32_A_SHIFT) & 0xFF;
+    if (a == 255)
+    {
+        for (int n = 0; n < count; n++)
+            dst[n] = src;
+        return;
+    }
+    int n = 0;
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE
+    if (count >= 4)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i s16 = _mm_unpacklo_epi8(_mm_set1_epi32((int)src), zero);
+        const __m128i s_mul = _mm_mullo_epi16(s16, ImGui_ImplSoftRaster_SrcFactor_SSE(s16));
+        const __m128i inv = _mm_set1_epi16((short)(255 - a));
+        for (; n + 4 <= count; n += 4)
+        {
+            __m128i d = _mm_loadu_si128((const __m128i*)(dst + n));
+            __m128i lo = _mm_add_epi16(s_mul, _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv));
+            __m128i hi = _mm_add_epi16(s_mul, _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv));
+            _mm_storeu_si128((__m128i*)(dst + n), _mm_packus_epi16(ImGui_ImplSoftRaster_Div255_SSE(lo), ImGui_ImplSoftRaster_Div255_SSE(hi)));
+        }
+    }
+#endif
+    for (; n < count; n++)
+        dst[n] = ImGui_ImplSoftRaster_Blend(dst[n], src);
+}
+
+// Bilinear filtering with clamp-to-edge addressing, 8-bit weights.
+static inline ImU32 ImGui_ImplSoftRaster_SampleTexture(const ImGui_ImplSoftRaster_Texture* tex, float u, float v)
+{
+    float fx = u * (float)tex->Width - 0.5f;
+    float fy = v * (float)tex->Height - 0.5f;
+    fx = (fx < -1.0f) ? -1.0f : (fx > (float)tex->Width) ? (float)tex->Width : fx;
+    fy = (fy < -1.0f) ? -1.0f : (fy > (float)tex->Height) ? (float)tex->Height : fy;
+    const int ix = (int)(fx + 1.0f) - 1; // Floor
+    const int iy = (int)(fy + 1.0f) - 1;
+    const ImU32 wx = (ImU32)ImGui_ImplSoftRaster_Min((int)((fx - (float)ix) * 256.0f), 255);
+    const ImU32 wy = (ImU32)ImGui_ImplSoftRaster_Min((int)((fy - (float)iy) * 256.0f), 255);
+    const int x0 = ImGui_ImplSoftRaster_Max(ix, 0), x1 = ImGui_ImplSoftRaster_Min(ix + 1, tex->Width - 1);
+    const int y0 = ImGui_ImplSoftRaster_Max(iy, 0), y1 = ImGui_ImplSoftRaster_Min(iy + 1, tex->Height - 1);
+    const ImU32* row0 = tex->Pixels + y0 * tex->Width;
+    const ImU32* row1 = tex->Pixels + y1 * tex->Width;
+    if (wx == 0 && wy == 0)
+        return row0[x0];
+
+    // Two channels at a time in 16-bit slots
+    const ImU32 m = 0x00FF00FF;
+    const ImU32 p00 = row0[x0], p10 = row0[x1], p01 = row1[x0], p11 = row1[x1];
+    const ImU32 t_rb = ((((p00 & m) * (256 - wx) + (p10 & m) * wx) + 0x00800080) >> 8) & m;
+    const ImU32 t_ag = (((((p00 >> 8) & m) * (256 - wx) + ((p10 >> 8) & m) * wx) + 0x00800080) >> 8) & m;
+    const ImU32 b_rb = ((((p01 & m) * (256 - wx) + (p11 & m) * wx) + 0x00800080) >> 8) & m;
+    const ImU32 b_ag = (((((p01 >> 8) & m) * (256 - wx) + ((p11 >> 8) & m) * wx) + 0x00800080) >> 8) & m;
+    const ImU32 rb = (((t_rb * (256 - wy) + b_rb * wy) + 0x00800080) >> 8) & m;
+    const ImU32 ag = (((t_ag * (256 - wy) + b_ag * wy) + 0x00800080) >> 8) & m;
+    return rb | (ag << 8);
+}
+
+//-----------------------------------------------------------------------------
+// Triangle setup
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplSoftRaster_SetupTriangle(ImGui_ImplSoftRaster_Data* bd, const ImGui_ImplSoftRaster_SetupJob& job, const ImDrawVert* v0, const ImDrawVert* v1, const ImDrawVert* v2, ImGui_ImplSoftRaster_Tri* tri)
+{
+    tri->MinX = tri->MinY = tri->MaxX = tri->MaxY = 0;
+
+    // Snap positions to subpixel grid
+    const ImDrawVert* v[3] = { v0, v1, v2 };
+    int x[3], y[3];
+    for (int n = 0; n < 3; n++)
+    {
+        float px = (v[n]->pos.x - bd->ClipOff.x) * bd->ClipScale.x;
+        float py = (v[n]->pos.y - bd->ClipOff.y) * bd->ClipScale.y;
+        px = (px < -IMGUI_IMPL_SOFTRASTER_MAX_COORD) ? -IMGUI_IMPL_SOFTRASTER_MAX_COORD : (px > IMGUI_IMPL_SOFTRASTER_MAX_COORD) ? IMGUI_IMPL_SOFTRASTER_MAX_COORD : px;
+        py = (py < -IMGUI_IMPL_SOFTRASTER_MAX_COORD) ? -IMGUI_IMPL_SOFTRASTER_MAX_COORD : (py > IMGUI_IMPL_SOFTRASTER_MAX_COORD) ? IMGUI_IMPL_SOFTRASTER_MAX_COORD : py;
+        x[n] = (int)floorf(px * IMGUI_IMPL_SOFTRASTER_SUBPIXELS + 0.5f);
+        y[n] = (int)floorf(py * IMGUI_IMPL_SOFTRASTER_SUBPIXELS + 0.5f);
+    }
+
+    // Cull degenerate triangles, make winding consistent
+    ImS64 area = (ImS64)(x[1] - x[0]) * (y[2] - y[0]) - (ImS64)(x[2] - x[0]) * (y[1] - y[0]);
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        const ImDrawVert* tmp_v = v[1]; v[1] = v[2]; v[2] = tmp_v;
+        int tmp = x[1]; x[1] = x[2]; x[2] = tmp;
+        tmp = y[1]; y[1] = y[2]; y[2] = tmp;
+        area = -area;
+    }
+
+    // Bounding box of covered pixel centers, clipped
+    const int half = IMGUI_IMPL_SOFTRASTER_SUBPIXELS / 2;
+    const int bb_min_x = (int)ImGui_ImplSoftRaster_CeilDiv(ImGui_ImplSoftRaster_Min(x[0], ImGui_ImplSoftRaster_Min(x[1], x[2])) - half, IMGUI_IMPL_SOFTRASTER_SUBPIXELS);
+    const int bb_min_y = (int)ImGui_ImplSoftRaster_CeilDiv(ImGui_ImplSoftRaster_Min(y[0], ImGui_ImplSoftRaster_Min(y[1], y[2])) - half, IMGUI_IMPL_SOFTRASTER_SUBPIXELS);
+    const int bb_max_x = (int)ImGui_ImplSoftRaster_FloorDiv(ImGui_ImplSoftRaster_Max(x[0], ImGui_ImplSoftRaster_Max(x[1], x[2])) - half, IMGUI_IMPL_SOFTRASTER_SUBPIXELS) + 1;
+    const int bb_max_y = (int)ImGui_ImplSoftRaster_FloorDiv(ImGui_ImplSoftRaster_Max(y[0], ImGui_ImplSoftRaster_Max(y[1], y[2])) - half, IMGUI_IMPL_SOFTRASTER_SUBPIXELS) + 1;
+    const int min_x = ImGui_ImplSoftRaster_Max(bb_min_x, job.ClipMinX);
+    const int min_y = ImGui_ImplSoftRaster_Max(bb_min_y, job.ClipMinY);
+    const int max_x = ImGui_ImplSoftRaster_Min(bb_max_x, job.ClipMaxX);
+    const int max_y = ImGui_ImplSoftRaster_Min(bb_max_y, job.ClipMaxY);
+    if (min_x >= max_x || min_y >= max_y)
+        return;
+
+    // Shading: find out what varies
+    const ImGui_ImplSoftRaster_Texture* tex = job.Tex;
+    const bool uniform_col = (v[0]->col == v[1]->col && v[1]->col == v[2]->col);
+    const bool uniform_uv = (v[0]->uv.x == v[1]->uv.x && v[1]->uv.x == v[2]->uv.x && v[0]->uv.y == v[1]->uv.y && v[1]->uv.y == v[2]->uv.y);
+    const ImU32 texel = (tex == nullptr) ? 0xFFFFFFFF : uniform_uv ? ImGui_ImplSoftRaster_SampleTexture(tex, v[0]->uv.x, v[0]->uv.y) : 0;
+    int flags = ImGui_ImplSoftRaster_TriFlags_None;
+    if (!uniform_col)
+        flags |= ImGui_ImplSoftRaster_TriFlags_InterpolateCol;
+    if (tex != nullptr && !uniform_uv)
+        flags |= ImGui_ImplSoftRaster_TriFlags_SampleTex;
+    tri->Col = (flags & ImGui_ImplSoftRaster_TriFlags_SampleTex) ? v[0]->col : ImGui_ImplSoftRaster_Modulate(v[0]->col, texel);
+    tri->Texel = texel;
+    if (flags == ImGui_ImplSoftRaster_TriFlags_None && ((tri->Col >> IM_COL32_A_SHIFT) & 0xFF) == 0)
+        return;
+
+    // Edge functions. Top-left fill rule: pixels exactly on an edge are only inside if it's a top or left edge.
+    for (int n = 0; n < 3; n++)
+    {
+        const int n2 = (n + 1) % 3;
+        const int a = y[n] - y[n2];
+        const int b = x[n2] - x[n];
+        const bool is_top_left = (a > 0) || (a == 0 && b > 0);
+        tri->EdgeA[n] = a;
+        tri->EdgeB[n] = b;
+        tri->EdgeC[n] = -((ImS64)a * x[n] + (ImS64)b * y[n]) - (is_top_left ? 0 : 1);
+    }
+
+    // Attribute gradients
+    if (flags != ImGui_ImplSoftRaster_TriFlags_None)
+    {
+        const float x0 = (float)x[0] / IMGUI_IMPL_SOFTRASTER_SUBPIXELS, y0 = (float)y[0] / IMGUI_IMPL_SOFTRASTER_SUBPIXELS;
+        const float x10 = (float)(x[1] - x[0]) / IMGUI_IMPL_SOFTRASTER_SUBPIXELS, y10 = (float)(y[1] - y[0]) / IMGUI_IMPL_SOFTRASTER_SUBPIXELS;
+        const float x20 = (float)(x[2] - x[0]) / IMGUI_IMPL_SOFTRASTER_SUBPIXELS, y20 = (float)(y[2] - y[0]) / IMGUI_IMPL_SOFTRASTER_SUBPIXELS;
+        const float inv_area = (float)(IMGUI_IMPL_SOFTRASTER_SUBPIXELS * IMGUI_IMPL_SOFTRASTER_SUBPIXELS) / (float)area;
+        const float cx = (float)min_x + 0.5f - x0;
+        const float cy = (float)min_y + 0.5f - y0;
+        float a[6][3];
+        for (int n = 0; n < 3; n++)
+        {
+            a[0][n] = v[n]->uv.x;
+            a[1][n] = v[n]->uv.y;
+            for (int c = 0; c < 4; c++)
+                a[2 + c][n] = (float)((v[n]->col >> (c * 8)) & 0xFF);
+        }
+        for (int attr_n = 0; attr_n < 6; attr_n++)
+        {
+            const float d1 = a[attr_n][1] - a[attr_n][0];
+            const float d2 = a[attr_n][2] - a[attr_n][0];
+            const float dx = (d1 * y20 - d2 * y10) * inv_area;
+            const float dy = (d2 * x10 - d1 * x20) * inv_area;
+            tri->Attr[attr_n][0] = a[attr_n][0] + dx * cx + dy * cy;
+            tri->Attr[attr_n][1] = dx;
+            tri->Attr[attr_n][2] = dy;
+        }
+    }
+    tri->Tex = tex;
+    tri->Flags = flags;
+    tri->MinX = min_x;
+    tri->MinY = min_y;
+    tri->MaxX = max_x;
+    tri->MaxY = max_y;
+}
+
+static void ImGui_ImplSoftRaster_SetupJobFunc(ImGui_ImplSoftRaster_Data* bd, int job_idx)
+{
+    const ImGui_ImplSoftRaster_SetupJob& job = bd->SetupJobs[job_idx];
+    ImGui_ImplSoftRaster_Tri* tri = bd->Tris.Data + job.TriOffset;
+    const ImDrawIdx* idx = job.IdxBuffer;
+    for (int tri_n = 0; tri_n < job.TriCount; tri_n++, tri++, idx += 3)
+        ImGui_ImplSoftRaster_SetupTriangle(bd, job, &job.VtxBuffer[idx[0]], &job.VtxBuffer[idx[1]], &job.VtxBuffer[idx[2]], tri);
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+static inline ImU32 ImGui_ImplSoftRaster_InterpolateCol(const float* row, const ImGui_ImplSoftRaster_Tri& tri, float fx)
+{
+    ImU32 col = 0;
+    for (int c = 0; c < 4; c++)
+    {
+        const int i = (int)(row[2 + c] + tri.Attr[2 + c][1] * fx + 0.5f);
+        col |= (ImU32)(i < 0 ? 0 : i > 255 ? 255 : i) << (c * 8);
+    }
+    return col;
+}
+
+template<int FLAGS>
+static void ImGui_ImplSoftRaster_ShadeSpan(const ImGui_ImplSoftRaster_Tri& tri, ImU32* dst, int x, int x_end, int y)
+{
+    // Attributes at start of row
+    const float fy = (float)(y - tri.MinY);
+    float row[6];
+    for (int attr_n = 0; attr_n < 6; attr_n++)
+        row[attr_n] = tri.Attr[attr_n][0] + tri.Attr[attr_n][2] * fy;
+
+    ImU32 src[4];
+    int src_count = 0;
+    for (; x < x_end; x++)
+    {
+        const float fx = (float)(x - tri.MinX);
+        const ImU32 col = (FLAGS & ImGui_ImplSoftRaster_TriFlags_InterpolateCol) ? ImGui_ImplSoftRaster_InterpolateCol(row, tri, fx) : tri.Col;
+        const ImU32 texel = (FLAGS & ImGui_ImplSoftRaster_TriFlags_SampleTex) ? ImGui_ImplSoftRaster_SampleTexture(tri.Tex, row[0] + tri.Attr[0][1] * fx, row[1] + tri.Attr[1][1] * fx) : tri.Texel;
+        src[src_count++] = ImGui_ImplSoftRaster_Modulate(col, texel);
+        if (src_count == 4)
+        {
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE
+            ImU32* d = dst + (x - 3);
+            _mm_storeu_si128((__m128i*)d, ImGui_ImplSoftRaster_Blend4_SSE(_mm_loadu_si128((const __m128i*)d), _mm_loadu_si128((const __m128i*)src)));
+#else
+            for (int n = 0; n < 4; n++)
+                dst[x - 3 + n] = ImGui_ImplSoftRaster_Blend(dst[x - 3 + n], src[n]);
+#endif
+            src_count = 0;
+        }
+    }
+    for (int n = 0; n < src_count; n++)
+        dst[x - src_count + n] = ImGui_ImplSoftRaster_Blend(dst[x - src_count + n], src[n]);
+}
+
+static void ImGui_ImplSoftRaster_RasterTriangle(ImGui_ImplSoftRaster_Data* bd, const ImGui_ImplSoftRaster_Tri& tri, int tile_x0, int tile_y0, int tile_x1, int tile_y1)
+{
+    const int min_x = ImGui_ImplSoftRaster_Max(tri.MinX, tile_x0);
+    const int min_y = ImGui_ImplSoftRaster_Max(tri.MinY, tile_y0);
+    const int max_x = ImGui_ImplSoftRaster_Min(tri.MaxX, tile_x1);
+    const int max_y = ImGui_ImplSoftRaster_Min(tri.MaxY, tile_y1);
+    const int half = IMGUI_IMPL_SOFTRASTER_SUBPIXELS / 2;
+    for (int y = min_y; y < max_y; y++)
+    {
+        // Find span of pixels which centers are inside all edges: A*(x*SUBPIXELS+half) + B*py + C >= 0
+        const ImS64 py = (ImS64)y * IMGUI_IMPL_SOFTRASTER_SUBPIXELS + half;
+        ImS64 x0 = min_x;
+        ImS64 x1 = max_x;
+        for (int n = 0; n < 3 && x0 < x1; n++)
+        {
+            const ImS64 a = tri.EdgeA[n];
+            const ImS64 m = a * half + tri.EdgeB[n] * py + tri.EdgeC[n];
+            if (a > 0)
+            {
+                const ImS64 edge_x0 = ImGui_ImplSoftRaster_CeilDiv(-m, a * IMGUI_IMPL_SOFTRASTER_SUBPIXELS);
+                x0 = (edge_x0 > x0) ? edge_x0 : x0;
+            }
+            else if (a < 0)
+            {
+                const ImS64 edge_x1 = ImGui_ImplSoftRaster_FloorDiv(m, -a * IMGUI_IMPL_SOFTRASTER_SUBPIXELS) + 1;
+                x1 = (edge_x1 < x1) ? edge_x1 : x1;
+            }
+            else if (m < 0)
+            {
+                x1 = x0;
+            }
+        }
+        if (x0 >= x1)
+            continue;
+
+        ImU32* dst = (ImU32*)(bd->Pixels + (size_t)y * bd->Pitch);
+        switch (tri.Flags)
+        {
+        case ImGui_ImplSoftRaster_TriFlags_None:
+            ImGui_ImplSoftRaster_BlendSpanSolid(dst + x0, (int)(x1 - x0), tri.Col);
+            break;
+        case ImGui_ImplSoftRaster_TriFlags_InterpolateCol:
+            ImGui_ImplSoftRaster_ShadeSpan<ImGui_ImplSoftRaster_TriFlags_InterpolateCol>(tri, dst, (int)x0, (int)x1, y);
+            break;
+        case ImGui_ImplSoftRaster_TriFlags_SampleTex:
+            ImGui_ImplSoftRaster_ShadeSpan<ImGui_ImplSoftRaster_TriFlags_SampleTex>(tri, dst, (int)x0, (int)x1, y);
+            break;
+        default:
+            ImGui_ImplSoftRaster_ShadeSpan<ImGui_ImplSoftRaster_TriFlags_InterpolateCol | ImGui_ImplSoftRaster_TriFlags_SampleTex>(tri, dst, (int)x0, (int)x1, y);
+            break;
+        }
+    }
+}
+
+static void ImGui_ImplSoftRaster_RasterTileFunc(ImGui_ImplSoftRaster_Data* bd, int tile_idx)
+{
+    const int tile_x0 = (tile_idx % bd->TilesCountX) * IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    const int tile_y0 = (tile_idx / bd->TilesCountX) * IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    const int tile_x1 = ImGui_ImplSoftRaster_Min(tile_x0 + IMGUI_IMPL_SOFTRASTER_TILE_SIZE, bd->Width);
+    const int tile_y1 = ImGui_ImplSoftRaster_Min(tile_y0 + IMGUI_IMPL_SOFTRASTER_TILE_SIZE, bd->Height);
+    for (int n = bd->TileTriOffsets[tile_idx]; n < bd->TileTriOffsets[tile_idx + 1]; n++)
+        ImGui_ImplSoftRaster_RasterTriangle(bd, bd->Tris[bd->TileTriIndices[n]], tile_x0, tile_y0, tile_x1, tile_y1);
+}
+
+// Setup, bin and rasterize all triangles submitted so far
+static void ImGui_ImplSoftRaster_Flush(ImGui_ImplSoftRaster_Data* bd)
+{
+    if (bd->SetupJobs.Size == 0)
+        return;
+
+    // Setup triangles
+    bd->Tris.resize(bd->TrisCount);
+    ImGui_ImplSoftRaster_RunJob(bd, ImGui_ImplSoftRaster_SetupJobFunc, bd->SetupJobs.Size);
+
+    // Bin triangles into tiles, preserving submission order
+    const int tiles_count = bd->TilesCountX * bd->TilesCountY;
+    bd->TileTriOffsets.resize(tiles_count + 1);
+    memset(bd->TileTriOffsets.Data, 0, (size_t)bd->TileTriOffsets.size_in_bytes());
+    int bins_count = 0;
+    for (const ImGui_ImplSoftRaster_Tri& tri : bd->Tris)
+        if (tri.MinX < tri.MaxX)
+            for (int tile_y = tri.MinY / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tile_y <= (tri.MaxY - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tile_y++)
+                for (int tile_x = tri.MinX / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tile_x <= (tri.MaxX - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tile_x++, bins_count++)
+                    bd->TileTriOffsets[tile_y * bd->TilesCountX + tile_x + 1]++;
+    for (int tile_n = 0; tile_n < tiles_count; tile_n++)
+        bd->TileTriOffsets[tile_n + 1] += bd->TileTriOffsets[tile_n];
+    bd->TileTriCursors.resize(tiles_count);
+    memcpy(bd->TileTriCursors.Data, bd->TileTriOffsets.Data, (size_t)bd->TileTriCursors.size_in_bytes());
+    bd->TileTriIndices.resize(bins_count);
+    for (int tri_n = 0; tri_n < bd->Tris.Size; tri_n++)
+    {
+        const ImGui_ImplSoftRaster_Tri& tri = bd->Tris[tri_n];
+        if (tri.MinX < tri.MaxX)
+            for (int tile_y = tri.MinY / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tile_y <= (tri.MaxY - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tile_y++)
+                for (int tile_x = tri.MinX / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tile_x <= (tri.MaxX - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tile_x++)
+                    bd->TileTriIndices[bd->TileTriCursors[tile_y * bd->TilesCountX + tile_x]++] = tri_n;
+    }
+
+    // Rasterize tiles
+    ImGui_ImplSoftRaster_RunJob(bd, ImGui_ImplSoftRaster_RasterTileFunc, tiles_count);
+
+    bd->SetupJobs.resize(0);
+    bd->TrisCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+bool    ImGui_ImplSoftRaster_Init(int threads_count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoftRaster_Data* bd = IM_NEW(ImGui_ImplSoftRaster_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+
+    // Start worker threads
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+    if (threads_count <= 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+    bd->ThreadsCount = ImGui_ImplSoftRaster_Min(ImGui_ImplSoftRaster_Max(threads_count, 1), 64);
+    for (int n = 1; n < bd->ThreadsCount; n++)
+        bd->Workers.push_back(IM_NEW(std::thread)(ImGui_ImplSoftRaster_WorkerThread, bd));
+#else
+    IM_UNUSED(threads_count);
+#endif
+
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_Shutdown()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImGui_ImplSoftRaster_DestroyDeviceObjects();
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+    {
+        std::lock_guard<std::mutex> lock(bd->JobMutex);
+        bd->JobQuit = true;
+    }
+    bd->JobStartCond.notify_all();
+    for (std::thread* worker : bd->Workers)
+    {
+        worker->join();
+        IM_DELETE(worker);
+    }
+    bd->Workers.clear();
+#endif
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    IM_DELETE(bd);
+}
+
+void    ImGui_ImplSoftRaster_NewFrame()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoftRaster_Init()?");
+    IM_UNUSED(bd);
+}
+
+void    ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, void* pixels, int width, int height, int pitch)
+{
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    int fb_width = ImGui_ImplSoftRaster_Min((int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x), width);
+    int fb_height = ImGui_ImplSoftRaster_Min((int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y), height);
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+
+    // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
+    // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                ImGui_ImplSoftRaster_UpdateTexture(tex);
+
+    // Setup framebuffer
+    bd->Pixels = (unsigned char*)pixels;
+    bd->Width = fb_width;
+    bd->Height = fb_height;
+    bd->Pitch = pitch;
+    bd->TilesCountX = (fb_width + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    bd->TilesCountY = (fb_height + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    bd->ClipOff = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    bd->ClipScale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Setup render state structure (for callbacks and custom texture bindings)
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    ImGui_ImplSoftRaster_RenderState render_state;
+    render_state.Pixels = pixels;
+    render_state.Width = fb_width;
+    render_state.Height = fb_height;
+    render_state.Pitch = pitch;
+    platform_io.Renderer_RenderState = &render_state;
+
+    // Render command lists
+    // (Triangles are accumulated and rasterized in bulk, flushing when reaching a user callback)
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                {
+                    ImGui_ImplSoftRaster_Flush(bd);
+                    pcmd->UserCallback(draw_list, pcmd);
+                }
+            }
+            else
+            {
+                // Project scissor/clipping rectangles into framebuffer space
+                ImVec2 clip_min((pcmd->ClipRect.x - bd->ClipOff.x) * bd->ClipScale.x, (pcmd->ClipRect.y - bd->ClipOff.y) * bd->ClipScale.y);
+                ImVec2 clip_max((pcmd->ClipRect.z - bd->ClipOff.x) * bd->ClipScale.x, (pcmd->ClipRect.w - bd->ClipOff.y) * bd->ClipScale.y);
+                if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
+                if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
+                if (clip_max.x > (float)fb_width) { clip_max.x = (float)fb_width; }
+                if (clip_max.y > (float)fb_height) { clip_max.y = (float)fb_height; }
+                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                    continue;
+
+                // Queue triangles for setup, in batches
+                ImGui_ImplSoftRaster_SetupJob job;
+                job.VtxBuffer = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
+                job.Tex = (const ImGui_ImplSoftRaster_Texture*)(intptr_t)pcmd->GetTexID();
+                job.ClipMinX = (int)clip_min.x;
+                job.ClipMinY = (int)clip_min.y;
+                job.ClipMaxX = (int)clip_max.x;
+                job.ClipMaxY = (int)clip_max.y;
+                const int tri_count = (int)pcmd->ElemCount / 3;
+                for (int tri_n = 0; tri_n < tri_count; tri_n += IMGUI_IMPL_SOFTRASTER_SETUP_BATCH)
+                {
+                    job.IdxBuffer = draw_list->IdxBuffer.Data + pcmd->IdxOffset + tri_n * 3;
+                    job.TriCount = ImGui_ImplSoftRaster_Min(tri_count - tri_n, IMGUI_IMPL_SOFTRASTER_SETUP_BATCH);
+                    job.TriOffset = bd->TrisCount;
+                    bd->TrisCount += job.TriCount;
+                    bd->SetupJobs.push_back(job);
+                }
+            }
+        }
+    }
+    ImGui_ImplSoftRaster_Flush(bd);
+    platform_io.Renderer_RenderState = nullptr;
+    bd->Pixels = nullptr;
+}
+
+// Convert to IM_COL32() layout
+static void ImGui_ImplSoftRaster_CopyTexturePixels(ImTextureData* tex, ImU32* dst_pixels, int x, int y, int w, int h)
+{
+    for (int row_n = 0; row_n < h; row_n++)
+    {
+        const unsigned char* src = (const unsigned char*)tex->GetPixelsAt(x, y + row_n);
+        ImU32* dst = dst_pixels + (size_t)(y + row_n) * tex->Width + x;
+        if (tex->Format == ImTextureFormat_RGBA32)
+            for (int n = 0; n < w; n++, src += 4)
+                dst[n] = IM_COL32(src[0], src[1], src[2], src[3]);
+        else
+            for (int n = 0; n < w; n++, src++)
+                dst[n] = IM_COL32(255, 255, 255, src[0]);
+    }
+}
+
+void ImGui_ImplSoftRaster_UpdateTexture(ImTextureData* tex)
+{
+    if (tex->Status == ImTextureStatus_WantCreate)
+    {
+        // Create texture. We keep a converted copy, because the rasterizer may read from it while ImTextureData pixels are being modified.
+        //IMGUI_DEBUG_LOG("UpdateTexture #%03d: WantCreate %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
+        IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
+        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32 || tex->Format == ImTextureFormat_Alpha8);
+        ImGui_ImplSoftRaster_Texture* backend_tex = IM_NEW(ImGui_ImplSoftRaster_Texture)();
+        ImU32* pixels = (ImU32*)IM_ALLOC((size_t)tex->Width * tex->Height * sizeof(ImU32));
+        ImGui_ImplSoftRaster_CopyTexturePixels(tex, pixels, 0, 0, tex->Width, tex->Height);
+        backend_tex->Pixels = pixels;
+        backend_tex->Width = tex->Width;
+        backend_tex->Height = tex->Height;
+
+        // Store identifiers
+        tex->SetTexID((ImTextureID)(intptr_t)backend_tex);
+        tex->BackendUserData = backend_tex;
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        // Update selected blocks. We only ever write to textures regions which have never been used before!
+        ImGui_ImplSoftRaster_Texture* backend_tex = (ImGui_ImplSoftRaster_Texture*)tex->BackendUserData;
+        for (ImTextureRect& r : tex->Updates)
+            ImGui_ImplSoftRaster_CopyTexturePixels(tex, (ImU32*)backend_tex->Pixels, r.x, r.y, r.w, r.h);
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantDestroy)
+    {
+        if (ImGui_ImplSoftRaster_Texture* backend_tex = (ImGui_ImplSoftRaster_Texture*)tex->BackendUserData)
+        {
+            IM_FREE((void*)backend_tex->Pixels);
+            IM_DELETE(backend_tex);
+        }
+
+        // Clear identifiers and mark as destroyed (in order to allow e.g. calling InvalidateDeviceObjects while running)
+        tex->SetTexID(ImTextureID_Invalid);
+        tex->BackendUserData = nullptr;
+        tex->SetStatus(ImTextureStatus_Destroyed);
+    }
+}
+
+bool    ImGui_ImplSoftRaster_CreateDeviceObjects()
+{
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_DestroyDeviceObjects()
+{
+    for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+        if (tex->RefCount == 1)
+        {
+            tex->SetStatus(ImTextureStatus_WantDestroy);
+            ImGui_ImplSoftRaster_UpdateTexture(tex);
+        }
+}
+
+//-----------------------------------------------------------------------------
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,60 @@
+// dear imgui: Renderer Backend for CPU software rasterization
+// This doesn't need a GPU: output is written into a RGBA framebuffer in memory, which you can save, compare or blit.
+// Useful for headless rendering (e.g. screenshot tests, server-side rendering), or as a reference renderer.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+//  [X] Renderer: Multi-threaded rasterization by screen tiles.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+// - threads_count: number of threads used to rasterize, including the calling thread. 0 = use std::thread::hardware_concurrency().
+// - Framebuffer pixels are 32-bit in the same layout as IM_COL32() (RGBA bytes in memory on little-endian CPUs, BGRA with IMGUI_USE_BGRA_PACKED_COLOR).
+//   The framebuffer is not cleared: clear it yourself before rendering. 'pitch' is the size of a row in bytes.
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_Init(int threads_count = 0);
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, void* pixels, int width, int height, int pitch);
+
+// Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_CreateDeviceObjects();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_DestroyDeviceObjects();
+
+// (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = NULL to handle this manually.
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_UpdateTexture(ImTextureData* tex);
+
+// Texture as read by the rasterizer, using bilinear filtering and clamp-to-edge addressing.
+// To display your own images, fill one and pass '(ImTextureID)(intptr_t)&my_texture' to e.g. ImGui::Image(). It needs to stay alive until rendering is done.
+struct ImGui_ImplSoftRaster_Texture
+{
+    const ImU32*            Pixels;             // Same layout as IM_COL32()
+    int                     Width;
+    int                     Height;
+};
+
+// [BETA] Selected render state data shared with callbacks.
+// This is temporarily stored in GetPlatformIO().Renderer_RenderState during the ImGui_ImplSoftRaster_RenderDrawData() call.
+// Everything submitted before a callback has been rasterized when it is called.
+struct ImGui_ImplSoftRaster_RenderState
+{
+    void*                   Pixels;
+    int                     Width;
+    int                     Height;
+    int                     Pitch;
+};
+
+#endif // #ifndef IMGUI_DISABLE
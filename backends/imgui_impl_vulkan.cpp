@@ -5,6 +5,8 @@
 //  [!] Renderer: User texture binding. Use 'VkDescriptorSet' as texture identifier. Call ImGui_ImplVulkan_AddTexture() to register one. Read the FAQ about ImTextureID/ImTextureRef + https://github.com/ocornut/imgui/pull/914 for discussions.
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [x] Renderer: Instanced rectangles and glyphs, expanded in vertex shader (ImGuiBackendFlags_RendererHasInstances) [opt-in with IMGUI_IMPL_VULKAN_ENABLE_INSTANCING]
+//  [x] Renderer: Compact 12 bytes vertices (ImGuiBackendFlags_RendererHasCompactVtx) [opt-in with IMGUI_IMPL_VULKAN_ENABLE_COMPACT_VTX]
 //  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
 
 // The aim of imgui_impl_vulkan.h/.cpp is to be usable in your engine without any modification.
@@ -27,6 +29,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: Vulkan: Added support for ImGuiBackendFlags_RendererHasCompactVtx, uploading ImDrawData::CompactVtxBuffer when valid and drawing it with a third pipeline. Opt-in with '#define IMGUI_IMPL_VULKAN_ENABLE_COMPACT_VTX'.
+//  2026-10-18: Vulkan: Added support for ImGuiBackendFlags_RendererHasInstances, drawing ImDrawInstance with a second pipeline (instance-rate vertex input, triangle strip). Opt-in with '#define IMGUI_IMPL_VULKAN_ENABLE_INSTANCING'.
 //  2025-06-27: Vulkan: Fixed validation errors during texture upload/update by aligning upload size to 'nonCoherentAtomSize'. (#8743, #8744)
 //  2025-06-11: Vulkan: Added support for ImGuiBackendFlags_RendererHasTextures, for dynamic font atlas. Removed ImGui_ImplVulkan_CreateFontsTexture() and ImGui_ImplVulkan_DestroyFontsTexture().
 //  2025-05-07: Vulkan: Fixed validation errors during window detach in multi-viewport mode. (#8600, #8176)
@@ -136,6 +140,7 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdBindPipeline) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdBindVertexBuffers) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdCopyBufferToImage) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdDraw) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdDrawIndexed) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdPipelineBarrier) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdPushConstants) \
@@ -219,6 +224,9 @@ struct ImGui_ImplVulkan_FrameRenderBuffers
     VkDeviceSize        IndexBufferSize;
     VkBuffer            VertexBuffer;
     VkBuffer            IndexBuffer;
+    VkDeviceMemory      InstanceBufferMemory;   // Only used with IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+    VkDeviceSize        InstanceBufferSize;
+    VkBuffer            InstanceBuffer;
 };
 
 // Each viewport will hold 1 ImGui_ImplVulkanH_WindowRenderBuffers
@@ -252,6 +260,10 @@ struct ImGui_ImplVulkan_Data
     VkPipeline                  Pipeline;
     VkShaderModule              ShaderModuleVert;
     VkShaderModule              ShaderModuleFrag;
+    VkPipeline                  InstPipeline;       // Only used with IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+    VkShaderModule              ShaderModuleInstVert;
+    VkPipeline                  CompactPipeline;    // Only used with IMGUI_IMPL_VULKAN_ENABLE_COMPACT_VTX
+    VkShaderModule              ShaderModuleCompactVert;
     VkDescriptorPool            DescriptorPool;
 
     // Texture management
@@ -379,6 +391,154 @@ static uint32_t __glsl_shader_frag_spv[] =
     0x00010038
 };
 
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+// backends/vulkan/glsl_shader_instance.vert, compiled with:
+// # glslangValidator -V -x -o glsl_shader_instance.vert.u32 glsl_shader_instance.vert
+/*
+#version 450 core
+layout(location = 0) in vec2 aPosMin;
+layout(location = 1) in vec2 aPosMax;
+layout(location = 2) in vec2 aUVMin;
+layout(location = 3) in vec2 aUVMax;
+layout(location = 4) in vec4 aColor;
+layout(push_constant) uniform uPushConstant { vec2 uScale; vec2 uTranslate; } pc;
+
+out gl_PerVertex { vec4 gl_Position; };
+layout(location = 0) out struct { vec4 Color; vec2 UV; } Out;
+
+void main()
+{
+    vec2 corner = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1);
+    Out.Color = aColor;
+    Out.UV = mix(aUVMin, aUVMax, corner);
+    gl_Position = vec4(mix(aPosMin, aPosMax, corner) * pc.uScale + pc.uTranslate, 0, 1);
+}
+*/
+static uint32_t __glsl_shader_instance_vert_spv[] =
+{
+    0x07230203,0x00010000,0x00080001,0x00000041,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+    0x000d000f,0x00000000,0x00000004,0x6e69616d,0x00000000,0x00000022,0x0000000b,0x0000000f,
+    0x00000013,0x00000014,0x00000018,0x00000019,0x0000001a,0x00030003,0x00000002,0x000001c2,
+    0x00040005,0x00000004,0x6e69616d,0x00000000,0x00060005,0x00000022,0x565f6c67,0x65747265,
+    0x646e4978,0x00007865,0x00030005,0x00000009,0x00000000,0x00050006,0x00000009,0x00000000,
+    0x6f6c6f43,0x00000072,0x00040006,0x00000009,0x00000001,0x00005655,0x00030005,0x0000000b,
+    0x0074754f,0x00040005,0x0000000f,0x6c6f4361,0x0000726f,0x00040005,0x00000013,0x4d565561,
+    0x00006e69,0x00040005,0x00000014,0x4d565561,0x00007861,0x00060005,0x00000016,0x505f6c67,
+    0x65567265,0x78657472,0x00000000,0x00060006,0x00000016,0x00000000,0x505f6c67,0x7469736f,
+    0x006e6f69,0x00030005,0x00000018,0x00000000,0x00040005,0x00000019,0x736f5061,0x006e694d,
+    0x00040005,0x0000001a,0x736f5061,0x0078614d,0x00060005,0x0000001b,0x73755075,0x6e6f4368,
+    0x6e617473,0x00000074,0x00050006,0x0000001b,0x00000000,0x61635375,0x0000656c,0x00060006,
+    0x0000001b,0x00000001,0x61725475,0x616c736e,0x00006574,0x00030005,0x0000001d,0x00006370,
+    0x00040047,0x00000022,0x0000000b,0x0000002a,0x00040047,0x0000000b,0x0000001e,0x00000000,
+    0x00040047,0x0000000f,0x0000001e,0x00000004,0x00040047,0x00000013,0x0000001e,0x00000002,
+    0x00040047,0x00000014,0x0000001e,0x00000003,0x00050048,0x00000016,0x00000000,0x0000000b,
+    0x00000000,0x00030047,0x00000016,0x00000002,0x00040047,0x00000019,0x0000001e,0x00000000,
+    0x00040047,0x0000001a,0x0000001e,0x00000001,0x00050048,0x0000001b,0x00000000,0x00000023,
+    0x00000000,0x00050048,0x0000001b,0x00000001,0x00000023,0x00000008,0x00030047,0x0000001b,
+    0x00000002,0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,
+    0x00000020,0x00040017,0x00000007,0x00000006,0x00000004,0x00040017,0x00000008,0x00000006,
+    0x00000002,0x0004001e,0x00000009,0x00000007,0x00000008,0x00040020,0x0000000a,0x00000003,
+    0x00000009,0x0004003b,0x0000000a,0x0000000b,0x00000003,0x00040015,0x0000000c,0x00000020,
+    0x00000001,0x0004002b,0x0000000c,0x0000000d,0x00000000,0x00040020,0x0000000e,0x00000001,
+    0x00000007,0x0004003b,0x0000000e,0x0000000f,0x00000001,0x00040020,0x00000010,0x00000003,
+    0x00000007,0x0004002b,0x0000000c,0x00000011,0x00000001,0x00040020,0x00000012,0x00000001,
+    0x00000008,0x0004003b,0x00000012,0x00000013,0x00000001,0x0004003b,0x00000012,0x00000014,
+    0x00000001,0x00040020,0x00000015,0x00000003,0x00000008,0x0003001e,0x00000016,0x00000007,
+    0x00040020,0x00000017,0x00000003,0x00000016,0x0004003b,0x00000017,0x00000018,0x00000003,
+    0x0004003b,0x00000012,0x00000019,0x00000001,0x0004003b,0x00000012,0x0000001a,0x00000001,
+    0x0004001e,0x0000001b,0x00000008,0x00000008,0x00040020,0x0000001c,0x00000009,0x0000001b,
+    0x0004003b,0x0000001c,0x0000001d,0x00000009,0x00040020,0x0000001e,0x00000009,0x00000008,
+    0x0004002b,0x00000006,0x0000001f,0x00000000,0x0004002b,0x00000006,0x00000020,0x3f800000,
+    0x00040020,0x00000021,0x00000001,0x0000000c,0x0004003b,0x00000021,0x00000022,0x00000001,
+    0x00050036,0x00000002,0x00000004,0x00000000,0x00000003,0x000200f8,0x00000005,0x0004003d,
+    0x0000000c,0x00000028,0x00000022,0x000500c7,0x0000000c,0x00000029,0x00000028,0x00000011,
+    0x0004006f,0x00000006,0x0000002a,0x00000029,0x000500c3,0x0000000c,0x0000002b,0x00000028,
+    0x00000011,0x0004006f,0x00000006,0x0000002c,0x0000002b,0x00050050,0x00000008,0x0000002d,
+    0x0000002a,0x0000002c,0x0004003d,0x00000007,0x0000002e,0x0000000f,0x00050041,0x00000010,
+    0x0000002f,0x0000000b,0x0000000d,0x0003003e,0x0000002f,0x0000002e,0x0004003d,0x00000008,
+    0x00000030,0x00000013,0x0004003d,0x00000008,0x00000031,0x00000014,0x0008000c,0x00000008,
+    0x00000032,0x00000001,0x0000002e,0x00000030,0x00000031,0x0000002d,0x00050041,0x00000015,
+    0x00000033,0x0000000b,0x00000011,0x0003003e,0x00000033,0x00000032,0x0004003d,0x00000008,
+    0x00000034,0x00000019,0x0004003d,0x00000008,0x00000035,0x0000001a,0x0008000c,0x00000008,
+    0x00000036,0x00000001,0x0000002e,0x00000034,0x00000035,0x0000002d,0x00050041,0x0000001e,
+    0x00000037,0x0000001d,0x0000000d,0x0004003d,0x00000008,0x00000038,0x00000037,0x00050085,
+    0x00000008,0x00000039,0x00000036,0x00000038,0x00050041,0x0000001e,0x0000003a,0x0000001d,
+    0x00000011,0x0004003d,0x00000008,0x0000003b,0x0000003a,0x00050081,0x00000008,0x0000003c,
+    0x00000039,0x0000003b,0x00050051,0x00000006,0x0000003d,0x0000003c,0x00000000,0x00050051,
+    0x00000006,0x0000003e,0x0000003c,0x00000001,0x00070050,0x00000007,0x0000003f,0x0000003d,
+    0x0000003e,0x0000001f,0x00000020,0x00050041,0x00000010,0x00000040,0x00000018,0x0000000d,
+    0x0003003e,0x00000040,0x0000003f,0x000100fd,0x00010038
+};
+#endif
+
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_COMPACT_VTX
+// backends/vulkan/glsl_shader_compact.vert, compiled with:
+// # glslangValidator -V -x -o glsl_shader_compact.vert.u32 glsl_shader_compact.vert
+/*
+#version 450 core
+layout(location = 0) in ivec2 aPos;
+layout(location = 1) in vec2 aUV;
+layout(location = 2) in vec4 aColor;
+layout(push_constant) uniform uPushConstant { vec2 uScale; vec2 uTranslate; } pc;
+
+out gl_PerVertex { vec4 gl_Position; };
+layout(location = 0) out struct { vec4 Color; vec2 UV; } Out;
+
+void main()
+{
+    Out.Color = aColor;
+    Out.UV = aUV;
+    gl_Position = vec4(vec2(aPos) * pc.uScale + pc.uTranslate, 0, 1);
+}
+*/
+static uint32_t __glsl_shader_compact_vert_spv[] =
+{
+    0x07230203,0x00010000,0x00080001,0x00000031,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+    0x000a000f,0x00000000,0x00000004,0x6e69616d,0x00000000,0x0000000b,0x0000000f,0x00000015,
+    0x0000001b,0x0000001c,0x00030003,0x00000002,0x000001c2,0x00040005,0x00000004,0x6e69616d,
+    0x00000000,0x00030005,0x00000009,0x00000000,0x00050006,0x00000009,0x00000000,0x6f6c6f43,
+    0x00000072,0x00040006,0x00000009,0x00000001,0x00005655,0x00030005,0x0000000b,0x0074754f,
+    0x00040005,0x0000000f,0x6c6f4361,0x0000726f,0x00030005,0x00000015,0x00565561,0x00060005,
+    0x00000019,0x505f6c67,0x65567265,0x78657472,0x00000000,0x00060006,0x00000019,0x00000000,
+    0x505f6c67,0x7469736f,0x006e6f69,0x00030005,0x0000001b,0x00000000,0x00040005,0x0000001c,
+    0x736f5061,0x00000000,0x00060005,0x0000001e,0x73755075,0x6e6f4368,0x6e617473,0x00000074,
+    0x00050006,0x0000001e,0x00000000,0x61635375,0x0000656c,0x00060006,0x0000001e,0x00000001,
+    0x61725475,0x616c736e,0x00006574,0x00030005,0x00000020,0x00006370,0x00040047,0x0000000b,
+    0x0000001e,0x00000000,0x00040047,0x0000000f,0x0000001e,0x00000002,0x00040047,0x00000015,
+    0x0000001e,0x00000001,0x00050048,0x00000019,0x00000000,0x0000000b,0x00000000,0x00030047,
+    0x00000019,0x00000002,0x00040047,0x0000001c,0x0000001e,0x00000000,0x00050048,0x0000001e,
+    0x00000000,0x00000023,0x00000000,0x00050048,0x0000001e,0x00000001,0x00000023,0x00000008,
+    0x00030047,0x0000001e,0x00000002,0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,
+    0x00030016,0x00000006,0x00000020,0x00040017,0x00000007,0x00000006,0x00000004,0x00040017,
+    0x00000008,0x00000006,0x00000002,0x0004001e,0x00000009,0x00000007,0x00000008,0x00040020,
+    0x0000000a,0x00000003,0x00000009,0x0004003b,0x0000000a,0x0000000b,0x00000003,0x00040015,
+    0x0000000c,0x00000020,0x00000001,0x0004002b,0x0000000c,0x0000000d,0x00000000,0x00040020,
+    0x0000000e,0x00000001,0x00000007,0x0004003b,0x0000000e,0x0000000f,0x00000001,0x00040020,
+    0x00000011,0x00000003,0x00000007,0x0004002b,0x0000000c,0x00000013,0x00000001,0x00040020,
+    0x00000014,0x00000001,0x00000008,0x0004003b,0x00000014,0x00000015,0x00000001,0x00040020,
+    0x00000017,0x00000003,0x00000008,0x0003001e,0x00000019,0x00000007,0x00040020,0x0000001a,
+    0x00000003,0x00000019,0x0004003b,0x0000001a,0x0000001b,0x00000003,0x00040017,0x0000002e,
+    0x0000000c,0x00000002,0x00040020,0x0000002f,0x00000001,0x0000002e,0x0004003b,0x0000002f,
+    0x0000001c,0x00000001,0x0004001e,0x0000001e,0x00000008,0x00000008,0x00040020,0x0000001f,
+    0x00000009,0x0000001e,0x0004003b,0x0000001f,0x00000020,0x00000009,0x00040020,0x00000021,
+    0x00000009,0x00000008,0x0004002b,0x00000006,0x00000028,0x00000000,0x0004002b,0x00000006,
+    0x00000029,0x3f800000,0x00050036,0x00000002,0x00000004,0x00000000,0x00000003,0x000200f8,
+    0x00000005,0x0004003d,0x00000007,0x00000010,0x0000000f,0x00050041,0x00000011,0x00000012,
+    0x0000000b,0x0000000d,0x0003003e,0x00000012,0x00000010,0x0004003d,0x00000008,0x00000016,
+    0x00000015,0x00050041,0x00000017,0x00000018,0x0000000b,0x00000013,0x0003003e,0x00000018,
+    0x00000016,0x0004003d,0x0000002e,0x00000030,0x0000001c,0x0004006f,0x00000008,0x0000001d,
+    0x00000030,0x00050041,0x00000021,0x00000022,0x00000020,0x0000000d,0x0004003d,0x00000008,
+    0x00000023,0x00000022,0x00050085,0x00000008,0x00000024,0x0000001d,0x00000023,0x00050041,
+    0x00000021,0x00000025,0x00000020,0x00000013,0x0004003d,0x00000008,0x00000026,0x00000025,
+    0x00050081,0x00000008,0x00000027,0x00000024,0x00000026,0x00050051,0x00000006,0x0000002a,
+    0x00000027,0x00000000,0x00050051,0x00000006,0x0000002b,0x00000027,0x00000001,0x00070050,
+    0x00000007,0x0000002c,0x0000002a,0x0000002b,0x00000028,0x00000029,0x00050041,0x00000011,
+    0x0000002d,0x0000001b,0x0000000d,0x0003003e,0x0000002d,0x0000002c,0x000100fd,0x00010038
+};
+#endif
+
 //-----------------------------------------------------------------------------
 // FUNCTIONS
 //-----------------------------------------------------------------------------
@@ -453,6 +613,29 @@ static void CreateOrResizeBuffer(VkBuffer& buffer, VkDeviceMemory& buffer_memory
     buffer_size = buffer_size_aligned;
 }
 
+// Setup scale and translation:
+// Our visible imgui space lies from draw_data->DisplayPps (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
+// With compact vertices, fold ImDrawVertCompact position decoding (CompactVtxOrigin + pos / IM_DRAWVERT_COMPACT_POS_SCALE) into them.
+static void ImGui_ImplVulkan_SetupPushConstants(ImDrawData* draw_data, VkCommandBuffer command_buffer, bool use_compact_vtx)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    float scale[2];
+    scale[0] = 2.0f / draw_data->DisplaySize.x;
+    scale[1] = 2.0f / draw_data->DisplaySize.y;
+    float translate[2];
+    translate[0] = -1.0f - draw_data->DisplayPos.x * scale[0];
+    translate[1] = -1.0f - draw_data->DisplayPos.y * scale[1];
+    if (use_compact_vtx)
+    {
+        translate[0] += draw_data->CompactVtxOrigin.x * scale[0];
+        translate[1] += draw_data->CompactVtxOrigin.y * scale[1];
+        scale[0] /= IM_DRAWVERT_COMPACT_POS_SCALE;
+        scale[1] /= IM_DRAWVERT_COMPACT_POS_SCALE;
+    }
+    vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 0, sizeof(float) * 2, scale);
+    vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 2, sizeof(float) * 2, translate);
+}
+
 static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline pipeline, VkCommandBuffer command_buffer, ImGui_ImplVulkan_FrameRenderBuffers* rb, int fb_width, int fb_height)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
@@ -484,19 +667,26 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
     }
 
     // Setup scale and translation:
-    // Our visible imgui space lies from draw_data->DisplayPps (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
-    {
-        float scale[2];
-        scale[0] = 2.0f / draw_data->DisplaySize.x;
-        scale[1] = 2.0f / draw_data->DisplaySize.y;
-        float translate[2];
-        translate[0] = -1.0f - draw_data->DisplayPos.x * scale[0];
-        translate[1] = -1.0f - draw_data->DisplayPos.y * scale[1];
-        vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 0, sizeof(float) * 2, scale);
-        vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 2, sizeof(float) * 2, translate);
-    }
+    ImGui_ImplVulkan_SetupPushConstants(draw_data, command_buffer, pipeline == bd->CompactPipeline && pipeline != VK_NULL_HANDLE);
 }
 
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+// Switch between 'pipeline' reading ImDrawVert (or ImDrawVertCompact) and bd->InstPipeline reading ImDrawInstance.
+// Both share the same pipeline layout and dynamic state, so push constants, descriptor sets, viewport and scissor are preserved.
+static void ImGui_ImplVulkan_SetInstanceState(ImDrawData* draw_data, VkPipeline pipeline, VkCommandBuffer command_buffer, ImGui_ImplVulkan_FrameRenderBuffers* rb, bool use_instances)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, use_instances ? bd->InstPipeline : pipeline);
+    if (pipeline == bd->CompactPipeline && pipeline != VK_NULL_HANDLE)
+        ImGui_ImplVulkan_SetupPushConstants(draw_data, command_buffer, !use_instances); // Instances positions are not compact
+    if (!use_instances && draw_data->TotalVtxCount == 0)
+        return;
+    VkBuffer vertex_buffers[1] = { use_instances ? rb->InstanceBuffer : rb->VertexBuffer };
+    VkDeviceSize vertex_offset[1] = { 0 };
+    vkCmdBindVertexBuffers(command_buffer, 0, 1, vertex_buffers, vertex_offset);
+}
+#endif
+
 // Render function
 void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer command_buffer, VkPipeline pipeline)
 {
@@ -515,8 +705,10 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
 
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    // Use compact vertices when Render() could convert all of them (see ImGuiBackendFlags_RendererHasCompactVtx). Not with a user-provided pipeline, which expects ImDrawVert.
+    const bool use_compact_vtx = (pipeline == VK_NULL_HANDLE && bd->CompactPipeline != VK_NULL_HANDLE && draw_data->TotalVtxCount > 0 && draw_data->CompactVtxBuffer.Size == draw_data->TotalVtxCount);
     if (pipeline == VK_NULL_HANDLE)
-        pipeline = bd->Pipeline;
+        pipeline = use_compact_vtx ? bd->CompactPipeline : bd->Pipeline;
 
     // Allocate array to store enough vertex/index buffers
     ImGui_ImplVulkan_WindowRenderBuffers* wrb = &bd->MainWindowRenderBuffers;
@@ -534,7 +726,7 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     if (draw_data->TotalVtxCount > 0)
     {
         // Create or resize the vertex/index buffers
-        VkDeviceSize vertex_size = AlignBufferSize(draw_data->TotalVtxCount * sizeof(ImDrawVert), bd->BufferMemoryAlignment);
+        VkDeviceSize vertex_size = AlignBufferSize(draw_data->TotalVtxCount * (use_compact_vtx ? sizeof(ImDrawVertCompact) : sizeof(ImDrawVert)), bd->BufferMemoryAlignment);
         VkDeviceSize index_size = AlignBufferSize(draw_data->TotalIdxCount * sizeof(ImDrawIdx), bd->BufferMemoryAlignment);
         if (rb->VertexBuffer == VK_NULL_HANDLE || rb->VertexBufferSize < vertex_size)
             CreateOrResizeBuffer(rb->VertexBuffer, rb->VertexBufferMemory, rb->VertexBufferSize, vertex_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
@@ -548,12 +740,17 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
         check_vk_result(err);
         err = vkMapMemory(v->Device, rb->IndexBufferMemory, 0, index_size, 0, (void**)&idx_dst);
         check_vk_result(err);
+        if (use_compact_vtx)
+            memcpy(vtx_dst, draw_data->CompactVtxBuffer.Data, draw_data->CompactVtxBuffer.Size * sizeof(ImDrawVertCompact)); // Already concatenated in CmdLists[] order
         for (int n = 0; n < draw_data->CmdListsCount; n++)
         {
             const ImDrawList* draw_list = draw_data->CmdLists[n];
-            memcpy(vtx_dst, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+            if (!use_compact_vtx)
+            {
+                memcpy(vtx_dst, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+                vtx_dst += draw_list->VtxBuffer.Size;
+            }
             memcpy(idx_dst, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size * sizeof(ImDrawIdx));
-            vtx_dst += draw_list->VtxBuffer.Size;
             idx_dst += draw_list->IdxBuffer.Size;
         }
         VkMappedMemoryRange range[2] = {};
@@ -569,6 +766,33 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
         vkUnmapMemory(v->Device, rb->IndexBufferMemory);
     }
 
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+    // Upload instances into their own buffer (see ImGuiBackendFlags_RendererHasInstances)
+    if (draw_data->TotalInstCount > 0 && bd->InstPipeline != VK_NULL_HANDLE)
+    {
+        VkDeviceSize instance_size = AlignBufferSize(draw_data->TotalInstCount * sizeof(ImDrawInstance), bd->BufferMemoryAlignment);
+        if (rb->InstanceBuffer == VK_NULL_HANDLE || rb->InstanceBufferSize < instance_size)
+            CreateOrResizeBuffer(rb->InstanceBuffer, rb->InstanceBufferMemory, rb->InstanceBufferSize, instance_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+
+        ImDrawInstance* inst_dst = nullptr;
+        VkResult err = vkMapMemory(v->Device, rb->InstanceBufferMemory, 0, instance_size, 0, (void**)&inst_dst);
+        check_vk_result(err);
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+        {
+            const ImDrawList* draw_list = draw_data->CmdLists[n];
+            memcpy(inst_dst, draw_list->InstBuffer.Data, draw_list->InstBuffer.Size * sizeof(ImDrawInstance));
+            inst_dst += draw_list->InstBuffer.Size;
+        }
+        VkMappedMemoryRange range = {};
+        range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range.memory = rb->InstanceBufferMemory;
+        range.size = VK_WHOLE_SIZE;
+        err = vkFlushMappedMemoryRanges(v->Device, 1, &range);
+        check_vk_result(err);
+        vkUnmapMemory(v->Device, rb->InstanceBufferMemory);
+    }
+#endif
+
     // Setup desired Vulkan state
     ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
 
@@ -588,12 +812,25 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     // (Because we merged all buffers into a single one, we maintain our own offset into them)
     int global_vtx_offset = 0;
     int global_idx_offset = 0;
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+    int global_inst_offset = 0;
+    bool inst_state = false;
+#endif
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* draw_list = draw_data->CmdLists[n];
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+            // Instanced and regular commands use different pipelines: each change of kind costs a pipeline bind.
+            const bool cmd_uses_instances = (pcmd->UserCallback == nullptr && pcmd->InstCount > 0);
+            if (cmd_uses_instances != inst_state)
+            {
+                ImGui_ImplVulkan_SetInstanceState(draw_data, pipeline, command_buffer, rb, cmd_uses_instances);
+                inst_state = cmd_uses_instances;
+            }
+#endif
             if (pcmd->UserCallback != nullptr)
             {
                 // User callback, registered via ImDrawList::AddCallback()
@@ -630,11 +867,21 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                 vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, &desc_set, 0, nullptr);
 
                 // Draw
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+                if (cmd_uses_instances)
+                {
+                    vkCmdDraw(command_buffer, 4, pcmd->InstCount, 0, pcmd->InstOffset + global_inst_offset);
+                    continue;
+                }
+#endif
                 vkCmdDrawIndexed(command_buffer, pcmd->ElemCount, 1, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset, 0);
             }
         }
         global_idx_offset += draw_list->IdxBuffer.Size;
         global_vtx_offset += draw_list->VtxBuffer.Size;
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+        global_inst_offset += draw_list->InstBuffer.Size;
+#endif
     }
     platform_io.Renderer_RenderState = nullptr;
 
@@ -889,9 +1136,41 @@ static void ImGui_ImplVulkan_CreateShaderModules(VkDevice device, const VkAlloca
         VkResult err = vkCreateShaderModule(device, &frag_info, allocator, &bd->ShaderModuleFrag);
         check_vk_result(err);
     }
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+    if (bd->ShaderModuleInstVert == VK_NULL_HANDLE)
+    {
+        VkShaderModuleCreateInfo vert_info = {};
+        vert_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        vert_info.codeSize = sizeof(__glsl_shader_instance_vert_spv);
+        vert_info.pCode = (uint32_t*)__glsl_shader_instance_vert_spv;
+        VkResult err = vkCreateShaderModule(device, &vert_info, allocator, &bd->ShaderModuleInstVert);
+        check_vk_result(err);
+    }
+#endif
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_COMPACT_VTX
+    if (bd->ShaderModuleCompactVert == VK_NULL_HANDLE)
+    {
+        VkShaderModuleCreateInfo vert_info = {};
+        vert_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        vert_info.codeSize = sizeof(__glsl_shader_compact_vert_spv);
+        vert_info.pCode = (uint32_t*)__glsl_shader_compact_vert_spv;
+        VkResult err = vkCreateShaderModule(device, &vert_info, allocator, &bd->ShaderModuleCompactVert);
+        check_vk_result(err);
+    }
+#endif
 }
 
-static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationCallbacks* allocator, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkSampleCountFlagBits MSAASamples, VkPipeline* pipeline, uint32_t subpass)
+// Vertex input of pipelines created by ImGui_ImplVulkan_CreatePipeline()
+// - ImDrawVertCompact: same shader with integer positions, decoded with push constants (see ImGui_ImplVulkan_SetupPushConstants()).
+// - ImDrawInstance: one instance per rectangle, expanded as a 4 vertices triangle strip by the vertex shader.
+enum ImGui_ImplVulkan_VtxInput
+{
+    ImGui_ImplVulkan_VtxInput_DrawVert,
+    ImGui_ImplVulkan_VtxInput_DrawVertCompact,
+    ImGui_ImplVulkan_VtxInput_DrawInstance,
+};
+
+static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationCallbacks* allocator, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkSampleCountFlagBits MSAASamples, VkPipeline* pipeline, uint32_t subpass, ImGui_ImplVulkan_VtxInput vtx_input)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_CreateShaderModules(device, allocator);
@@ -899,7 +1178,7 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     VkPipelineShaderStageCreateInfo stage[2] = {};
     stage[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     stage[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
-    stage[0].module = bd->ShaderModuleVert;
+    stage[0].module = (vtx_input == ImGui_ImplVulkan_VtxInput_DrawInstance) ? bd->ShaderModuleInstVert : (vtx_input == ImGui_ImplVulkan_VtxInput_DrawVertCompact) ? bd->ShaderModuleCompactVert : bd->ShaderModuleVert;
     stage[0].pName = "main";
     stage[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     stage[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
@@ -924,16 +1203,72 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     attribute_desc[2].format = VK_FORMAT_R8G8B8A8_UNORM;
     attribute_desc[2].offset = offsetof(ImDrawVert, col);
 
+    VkVertexInputBindingDescription compact_binding_desc[1] = {};
+    compact_binding_desc[0].stride = sizeof(ImDrawVertCompact);
+    compact_binding_desc[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+    VkVertexInputAttributeDescription compact_attribute_desc[3] = {};
+    compact_attribute_desc[0].location = 0;
+    compact_attribute_desc[0].binding = compact_binding_desc[0].binding;
+    compact_attribute_desc[0].format = VK_FORMAT_R16G16_SINT;
+    compact_attribute_desc[0].offset = offsetof(ImDrawVertCompact, pos);
+    compact_attribute_desc[1].location = 1;
+    compact_attribute_desc[1].binding = compact_binding_desc[0].binding;
+    compact_attribute_desc[1].format = VK_FORMAT_R16G16_UNORM;
+    compact_attribute_desc[1].offset = offsetof(ImDrawVertCompact, uv);
+    compact_attribute_desc[2].location = 2;
+    compact_attribute_desc[2].binding = compact_binding_desc[0].binding;
+    compact_attribute_desc[2].format = VK_FORMAT_R8G8B8A8_UNORM;
+    compact_attribute_desc[2].offset = offsetof(ImDrawVertCompact, col);
+
+    VkVertexInputBindingDescription inst_binding_desc[1] = {};
+    inst_binding_desc[0].stride = sizeof(ImDrawInstance);
+    inst_binding_desc[0].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+    VkVertexInputAttributeDescription inst_attribute_desc[5] = {};
+    inst_attribute_desc[0].location = 0;
+    inst_attribute_desc[0].binding = inst_binding_desc[0].binding;
+    inst_attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
+    inst_attribute_desc[0].offset = offsetof(ImDrawInstance, pos_min);
+    inst_attribute_desc[1].location = 1;
+    inst_attribute_desc[1].binding = inst_binding_desc[0].binding;
+    inst_attribute_desc[1].format = VK_FORMAT_R32G32_SFLOAT;
+    inst_attribute_desc[1].offset = offsetof(ImDrawInstance, pos_max);
+    inst_attribute_desc[2].location = 2;
+    inst_attribute_desc[2].binding = inst_binding_desc[0].binding;
+    inst_attribute_desc[2].format = VK_FORMAT_R32G32_SFLOAT;
+    inst_attribute_desc[2].offset = offsetof(ImDrawInstance, uv_min);
+    inst_attribute_desc[3].location = 3;
+    inst_attribute_desc[3].binding = inst_binding_desc[0].binding;
+    inst_attribute_desc[3].format = VK_FORMAT_R32G32_SFLOAT;
+    inst_attribute_desc[3].offset = offsetof(ImDrawInstance, uv_max);
+    inst_attribute_desc[4].location = 4;
+    inst_attribute_desc[4].binding = inst_binding_desc[0].binding;
+    inst_attribute_desc[4].format = VK_FORMAT_R8G8B8A8_UNORM;
+    inst_attribute_desc[4].offset = offsetof(ImDrawInstance, col);
+
     VkPipelineVertexInputStateCreateInfo vertex_info = {};
     vertex_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
     vertex_info.vertexBindingDescriptionCount = 1;
     vertex_info.pVertexBindingDescriptions = binding_desc;
-    vertex_info.vertexAttributeDescriptionCount = 3;
+    vertex_info.vertexAttributeDescriptionCount = (uint32_t)IM_ARRAYSIZE(attribute_desc);
     vertex_info.pVertexAttributeDescriptions = attribute_desc;
+    if (vtx_input == ImGui_ImplVulkan_VtxInput_DrawVertCompact)
+    {
+        vertex_info.pVertexBindingDescriptions = compact_binding_desc;
+        vertex_info.vertexAttributeDescriptionCount = (uint32_t)IM_ARRAYSIZE(compact_attribute_desc);
+        vertex_info.pVertexAttributeDescriptions = compact_attribute_desc;
+    }
+    if (vtx_input == ImGui_ImplVulkan_VtxInput_DrawInstance)
+    {
+        vertex_info.pVertexBindingDescriptions = inst_binding_desc;
+        vertex_info.vertexAttributeDescriptionCount = (uint32_t)IM_ARRAYSIZE(inst_attribute_desc);
+        vertex_info.pVertexAttributeDescriptions = inst_attribute_desc;
+    }
 
     VkPipelineInputAssemblyStateCreateInfo ia_info = {};
     ia_info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    ia_info.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    ia_info.topology = (vtx_input == ImGui_ImplVulkan_VtxInput_DrawInstance) ? VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP : VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
 
     VkPipelineViewportStateCreateInfo viewport_info = {};
     viewport_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
@@ -1077,7 +1412,13 @@ bool ImGui_ImplVulkan_CreateDeviceObjects()
         check_vk_result(err);
     }
 
-    ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->Pipeline, v->Subpass);
+    ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->Pipeline, v->Subpass, ImGui_ImplVulkan_VtxInput_DrawVert);
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+    ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->InstPipeline, v->Subpass, ImGui_ImplVulkan_VtxInput_DrawInstance);
+#endif
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_COMPACT_VTX
+    ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->CompactPipeline, v->Subpass, ImGui_ImplVulkan_VtxInput_DrawVertCompact);
+#endif
 
     // Create command pool/buffer for texture upload
     if (!bd->TexCommandPool)
@@ -1118,9 +1459,13 @@ void    ImGui_ImplVulkan_DestroyDeviceObjects()
     if (bd->TexSampler)           { vkDestroySampler(v->Device, bd->TexSampler, v->Allocator); bd->TexSampler = VK_NULL_HANDLE; }
     if (bd->ShaderModuleVert)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleVert, v->Allocator); bd->ShaderModuleVert = VK_NULL_HANDLE; }
     if (bd->ShaderModuleFrag)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleFrag, v->Allocator); bd->ShaderModuleFrag = VK_NULL_HANDLE; }
+    if (bd->ShaderModuleInstVert) { vkDestroyShaderModule(v->Device, bd->ShaderModuleInstVert, v->Allocator); bd->ShaderModuleInstVert = VK_NULL_HANDLE; }
+    if (bd->ShaderModuleCompactVert) { vkDestroyShaderModule(v->Device, bd->ShaderModuleCompactVert, v->Allocator); bd->ShaderModuleCompactVert = VK_NULL_HANDLE; }
     if (bd->DescriptorSetLayout)  { vkDestroyDescriptorSetLayout(v->Device, bd->DescriptorSetLayout, v->Allocator); bd->DescriptorSetLayout = VK_NULL_HANDLE; }
     if (bd->PipelineLayout)       { vkDestroyPipelineLayout(v->Device, bd->PipelineLayout, v->Allocator); bd->PipelineLayout = VK_NULL_HANDLE; }
     if (bd->Pipeline)             { vkDestroyPipeline(v->Device, bd->Pipeline, v->Allocator); bd->Pipeline = VK_NULL_HANDLE; }
+    if (bd->InstPipeline)         { vkDestroyPipeline(v->Device, bd->InstPipeline, v->Allocator); bd->InstPipeline = VK_NULL_HANDLE; }
+    if (bd->CompactPipeline)      { vkDestroyPipeline(v->Device, bd->CompactPipeline, v->Allocator); bd->CompactPipeline = VK_NULL_HANDLE; }
     if (bd->DescriptorPool)       { vkDestroyDescriptorPool(v->Device, bd->DescriptorPool, v->Allocator); bd->DescriptorPool = VK_NULL_HANDLE; }
 }
 
@@ -1213,6 +1558,12 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info)
     io.BackendRendererName = "imgui_impl_vulkan";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
     io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasInstances;  // We can render ImDrawCmd::InstCount instances of ImDrawList::InstBuffer[].
+#endif
+#ifdef IMGUI_IMPL_VULKAN_ENABLE_COMPACT_VTX
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasCompactVtx; // We can upload ImDrawData::CompactVtxBuffer instead of ImDrawVert.
+#endif
 
     IM_ASSERT(info->Instance != VK_NULL_HANDLE);
     IM_ASSERT(info->PhysicalDevice != VK_NULL_HANDLE);
@@ -1263,7 +1614,7 @@ void ImGui_ImplVulkan_Shutdown()
 
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasInstances | ImGuiBackendFlags_RendererHasCompactVtx);
     IM_DELETE(bd);
 }
 
@@ -1339,8 +1690,11 @@ void ImGui_ImplVulkan_DestroyFrameRenderBuffers(VkDevice device, ImGui_ImplVulka
     if (buffers->VertexBufferMemory) { vkFreeMemory(device, buffers->VertexBufferMemory, allocator); buffers->VertexBufferMemory = VK_NULL_HANDLE; }
     if (buffers->IndexBuffer) { vkDestroyBuffer(device, buffers->IndexBuffer, allocator); buffers->IndexBuffer = VK_NULL_HANDLE; }
     if (buffers->IndexBufferMemory) { vkFreeMemory(device, buffers->IndexBufferMemory, allocator); buffers->IndexBufferMemory = VK_NULL_HANDLE; }
+    if (buffers->InstanceBuffer) { vkDestroyBuffer(device, buffers->InstanceBuffer, allocator); buffers->InstanceBuffer = VK_NULL_HANDLE; }
+    if (buffers->InstanceBufferMemory) { vkFreeMemory(device, buffers->InstanceBufferMemory, allocator); buffers->InstanceBufferMemory = VK_NULL_HANDLE; }
     buffers->VertexBufferSize = 0;
     buffers->IndexBufferSize = 0;
+    buffers->InstanceBufferSize = 0;
 }
 
 void ImGui_ImplVulkan_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulkan_WindowRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
@@ -1662,7 +2016,7 @@ void ImGui_ImplVulkanH_CreateWindowSwapChain(VkPhysicalDevice physical_device, V
 
         // We do not create a pipeline by default as this is also used by examples' main.cpp,
         // but secondary viewport in multi-viewport mode may want to create one with:
-        //ImGui_ImplVulkan_CreatePipeline(device, allocator, VK_NULL_HANDLE, wd->RenderPass, VK_SAMPLE_COUNT_1_BIT, &wd->Pipeline, v->Subpass);
+        //ImGui_ImplVulkan_CreatePipeline(device, allocator, VK_NULL_HANDLE, wd->RenderPass, VK_SAMPLE_COUNT_1_BIT, &wd->Pipeline, v->Subpass, ImGui_ImplVulkan_VtxInput_DrawVert);
     }
 
     // Create The Image Views
@@ -45,6 +45,17 @@
 // (you can also technically use IMGUI_IMPL_VULKAN_NO_PROTOTYPES + wrap Volk via ImGui_ImplVulkan_LoadFunctions().)
 //#define IMGUI_IMPL_VULKAN_USE_VOLK
 
+// [Configuration] Instanced rectangles and glyphs (ImGuiBackendFlags_RendererHasInstances), with a second pipeline.
+// Reduces vertex data by ~40% but slightly increases the number of draw calls, as instanced commands can't be merged
+// with interleaved triangle commands (see ImGuiBackendFlags_RendererHasInstances). Mostly worth it with bandwidth-limited GPU.
+// Add in your imconfig.h file or as a compilation flag.
+//#define IMGUI_IMPL_VULKAN_ENABLE_INSTANCING
+
+// [Configuration] Compact 12 bytes vertices (ImGuiBackendFlags_RendererHasCompactVtx), with a third pipeline.
+// Reduces vertex upload size by 40% (e.g. for remote/streaming sessions), at the cost of converting vertices in Render().
+// Add in your imconfig.h file or as a compilation flag.
+//#define IMGUI_IMPL_VULKAN_ENABLE_COMPACT_VTX
+
 #if defined(IMGUI_IMPL_VULKAN_NO_PROTOTYPES) && !defined(VK_NO_PROTOTYPES)
 #define VK_NO_PROTOTYPES
 #endif
@@ -0,0 +1,29 @@
+#version 450 core
+layout(location = 0) in vec2 aPosMin;
+layout(location = 1) in vec2 aPosMax;
+layout(location = 2) in vec2 aUVMin;
+layout(location = 3) in vec2 aUVMax;
+layout(location = 4) in vec4 aColor;
+
+layout(push_constant) uniform uPushConstant {
+    vec2 uScale;
+    vec2 uTranslate;
+} pc;
+
+out gl_PerVertex {
+    vec4 gl_Position;
+};
+
+layout(location = 0) out struct {
+    vec4 Color;
+    vec2 UV;
+} Out;
+
+// One ImDrawInstance per instance, drawn as a 4 vertices triangle strip
+void main()
+{
+    vec2 corner = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1);
+    Out.Color = aColor;
+    Out.UV = mix(aUVMin, aUVMax, corner);
+    gl_Position = vec4(mix(aPosMin, aPosMax, corner) * pc.uScale + pc.uTranslate, 0, 1);
+}
@@ -0,0 +1,114 @@
+// dear imgui: "null" example application timing compressed font loading
+// (compile and link imgui, run headless with NO INPUTS, NO GRAPHICS OUTPUT)
+// Usage: example_null_fontload [font.ttf ...]
+// Each font is compressed in memory with stb_compress() and LZ4 (same code as misc/fonts/binary_to_compressed_c.cpp),
+// then loaded repeatedly with AddFontFromMemoryCompressedTTF() and AddFontFromMemoryCompressedBase85TTF().
+// Loading uncompressed data with AddFontFromMemoryTTF() is timed as a baseline: the difference is the cost of decoding.
+#include "imgui.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+// Compressors from misc/fonts/binary_to_compressed_c.cpp
+#define BINARY_TO_COMPRESSED_C_NO_MAIN
+#include "binary_to_compressed_c.cpp"
+
+static const char* DefaultFonts[] = { "../../misc/fonts/ProggyClean.ttf", "../../misc/fonts/DroidSans.ttf", "../../misc/fonts/Roboto-Medium.ttf", "../../misc/fonts/Cousine-Regular.ttf", "../../misc/fonts/Karla-Regular.ttf" };
+
+static ImVector<char> EncodeBase85(const ImVector<char>& src)
+{
+    ImVector<char> dst;
+    ImVector<char> padded = src;
+    padded.resize((src.Size + 3) & ~3, 0);
+    for (int src_i = 0; src_i < padded.Size; src_i += 4)
+    {
+        unsigned int d = (unsigned char)padded[src_i] | ((unsigned char)padded[src_i + 1] << 8) | ((unsigned char)padded[src_i + 2] << 16) | ((unsigned int)(unsigned char)padded[src_i + 3] << 24);
+        for (int n5 = 0; n5 < 5; n5++, d /= 85)
+        {
+            unsigned int x = (d % 85) + 35;
+            dst.push_back((char)((x >= '\\') ? x + 1 : x));
+        }
+    }
+    dst.push_back(0);
+    return dst;
+}
+
+enum LoadMode { LoadMode_Raw, LoadMode_Compressed, LoadMode_Base85 };
+
+// Return average time in milliseconds
+static double TimeLoad(ImFontAtlas* atlas, LoadMode mode, const ImVector<char>& data, int iterations)
+{
+    ImFontConfig cfg;
+    cfg.FontDataOwnedByAtlas = false; // Only used by LoadMode_Raw
+    double total_ms = 0.0;
+    for (int n = 0; n < iterations; n++)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        ImFont* font = NULL;
+        if (mode == LoadMode_Raw)
+            font = atlas->AddFontFromMemoryTTF((void*)data.Data, data.Size, 13.0f, &cfg);
+        else if (mode == LoadMode_Compressed)
+            font = atlas->AddFontFromMemoryCompressedTTF(data.Data, data.Size, 13.0f);
+        else
+            font = atlas->AddFontFromMemoryCompressedBase85TTF(data.Data, 13.0f);
+        auto t1 = std::chrono::steady_clock::now();
+        if (font == NULL)
+            return -1.0;
+        atlas->RemoveFont(font);
+        if (n > 0) // Skip first call, which setups the atlas
+            total_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+    }
+    return total_ms / (iterations - 1);
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+
+    const int iterations = 200;
+    const int files_count = (argc > 1) ? argc - 1 : IM_ARRAYSIZE(DefaultFonts);
+    printf("%-36s %8s | %8s %8s | %10s %10s %10s %10s %10s\n", "", "", "stb", "lz4", "raw", "stb", "lz4", "stb+b85", "lz4+b85");
+    printf("%-36s %8s | %8s %8s | %10s %10s %10s %10s %10s\n", "File", "Size", "Size", "Size", "Load ms", "Load ms", "Load ms", "Load ms", "Load ms");
+    for (int file_n = 0; file_n < files_count; file_n++)
+    {
+        const char* filename = (argc > 1) ? argv[file_n + 1] : DefaultFonts[file_n];
+        ImVector<char> raw;
+        FILE* f = fopen(filename, "rb");
+        long file_size = -1;
+        if (f && fseek(f, 0, SEEK_END) == 0 && (file_size = ftell(f)) > 0 && fseek(f, 0, SEEK_SET) == 0)
+        {
+            raw.resize((int)file_size);
+            if (fread(raw.Data, 1, (size_t)raw.Size, f) != (size_t)raw.Size)
+                raw.clear();
+        }
+        if (f)
+            fclose(f);
+        if (raw.Size == 0)
+        {
+            fprintf(stderr, "Error opening or reading file: '%s'\n", filename);
+            continue;
+        }
+
+        // Compress (same maximum size guess as binary_to_compressed_c)
+        const int max_len = raw.Size + 512 + (raw.Size >> 2) + (int)sizeof(int);
+        ImVector<char> stb, lz4;
+        stb.resize(max_len);
+        lz4.resize(max_len);
+        stb.resize((int)stb_compress((stb_uchar*)stb.Data, (stb_uchar*)raw.Data, (stb_uint)raw.Size));
+        lz4.resize(lz4_compress((unsigned char*)lz4.Data, (const unsigned char*)raw.Data, raw.Size));
+        ImVector<char> stb_b85 = EncodeBase85(stb);
+        ImVector<char> lz4_b85 = EncodeBase85(lz4);
+
+        printf("%-36s %8d | %8d %8d | %10.4f %10.4f %10.4f %10.4f %10.4f\n", filename, raw.Size, stb.Size, lz4.Size,
+            TimeLoad(atlas, LoadMode_Raw, raw, iterations),
+            TimeLoad(atlas, LoadMode_Compressed, stb, iterations),
+            TimeLoad(atlas, LoadMode_Compressed, lz4, iterations),
+            TimeLoad(atlas, LoadMode_Base85, stb_b85, iterations),
+            TimeLoad(atlas, LoadMode_Base85, lz4_b85, iterations));
+    }
+
+    ImGui::DestroyContext();
+    return 0;
+}
@@ -0,0 +1,135 @@
+// dear imgui: "null" example application timing concave polygon triangulation
+// (compile and link imgui, create context, run headless with NO INPUTS, NO GRAPHICS OUTPUT)
+// Usage: example_null_polyfill
+// Times ImDrawList::AddConcavePolyFilled() on polygons of increasing size, with ear-clipping and with monotone decomposition
+// (selected with ImDrawListSharedData::ConcaveMonotoneMinPoints), and checks that triangles cover the polygon area.
+#include "imgui.h"
+#include "imgui_internal.h"     // ImDrawListSharedData
+#include <stdio.h>
+#include <limits.h>
+#include <math.h>
+#include <chrono>
+
+// Star with 'points_count' points (even), alternating outer and inner radius
+static void MakeStar(ImVector<ImVec2>& points, int points_count)
+{
+    points.resize(0);
+    for (int n = 0; n < points_count; n++)
+    {
+        const float a = (float)n * 2.0f * IM_PI / (float)points_count;
+        const float r = (n & 1) ? 200.0f : 500.0f;
+        points.push_back(ImVec2(600.0f + cosf(a) * r, 600.0f + sinf(a) * r));
+    }
+}
+
+// Comb with 'teeth_count' teeth pointing down: 4 * teeth_count + 2 points
+static void MakeComb(ImVector<ImVec2>& points, int teeth_count)
+{
+    points.resize(0);
+    for (int n = 0; n < teeth_count; n++)
+    {
+        const float x = (float)n * 4.0f;
+        points.push_back(ImVec2(x, 10.0f));
+        points.push_back(ImVec2(x, 100.0f));
+        points.push_back(ImVec2(x + 2.0f, 100.0f));
+        points.push_back(ImVec2(x + 2.0f, 10.0f));
+    }
+    points.push_back(ImVec2((float)teeth_count * 4.0f, 10.0f));
+    points.push_back(ImVec2((float)teeth_count * 4.0f, 0.0f));
+}
+
+// Spiral band with 10 turns: 'points_count' / 2 points on each side
+static void MakeSpiral(ImVector<ImVec2>& points, int points_count)
+{
+    points.resize(0);
+    const int side_count = points_count / 2;
+    for (int n = 0; n < side_count; n++) // Outer side
+    {
+        const float a = (float)n * 10.0f * 2.0f * IM_PI / (float)side_count;
+        points.push_back(ImVec2(600.0f + cosf(a) * (a * 4.0f + 30.0f), 600.0f + sinf(a) * (a * 4.0f + 30.0f)));
+    }
+    for (int n = side_count - 1; n >= 0; n--) // Inner side, going back
+    {
+        const float a = (float)n * 10.0f * 2.0f * IM_PI / (float)side_count;
+        points.push_back(ImVec2(600.0f + cosf(a) * (a * 4.0f + 20.0f), 600.0f + sinf(a) * (a * 4.0f + 20.0f)));
+    }
+}
+
+static double PolygonArea(const ImVector<ImVec2>& points)
+{
+    double area = 0.0;
+    for (int n = 0; n < points.Size; n++)
+    {
+        const ImVec2& a = points[n];
+        const ImVec2& b = points[(n + 1) % points.Size];
+        area += (double)a.x * b.y - (double)b.x * a.y;
+    }
+    return fabs(area) * 0.5;
+}
+
+// Return average time in milliseconds. Output relative difference between area covered by triangles and polygon area.
+static double TimeFill(ImDrawList* draw_list, const ImVector<ImVec2>& points, int monotone_min_points, double* out_area_error)
+{
+    draw_list->_Data->ConcaveMonotoneMinPoints = monotone_min_points;
+    double total_ms = 0.0;
+    int iterations = 0;
+    while (total_ms < 200.0 && iterations < 1000) // Repeat for at least 200 ms
+    {
+        draw_list->_ResetForNewFrame();
+        draw_list->PushClipRectFullScreen();
+        draw_list->Flags &= ~ImDrawListFlags_AntiAliasedFill; // Only output triangles covering the polygon
+        auto t0 = std::chrono::steady_clock::now();
+        draw_list->AddConcavePolyFilled(points.Data, points.Size, IM_COL32_WHITE);
+        auto t1 = std::chrono::steady_clock::now();
+        total_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+        iterations++;
+    }
+
+    double area = 0.0;
+    for (int idx_n = 0; idx_n + 2 < draw_list->IdxBuffer.Size; idx_n += 3)
+    {
+        const ImVec2& a = draw_list->VtxBuffer[draw_list->IdxBuffer[idx_n]].pos;
+        const ImVec2& b = draw_list->VtxBuffer[draw_list->IdxBuffer[idx_n + 1]].pos;
+        const ImVec2& c = draw_list->VtxBuffer[draw_list->IdxBuffer[idx_n + 2]].pos;
+        area += fabs(((double)b.x - a.x) * ((double)c.y - a.y) - ((double)c.x - a.x) * ((double)b.y - a.y)) * 0.5;
+    }
+    const double polygon_area = PolygonArea(points);
+    *out_area_error = fabs(area - polygon_area) / polygon_area;
+    draw_list->_Data->ConcaveMonotoneMinPoints = IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS;
+    return total_ms / iterations;
+}
+
+int main(int, char**)
+{
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset; // Allow large meshes with 16-bit indices
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame(); // Setup shared data (white pixel UV, full-screen clip rect)
+
+    {
+        ImDrawList draw_list(ImGui::GetDrawListSharedData());
+        ImVector<ImVec2> points;
+        printf("%-14s %8s | %14s %10s | %14s %10s\n", "Polygon", "Points", "Ear-clip ms", "Area err", "Monotone ms", "Area err");
+        const int star_counts[] = { 16, 64, 128, 1000, 5000, 20000 };
+        for (int shape_n = 0; shape_n < IM_ARRAYSIZE(star_counts) + 2; shape_n++)
+        {
+            const char* name;
+            if (shape_n < IM_ARRAYSIZE(star_counts))        { name = "star"; MakeStar(points, star_counts[shape_n]); }
+            else if (shape_n == IM_ARRAYSIZE(star_counts))  { name = "comb"; MakeComb(points, 1000); }
+            else                                            { name = "spiral"; MakeSpiral(points, 20000); }
+            double ear_clip_error, monotone_error;
+            const double ear_clip_ms = TimeFill(&draw_list, points, INT_MAX, &ear_clip_error);
+            const double monotone_ms = TimeFill(&draw_list, points, 3, &monotone_error);
+            printf("%-14s %8d | %14.4f %10.2g | %14.4f %10.2g\n", name, points.Size, ear_clip_ms, ear_clip_error, monotone_ms, monotone_error);
+        }
+    }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return 0;
+}
@@ -0,0 +1,170 @@
+// dear imgui: "null" remote rendering example application
+// (compile and link imgui, create context, run headless with NO INPUTS, NO GRAPHICS OUTPUT)
+// Each frame is encoded with ImDrawDataEncoder then decoded with ImDrawDataDecoder, as if sent over a network.
+// We verify that decoded draw data matches the original, and print compression ratio and encoding/decoding timings.
+// The last quarter of frames is sent with compact vertices (ImGuiBackendFlags_RendererHasCompactVtx), which are decoded with a small precision loss.
+#include "imgui.h"
+#include "imgui_remote_drawdata.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+
+static double GetTimeInMicroseconds()
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() / 1000.0;
+}
+
+// Our receiver doesn't have a GPU: pretend to honor texture requests, like a renderer backend would.
+static void FakeRendererUpdateTextures(ImVector<ImTextureData*>* textures)
+{
+    static int next_tex_id = 0;
+    for (ImTextureData* tex : *textures)
+    {
+        if (tex->Status == ImTextureStatus_WantCreate)
+        {
+            tex->SetTexID((ImTextureID)(intptr_t)++next_tex_id);
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantUpdates)
+        {
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+    }
+}
+
+static bool CompareTextures(ImTextureData* a, ImTextureData* b)
+{
+    return a->Width == b->Width && a->Height == b->Height && a->Format == b->Format && memcmp(a->Pixels, b->Pixels, (size_t)a->GetSizeInBytes()) == 0;
+}
+
+// Compact vertices are rounded to 1/IM_DRAWVERT_COMPACT_POS_SCALE pixel and 1/65535 uv
+static bool CompareVertices(const ImVector<ImDrawVert>& src, const ImVector<ImDrawVert>& dst, bool compact_vtx)
+{
+    if (src.Size != dst.Size)
+        return false;
+    if (!compact_vtx)
+        return memcmp(src.Data, dst.Data, (size_t)src.size_in_bytes()) == 0;
+    for (int vtx_n = 0; vtx_n < src.Size; vtx_n++)
+    {
+        const ImDrawVert& a = src[vtx_n];
+        const ImDrawVert& b = dst[vtx_n];
+        if (fabsf(a.pos.x - b.pos.x) > 0.5f / IM_DRAWVERT_COMPACT_POS_SCALE || fabsf(a.pos.y - b.pos.y) > 0.5f / IM_DRAWVERT_COMPACT_POS_SCALE)
+            return false;
+        if (fabsf(a.uv.x - b.uv.x) > 1.0f / 65535.0f || fabsf(a.uv.y - b.uv.y) > 1.0f / 65535.0f || a.col != b.col)
+            return false;
+    }
+    return true;
+}
+
+static bool CompareDrawData(ImDrawData* src, ImDrawData* dst, bool compact_vtx)
+{
+    if (src->CmdListsCount != dst->CmdListsCount || src->TotalVtxCount != dst->TotalVtxCount || src->TotalIdxCount != dst->TotalIdxCount)
+        return false;
+    for (int list_n = 0; list_n < src->CmdListsCount; list_n++)
+    {
+        ImDrawList* src_list = src->CmdLists[list_n];
+        ImDrawList* dst_list = dst->CmdLists[list_n];
+        if (!CompareVertices(src_list->VtxBuffer, dst_list->VtxBuffer, compact_vtx))
+            return false;
+        if (src_list->IdxBuffer.size_in_bytes() != dst_list->IdxBuffer.size_in_bytes() || memcmp(src_list->IdxBuffer.Data, dst_list->IdxBuffer.Data, (size_t)src_list->IdxBuffer.size_in_bytes()) != 0)
+            return false;
+        if (src_list->CmdBuffer.Size != dst_list->CmdBuffer.Size) // The demo doesn't use custom callbacks
+            return false;
+        for (int cmd_n = 0; cmd_n < src_list->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd& src_cmd = src_list->CmdBuffer[cmd_n];
+            const ImDrawCmd& dst_cmd = dst_list->CmdBuffer[cmd_n];
+            if (memcmp(&src_cmd.ClipRect, &dst_cmd.ClipRect, sizeof(ImVec4)) != 0 || src_cmd.VtxOffset != dst_cmd.VtxOffset || src_cmd.IdxOffset != dst_cmd.IdxOffset || src_cmd.ElemCount != dst_cmd.ElemCount)
+                return false;
+            if ((src_cmd.TexRef._TexData == NULL) != (dst_cmd.TexRef._TexData == NULL))
+                return false;
+            if (src_cmd.TexRef._TexData != NULL && !CompareTextures(src_cmd.TexRef._TexData, dst_cmd.TexRef._TexData))
+                return false;
+        }
+    }
+    return true;
+}
+
+int main(int, char**)
+{
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Advertise capabilities of the receiver's renderer backend
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset;
+
+    ImDrawDataEncoder encoder;
+    ImDrawDataDecoder decoder;
+    ImVector<unsigned char> buf;
+    const int frames_count = 200;
+    double total_full_size[2] = {}, total_encoded_size[2] = {}, total_encode_time[2] = {}, total_decode_time[2] = {}; // Regular, compact vertices
+    int stats_frames_count[2] = {};
+    int errors_count = 0;
+
+    for (int n = 0; n < frames_count; n++)
+    {
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.AddMousePosEvent(100.0f + (float)((n * 7) % 600), 100.0f + (float)((n * 3) % 500)); // Sweep mouse to cause hovering changes
+        if (n == frames_count * 3 / 4)
+            io.BackendFlags |= ImGuiBackendFlags_RendererHasCompactVtx; // Switch to compact vertices without resetting the stream
+        ImGui::NewFrame();
+
+        static float f = 0.0f;
+        ImGui::Text("Hello, world!");
+        ImGui::SliderFloat("float", &f, 0.0f, 1.0f);
+        ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
+        ImGui::ShowDemoWindow(nullptr);
+
+        ImGui::Render();
+
+        // Sender: encode. Simulate a new receiver connecting half way.
+        if (n == frames_count / 2)
+            encoder.Reset();
+        buf.resize(0);
+        double t0 = GetTimeInMicroseconds();
+        encoder.Encode(ImGui::GetDrawData(), &buf);
+        double t1 = GetTimeInMicroseconds();
+
+        // Receiver: decode, then render
+        bool ok = decoder.Decode(buf.Data, (size_t)buf.Size);
+        double t2 = GetTimeInMicroseconds();
+        FakeRendererUpdateTextures(&decoder.Textures);
+
+        const int mode = encoder.StatCompactVtx ? 1 : 0;
+        if (!ok || !CompareDrawData(ImGui::GetDrawData(), &decoder.DrawData, encoder.StatCompactVtx))
+        {
+            printf("Frame %d: ERROR: decoded draw data doesn't match!\n", n);
+            errors_count++;
+        }
+        if (n == 0)
+            continue; // Don't account for first frame, which sends textures
+        total_full_size[mode] += encoder.StatFullSize;
+        total_encoded_size[mode] += encoder.StatEncodedSize;
+        total_encode_time[mode] += t1 - t0;
+        total_decode_time[mode] += t2 - t1;
+        stats_frames_count[mode]++;
+    }
+
+    printf("%d frames, %d errors\n", frames_count, errors_count);
+    for (int mode = 0; mode < 2; mode++)
+    {
+        if (stats_frames_count[mode] == 0)
+            continue;
+        const double count = (double)stats_frames_count[mode];
+        printf("%s vertices (%d frames):\n", mode ? "Compact" : "Regular", stats_frames_count[mode]);
+        printf("  Average full size: %.0f bytes, encoded size: %.0f bytes (ratio %.1f:1)\n", total_full_size[mode] / count, total_encoded_size[mode] / count, total_full_size[mode] / total_encoded_size[mode]);
+        printf("  Average encode: %.1f us, decode: %.1f us\n", total_encode_time[mode] / count, total_decode_time[mode] / count);
+    }
+
+    printf("DestroyContext()\n");
+    ImGui::DestroyContext();
+    return errors_count > 0 ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+// dear imgui: "null" example application using the CPU software rasterizer
+// (compile and link imgui, create context, run headless with NO INPUTS, render into a framebuffer in memory)
+// Usage: example_null_softraster [output.ppm]
+// The last frame is written as a binary PPM image, which can be used e.g. for screenshot comparisons.
+// It then checks that a table replaying rows with ImGuiTableFlags_CacheRows renders the same pixels as one submitting
+// all rows, while scrolling by fractions of a row. The exit code is non-zero on mismatch.
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+// Submit a scrolling table, replaying unchanged rows from cache when 'cache_rows' is set.
+// Some rows change version over time, so cached and recorded rows are mixed.
+static void ShowScrollingTable(const char* str_id, bool cache_rows, float scroll_y, int frame)
+{
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(640.0f, 360.0f));
+    ImGui::Begin("Table", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+    ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | (cache_rows ? ImGuiTableFlags_CacheRows : 0);
+    if (ImGui::BeginTable(str_id, 3, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Index", ImGuiTableColumnFlags_WidthFixed, 60.0f);
+        ImGui::TableSetupColumn("Status", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+        ImGui::TableSetupColumn("Message");
+        ImGui::TableHeadersRow();
+        ImGui::SetScrollY(scroll_y);
+        ImGuiListClipper clipper;
+        clipper.Begin(500);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                const int version = (row % 7 == 0) ? frame / 3 : 0;
+                if (!ImGui::TableNextRowCached((ImGuiID)row, version))
+                    continue;
+                ImGui::TableNextColumn();
+                ImGui::Text("%04d", row);
+                ImGui::TableNextColumn();
+                if (row % 5 == 0)
+                    ImGui::SmallButton("Retry");
+                else
+                    ImGui::TextUnformatted("OK");
+                ImGui::TableNextColumn();
+                ImGui::Text("Message %d, version %d", row, version);
+                if (row % 3 == 0)
+                    ImGui::TextDisabled("Second line of message %d", row);
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Render a few frames of both tables while scrolling by fractions of a row, and compare their pixels.
+// Returns the number of frames which didn't match.
+static int CompareCachedTableRendering(ImVector<ImU32>& framebuffer, int fb_width, int fb_height)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImVector<ImU32> reference;
+    int mismatch_count = 0;
+    const int frames_count = 120;
+    for (int n = 0; n < frames_count; n++)
+    {
+        const float scroll_y = n * ImGui::GetTextLineHeightWithSpacing() * 0.37f;
+        for (int cache_rows = 0; cache_rows < 2; cache_rows++)
+        {
+            io.DisplaySize = ImVec2((float)fb_width, (float)fb_height);
+            io.DeltaTime = 1.0f / 60.0f;
+            ImGui_ImplSoftRaster_NewFrame();
+            ImGui::NewFrame();
+            ShowScrollingTable(cache_rows ? "cached" : "uncached", cache_rows != 0, scroll_y, n);
+            ImGui::Render();
+            for (ImU32& pixel : framebuffer)
+                pixel = 0;
+            ImGui_ImplSoftRaster_RenderDrawData(ImGui::GetDrawData(), framebuffer.Data, fb_width, fb_height, fb_width * (int)sizeof(ImU32));
+            if (cache_rows == 0)
+                reference = framebuffer;
+            else if (memcmp(reference.Data, framebuffer.Data, (size_t)framebuffer.size_in_bytes()) != 0)
+                mismatch_count++;
+        }
+    }
+    printf("Table row cache: %d/%d frames mismatching\n", mismatch_count, frames_count);
+    return mismatch_count;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;   // Make output reproducible
+
+    // Setup Platform/Renderer backends
+    ImGui_ImplSoftRaster_Init();
+
+    // Our framebuffer
+    const int fb_width = 1280;
+    const int fb_height = 800;
+    ImVector<ImU32> framebuffer;
+    framebuffer.resize(fb_width * fb_height);
+    const ImU32 clear_color = IM_COL32(115, 140, 153, 255);
+
+    const int frames_count = 60;
+    double total_render_time = 0.0;
+    for (int n = 0; n < frames_count; n++)
+    {
+        io.DisplaySize = ImVec2((float)fb_width, (float)fb_height);
+        io.DeltaTime = 1.0f / 60.0f;
+        ImGui_ImplSoftRaster_NewFrame();
+        ImGui::NewFrame();
+
+        static float f = 0.0f;
+        ImGui::Text("Hello, world!");
+        ImGui::SliderFloat("float", &f, 0.0f, 1.0f);
+        ImGui::ShowDemoWindow(nullptr);
+
+        // Rendering
+        ImGui::Render();
+        auto t0 = std::chrono::steady_clock::now();
+        for (ImU32& pixel : framebuffer)
+            pixel = clear_color;
+        ImGui_ImplSoftRaster_RenderDrawData(ImGui::GetDrawData(), framebuffer.Data, fb_width, fb_height, fb_width * (int)sizeof(ImU32));
+        auto t1 = std::chrono::steady_clock::now();
+        if (n > 0) // Skip first frame, which creates textures
+            total_render_time += std::chrono::duration<double, std::milli>(t1 - t0).count();
+    }
+    printf("%d frames, average render time %.3f ms\n", frames_count, total_render_time / (frames_count - 1));
+
+    // Save last frame
+    const char* filename = (argc > 1) ? argv[1] : "imgui_softraster.ppm";
+    if (FILE* f = fopen(filename, "wb"))
+    {
+        fprintf(f, "P6\n%d %d\n255\n", fb_width, fb_height);
+        for (ImU32 pixel : framebuffer)
+        {
+            const unsigned char rgb[3] = { (unsigned char)(pixel >> IM_COL32_R_SHIFT), (unsigned char)(pixel >> IM_COL32_G_SHIFT), (unsigned char)(pixel >> IM_COL32_B_SHIFT) };
+            fwrite(rgb, 1, 3, f);
+        }
+        fclose(f);
+        printf("Saved '%s'\n", filename);
+    }
+
+    const int table_mismatch_count = CompareCachedTableRendering(framebuffer, fb_width, fb_height);
+
+    // Cleanup
+    ImGui_ImplSoftRaster_Shutdown();
+    ImGui::DestroyContext();
+    return (table_mismatch_count == 0) ? 0 : 1;
+}
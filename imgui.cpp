@@ -74,6 +74,7 @@ CODE
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
 // [SECTION] ImGuiListClipper
+// [SECTION] ImGuiListClipperHeights
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
 // [SECTION] INITIALIZATION, SHUTDOWN
@@ -1538,6 +1539,7 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigDrawListCpuClipRects = false;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugHighlightIdConflictsShowItemPicker = true;
@@ -2114,11 +2116,50 @@ const char* ImStrbol(const char* buf_mid_line, const char* buf_begin) // find be
     return buf_mid_line;
 }
 
+#ifdef IMGUI_ENABLE_SSE
+// Convert 'a'-'z' to 'A'-'Z' in 16 characters, like ImToUpper(). Other characters (including >= 0x80) are unchanged.
+static inline __m128i ImToUpperSSE(__m128i v)
+{
+    const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+    return _mm_sub_epi8(v, _mm_and_si128(is_lower, _mm_set1_epi8(32)));
+}
+#endif
+
 const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
 {
     if (!needle_end)
         needle_end = needle + ImStrlen(needle);
 
+#ifdef IMGUI_ENABLE_SSE
+    // Test 16 positions at a time: compare first and last characters of needle, then only compare the rest on candidates.
+    // Remaining positions are handled by the loop below.
+    const int needle_len = (int)(needle_end - needle);
+    if (needle_len > 0)
+    {
+        if (!haystack_end)
+            haystack_end = haystack + ImStrlen(haystack);
+        const __m128i needle_first = _mm_set1_epi8(ImToUpper(needle[0]));
+        const __m128i needle_last = _mm_set1_epi8(ImToUpper(needle_end[-1]));
+        for (; haystack_end - haystack >= 16 + needle_len - 1; haystack += 16)
+        {
+            const __m128i block_first = ImToUpperSSE(_mm_loadu_si128((const __m128i*)(const void*)haystack));
+            const __m128i block_last = ImToUpperSSE(_mm_loadu_si128((const __m128i*)(const void*)(haystack + needle_len - 1)));
+            unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, needle_first), _mm_cmpeq_epi8(block_last, needle_last)));
+            for (int n = 0; mask != 0; n++, mask >>= 1)
+            {
+                if ((mask & 1) == 0)
+                    continue;
+                const char* b = needle + 1;
+                for (const char* a = haystack + n + 1; b < needle_end - 1; a++, b++)
+                    if (ImToUpper(*a) != ImToUpper(*b))
+                        break;
+                if (b >= needle_end - 1)
+                    return haystack + n;
+            }
+        }
+    }
+#endif
+
     const char un0 = (char)ImToUpper(*needle);
     while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
     {
@@ -2126,7 +2167,7 @@ const char* ImStristr(const char* haystack, const char* haystack_end, const char
         {
             const char* b = needle + 1;
             for (const char* a = haystack + 1; b < needle_end; a++, b++)
-                if (ImToUpper(*a) != ImToUpper(*b))
+                if (a == haystack_end || ImToUpper(*a) != ImToUpper(*b))
                     break;
             if (b == needle_end)
                 return haystack;
@@ -2982,6 +3023,158 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+// How results of an old filter may be reused for a new filter
+enum ImGuiTextFilterChange
+{
+    ImGuiTextFilterChange_None,         // Same results
+    ImGuiTextFilterChange_Narrowed,     // Items failing old filter fail new filter: only test items passing old filter
+    ImGuiTextFilterChange_Widened,      // Items passing old filter pass new filter: only test items failing old filter
+    ImGuiTextFilterChange_Any,          // Test all items
+};
+
+// We only handle changes of the last term, or adding/removing a last term, which covers typing in the filter box.
+// Note that PassFilter() evaluates terms in order, and that without any grep term everything passes.
+static ImGuiTextFilterChange TextFilterGetChange(const ImGuiTextFilter& old_filter, const ImGuiTextFilter& new_filter)
+{
+    ImVector<ImGuiTextFilter::ImGuiTextRange> old_terms, new_terms;
+    for (const ImGuiTextFilter::ImGuiTextRange& f : old_filter.Filters)
+        if (!f.empty())
+            old_terms.push_back(f);
+    for (const ImGuiTextFilter::ImGuiTextRange& f : new_filter.Filters)
+        if (!f.empty())
+            new_terms.push_back(f);
+    const int common_count = ImMin(old_terms.Size, new_terms.Size);
+    if (ImAbs(old_terms.Size - new_terms.Size) > 1)
+        return ImGuiTextFilterChange_Any;
+    for (int n = 0; n < common_count; n++)
+    {
+        const ImGuiTextFilter::ImGuiTextRange& old_term = old_terms[n];
+        const ImGuiTextFilter::ImGuiTextRange& new_term = new_terms[n];
+        if (old_term.e - old_term.b == new_term.e - new_term.b && memcmp(old_term.b, new_term.b, (size_t)(old_term.e - old_term.b)) == 0)
+            continue;
+        if (n + 1 != old_terms.Size || n + 1 != new_terms.Size)
+            return ImGuiTextFilterChange_Any;
+
+        // Last term changed: only handle when one is a prefix of the other
+        const bool exclude = (old_term.b[0] == '-');
+        if (exclude != (new_term.b[0] == '-') || (exclude && (old_term.e - old_term.b == 1 || new_term.e - new_term.b == 1)))
+            return ImGuiTextFilterChange_Any;
+        const ImGuiTextFilter::ImGuiTextRange& shorter = (old_term.e - old_term.b < new_term.e - new_term.b) ? old_term : new_term;
+        const ImGuiTextFilter::ImGuiTextRange& longer = (&shorter == &old_term) ? new_term : old_term;
+        if (memcmp(shorter.b, longer.b, (size_t)(shorter.e - shorter.b)) != 0)
+            return ImGuiTextFilterChange_Any;
+        const bool longer_needle = (&longer == &new_term);  // A longer needle matches less items
+        return (longer_needle != exclude) ? ImGuiTextFilterChange_Narrowed : ImGuiTextFilterChange_Widened;
+    }
+    if (old_terms.Size == new_terms.Size)
+        return ImGuiTextFilterChange_None;
+
+    // Last term added or removed
+    const bool added = (new_terms.Size > old_terms.Size);
+    const ImGuiTextFilter::ImGuiTextRange& term = added ? new_terms.back() : old_terms.back();
+    if (term.b[0] == '-')
+        return (term.e - term.b == 1) ? ImGuiTextFilterChange_Any : added ? ImGuiTextFilterChange_Narrowed : ImGuiTextFilterChange_Widened;
+    if ((added ? old_filter.CountGrep : new_filter.CountGrep) == 0)
+        return ImGuiTextFilterChange_Any;
+    return added ? ImGuiTextFilterChange_Widened : ImGuiTextFilterChange_Narrowed;
+}
+
+bool ImGuiTextFilter::PassFilterBatch(ImGuiTextFilterResults* results, int items_count, const char* (*get_item)(void* user_data, int idx, const char** out_text_end), void* user_data) const
+{
+    IM_ASSERT(items_count >= 0);
+    if (items_count < results->ItemsCount)
+        results->Clear();
+
+    // Items [0, old_count) have valid results for results->FilterBuf. Last item is always tested again.
+    ImGuiTextFilterChange change = ImGuiTextFilterChange_None;
+    if (strcmp(results->FilterBuf, InputBuf) != 0)
+    {
+        change = TextFilterGetChange(ImGuiTextFilter(results->FilterBuf), *this);
+        const size_t len = ImMin(ImStrlen(InputBuf), sizeof(results->FilterBuf) - 1);
+        memcpy(results->FilterBuf, InputBuf, len);
+        results->FilterBuf[len] = 0;
+    }
+    const int old_count = ImMax(results->ItemsCount - 1, 0);
+    bool changed = (items_count != results->ItemsCount);
+    results->Bits.resize((items_count + 31) >> 5, 0);
+    results->ItemsCount = items_count;
+
+    for (int word_n = (change == ImGuiTextFilterChange_None) ? (old_count >> 5) : 0; word_n < results->Bits.Size; word_n++)
+    {
+        const int item_base = word_n << 5;
+        const ImU32 word = results->Bits[word_n];
+        ImU32 test_mask = (change == ImGuiTextFilterChange_None) ? 0 : (change == ImGuiTextFilterChange_Narrowed) ? word : (change == ImGuiTextFilterChange_Widened) ? ~word : ~(ImU32)0;
+        if (item_base + 32 > old_count)
+        {
+            const ImU32 old_mask = (old_count > item_base) ? ((ImU32)1 << (old_count - item_base)) - 1 : 0;
+            test_mask = (test_mask & old_mask) | ~old_mask;
+            if (item_base + 32 > items_count)
+                test_mask &= ((ImU32)1 << (items_count - item_base)) - 1;
+        }
+        if (test_mask == 0)
+            continue;
+        ImU32 new_word = word & ~test_mask;
+        for (int bit_n = 0; test_mask != 0; bit_n++, test_mask >>= 1)
+        {
+            if ((test_mask & 1) == 0)
+                continue;
+            const char* text_end = NULL;
+            const char* text = get_item(user_data, item_base + bit_n, &text_end);
+            if (PassFilter(text, text_end))
+                new_word |= (ImU32)1 << bit_n;
+        }
+        if (new_word == word)
+            continue;
+        results->PassCount += (int)ImCountSetBits(new_word) - (int)ImCountSetBits(word);
+        results->Bits[word_n] = new_word;
+        changed = true;
+    }
+    return changed;
+}
+
+static const char* TextFilterGetArrayItem(void* user_data, int idx, const char** out_text_end)
+{
+    *out_text_end = NULL;
+    return ((const char* const*)user_data)[idx];
+}
+
+bool ImGuiTextFilter::PassFilterBatch(ImGuiTextFilterResults* results, const char* const items[], int items_count) const
+{
+    return PassFilterBatch(results, items_count, TextFilterGetArrayItem, (void*)items);
+}
+
+struct ImGuiTextFilterLines
+{
+    const char* Buf;
+    const int*  LineOffsets;
+    int         LinesCount;
+    int         BufSize;
+};
+
+static const char* TextFilterGetLine(void* user_data, int idx, const char** out_text_end)
+{
+    ImGuiTextFilterLines* lines = (ImGuiTextFilterLines*)user_data;
+    *out_text_end = lines->Buf + ((idx + 1 < lines->LinesCount) ? lines->LineOffsets[idx + 1] - 1 : lines->BufSize);
+    return lines->Buf + lines->LineOffsets[idx];
+}
+
+bool ImGuiTextFilter::PassFilterBatch(ImGuiTextFilterResults* results, const char* buf, const int* line_offsets, int lines_count, int buf_size) const
+{
+    ImGuiTextFilterLines lines = { buf, line_offsets, lines_count, buf_size };
+    return PassFilterBatch(results, lines_count, TextFilterGetLine, &lines);
+}
+
+void ImGuiTextFilterResults::GetIndices(ImVector<int>* out_indices) const
+{
+    out_indices->resize(PassCount);
+    int* p = out_indices->Data;
+    for (int word_n = 0; word_n < Bits.Size; word_n++)
+        for (ImU32 word = Bits[word_n], bit_n = 0; word != 0; word >>= 1, bit_n++)
+            if (word & 1)
+                *p++ = (word_n << 5) + (int)bit_n;
+    IM_ASSERT(p == out_indices->Data + out_indices->Size);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
 //-----------------------------------------------------------------------------
@@ -3101,7 +3294,8 @@ static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>&
     }
 }
 
-static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height)
+// row_increase: number of items skipped, -1 to infer it from distance and line_height
+static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height, int row_increase = -1)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
     // FIXME: It is problematic that we have to do that here, because custom/equivalent end-user code would stumble on the same issue.
@@ -3120,7 +3314,8 @@ static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_
         if (table->IsInsideRow)
             ImGui::TableEndRow(table);
         table->RowPosY2 = window->DC.CursorPos.y;
-        const int row_increase = (int)((off_y / line_height) + 0.5f);
+        if (row_increase < 0)
+            row_increase = (int)((off_y / line_height) + 0.5f);
         //table->CurrentRow += row_increase; // Can't do without fixing TableEndRow()
         table->RowBgColorCounter += row_increase;
     }
@@ -3152,6 +3347,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartPosY = window->DC.CursorPos.y;
     ItemsHeight = items_height;
     ItemsCount = items_count;
+    VariableHeights = NULL;
     DisplayStart = -1;
     DisplayEnd = 0;
 
@@ -3165,6 +3361,22 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartSeekOffsetY = data->LossynessOffset;
 }
 
+// Items heights are read from and measured into 'heights', which needs to persist across frames.
+// We resize it if 'items_count' changed: if you insert/remove items in the middle of your list, you may want to Clear() it.
+void ImGuiListClipper::BeginVariableHeight(int items_count, ImGuiListClipperHeights* heights)
+{
+    IM_ASSERT(heights != NULL);
+    IM_ASSERT(items_count >= 0 && items_count < INT_MAX && "Variable height mode requires knowing items count.");
+    if (Ctx == NULL)
+        Ctx = ImGui::GetCurrentContext();
+    if (heights->EstimatedHeight <= 0.0f)
+        heights->EstimatedHeight = Ctx->FontSize + Ctx->Style.ItemSpacing.y; // Same as GetTextLineHeightWithSpacing()
+    if (heights->GetItemsCount() != items_count)
+        heights->Resize(items_count);
+    Begin(items_count, heights->EstimatedHeight);
+    VariableHeights = heights;
+}
+
 void ImGuiListClipper::End()
 {
     if (ImGuiListClipperData* data = (ImGuiListClipperData*)TempData)
@@ -3201,6 +3413,18 @@ void ImGuiListClipper::IncludeItemsByIndex(int item_begin, int item_end)
 // The ONLY reason you may want to call this is if you passed INT_MAX to ImGuiListClipper::Begin() because you couldn't step item count beforehand.
 void ImGuiListClipper::SeekCursorForItem(int item_n)
 {
+    if (VariableHeights != NULL)
+    {
+        // Variable height mode: we know which item the cursor is on, which is required to keep table row background colors alternating.
+        ImGuiListClipperData* data = (ImGuiListClipperData*)TempData;
+        float pos_y = (float)((double)StartPosY + StartSeekOffsetY + VariableHeights->GetOffset(item_n));
+        const int row_increase = data ? item_n - data->CursorItem : 0;
+        if (data)
+            data->CursorItem = item_n;
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, (item_n > 0) ? VariableHeights->GetHeight(item_n - 1) : ItemsHeight, row_increase);
+        return;
+    }
+
     // - Perform the add and multiply with double to allow seeking through larger ranges.
     // - StartPosY starts from ItemsFrozen, by adding SeekOffsetY we generally cancel that out (SeekOffsetY == LossynessOffset - ItemsFrozen * ItemsHeight).
     // - The reason we store SeekOffsetY instead of inferring it, is because we want to allow user to perform Seek after the last step, where ImGuiListClipperData is already done.
@@ -3208,6 +3432,15 @@ void ImGuiListClipper::SeekCursorForItem(int item_n)
     ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, ItemsHeight);
 }
 
+// Variable height mode: record item to measure on next step
+static void ImGuiListClipper_VariableHeightSetupItem(ImGuiListClipper* clipper, ImGuiListClipperData* data)
+{
+    ImGuiWindow* window = clipper->Ctx->CurrentWindow;
+    data->CursorItem = clipper->DisplayEnd;
+    data->MeasureItem = (clipper->DisplayEnd - clipper->DisplayStart == 1) ? clipper->DisplayStart : -1;
+    data->MeasurePosY = window->DC.CursorPos.y;
+}
+
 static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
 {
     ImGuiContext& g = *clipper->Ctx;
@@ -3219,6 +3452,15 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (table && table->IsInsideRow)
         ImGui::TableEndRow(table);
 
+    // Variable height mode: measure item submitted since last step
+    ImGuiListClipperHeights* heights = clipper->VariableHeights;
+    if (heights != NULL && data->MeasureItem >= 0)
+    {
+        if (!ImIsFloatAboveGuaranteedIntegerPrecision(window->DC.CursorPos.y))
+            heights->SetHeight(data->MeasureItem, ImMax(window->DC.CursorPos.y - data->MeasurePosY, 0.0f));
+        data->MeasureItem = -1;
+    }
+
     // No items
     if (clipper->ItemsCount == 0 || GetSkipItemForListClipping())
         return false;
@@ -3231,6 +3473,8 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         clipper->DisplayEnd = ImMin(data->ItemsFrozen + 1, clipper->ItemsCount);
         if (clipper->DisplayStart < clipper->DisplayEnd)
             data->ItemsFrozen++;
+        if (heights != NULL)
+            ImGuiListClipper_VariableHeightSetupItem(clipper, data);
         return true;
     }
 
@@ -3248,6 +3492,12 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
             data->StepNo = 1;
             return true;
         }
+        if (heights != NULL)
+        {
+            // Variable height mode: as we may stay on a same range for multiple steps, use an empty range to mark that step 0 is done.
+            data->Ranges.push_front(ImGuiListClipperRange::FromIndices(data->ItemsFrozen, data->ItemsFrozen));
+            data->StepNo = 1;
+        }
         calc_clipping = true;   // If on the first step with known item height, calculate clipping.
     }
 
@@ -3280,7 +3530,7 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (calc_clipping)
     {
         // Record seek offset, this is so ImGuiListClipper::Seek() can be called after ImGuiListClipperData is done
-        clipper->StartSeekOffsetY = (double)data->LossynessOffset - data->ItemsFrozen * (double)clipper->ItemsHeight;
+        clipper->StartSeekOffsetY = (double)data->LossynessOffset - (heights ? heights->GetOffset(data->ItemsFrozen) : data->ItemsFrozen * (double)clipper->ItemsHeight);
 
         if (g.LogEnabled)
         {
@@ -3332,11 +3582,22 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         // - Very important: when a starting position is after our maximum item, we set Min to (ItemsCount - 1). This allows us to handle most forms of wrapping.
         // - Due to how Selectable extra padding they tend to be "unaligned" with exact unit in the item list,
         //   which with the flooring/ceiling tend to lead to 2 items instead of one being submitted.
+        // - In variable height mode, we lookup items by offset in O(log N).
+        const double already_submitted_offset = heights ? heights->GetOffset(already_submitted) : 0.0;
         for (ImGuiListClipperRange& range : data->Ranges)
             if (range.PosToIndexConvert)
             {
-                int m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
-                int m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                int m1, m2;
+                if (heights != NULL)
+                {
+                    m1 = heights->FindItemAtOffset(already_submitted_offset + ((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset)) - already_submitted;
+                    m2 = heights->FindItemAtOffset(already_submitted_offset + ((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset)) + 1 - already_submitted;
+                }
+                else
+                {
+                    m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
+                    m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                }
                 range.Min = ImClamp(already_submitted + m1 + range.PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
                 range.Max = ImClamp(already_submitted + m2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
                 range.PosToIndexConvert = false;
@@ -3345,15 +3606,30 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     }
 
     // Step 0+ (if item height is given in advance) or 1+: Display the next range in line.
+    // In variable height mode, we display items one by one so we can measure them.
     while (data->StepNo < data->Ranges.Size)
     {
         clipper->DisplayStart = ImMax(data->Ranges[data->StepNo].Min, already_submitted);
         clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
-        data->StepNo++;
+        if (heights != NULL && clipper->DisplayEnd - clipper->DisplayStart > 1)
+            clipper->DisplayEnd = clipper->DisplayStart + 1; // Stay on same range
+        else
+            data->StepNo++;
         if (clipper->DisplayStart >= clipper->DisplayEnd)
             continue;
         if (clipper->DisplayStart > already_submitted)
             clipper->SeekCursorForItem(clipper->DisplayStart);
+        if (heights != NULL)
+            ImGuiListClipper_VariableHeightSetupItem(clipper, data);
+        return true;
+    }
+
+    // Variable height mode: keep displaying items while they are visible, as measured heights may be smaller than estimated ones.
+    if (heights != NULL && already_submitted < clipper->ItemsCount && window->DC.CursorPos.y < window->ClipRect.Max.y && !g.LogEnabled)
+    {
+        clipper->DisplayStart = already_submitted;
+        clipper->DisplayEnd = already_submitted + 1;
+        ImGuiListClipper_VariableHeightSetupItem(clipper, data);
         return true;
     }
 
@@ -3388,6 +3664,85 @@ bool ImGuiListClipper::Step()
     return ret;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiListClipperHeights
+//-----------------------------------------------------------------------------
+// Fenwick tree (binary indexed tree): using 1-based indices, node i stores the sum of heights of items in range (i - (i & -i), i].
+// - Prefix sums are obtained by walking down (i -= i & -i), updates by walking up (i += i & -i).
+// - Finding the item at a given offset is a binary descent from the highest power of two.
+// We use doubles so that sums stay accurate with millions of items.
+//-----------------------------------------------------------------------------
+
+void ImGuiListClipperHeights::Clear()
+{
+    Tree.clear();
+}
+
+// O(N): convert tree back to individual heights, resize, then rebuild tree.
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    const int old_count = Tree.Size;
+    if (items_count == old_count)
+        return;
+    for (int i = old_count; i > 0; i--)
+        if (i + (i & -i) <= old_count)
+            Tree.Data[i + (i & -i) - 1] -= Tree.Data[i - 1];
+    Tree.resize(items_count);
+    for (int i = old_count; i < items_count; i++)
+        Tree.Data[i] = (double)EstimatedHeight;
+    for (int i = 1; i <= items_count; i++)
+        if (i + (i & -i) <= items_count)
+            Tree.Data[i + (i & -i) - 1] += Tree.Data[i - 1];
+}
+
+void ImGuiListClipperHeights::SetHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < Tree.Size);
+    const double delta = (double)height - (double)GetHeight(item_n);
+    if (delta == 0.0)
+        return;
+    for (int i = item_n + 1; i <= Tree.Size; i += i & -i)
+        Tree.Data[i - 1] += delta;
+}
+
+float ImGuiListClipperHeights::GetHeight(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n < Tree.Size);
+    // Node item_n+1 covers (item_n + 1 - lowbit, item_n + 1]: subtract its children to isolate the single item.
+    const int i = item_n + 1;
+    double height = Tree.Data[i - 1];
+    for (int child = i - 1, stop = i - (i & -i); child > stop; child -= child & -child)
+        height -= Tree.Data[child - 1];
+    return (float)height;
+}
+
+double ImGuiListClipperHeights::GetOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= Tree.Size);
+    double offset = 0.0;
+    for (int i = item_n; i > 0; i -= i & -i)
+        offset += Tree.Data[i - 1];
+    return offset;
+}
+
+int ImGuiListClipperHeights::FindItemAtOffset(double offset) const
+{
+    if (Tree.Size == 0)
+        return 0;
+    int step = 1;
+    while (step * 2 <= Tree.Size)
+        step *= 2;
+    int pos = 0; // Number of items fully before 'offset'
+    for (; step > 0; step >>= 1)
+        if (pos + step <= Tree.Size && Tree.Data[pos + step - 1] <= offset)
+        {
+            pos += step;
+            offset -= Tree.Data[pos - 1];
+        }
+    return ImMin(pos, Tree.Size - 1);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -3727,9 +4082,7 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 
 // Default clip_rect uses (pos_min,pos_max)
 // Handle clipping on CPU immediately (vs typically let the GPU clip the triangles that are overlapping the clipping rectangle edges)
-// FIXME-OPT: Since we have or calculate text_size we could coarse clip whole block immediately, especially for text above draw_list->DrawList.
-// Effectively as this is called from widget doing their own coarse clipping it's not very valuable presently. Next time function will take
-// better advantage of the render function taking size into account for coarse clipping.
+// Since we have or calculate text_size we coarse clip whole block immediately (counted in ImDrawList::_CulledTextCount), unless ImDrawListFlags_NoCoarseCulling is set.
 void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_display_end, const ImVec2* text_size_if_known, const ImVec2& align, const ImRect* clip_rect)
 {
     // Perform CPU side clipping for single clipped element to avoid using scissor state
@@ -3746,6 +4099,18 @@ void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, co
     if (align.x > 0.0f) pos.x = ImMax(pos.x, pos.x + (pos_max.x - pos.x - text_size.x) * align.x);
     if (align.y > 0.0f) pos.y = ImMax(pos.y, pos.y + (pos_max.y - pos.y - text_size.y) * align.y);
 
+    // Coarse clip whole block against draw list clipping rectangle and our clipping rectangle.
+    // Pad by font size as glyphs may overhang their advance (e.g. italic fonts).
+    ImVec4 coarse_clip_rect = draw_list->_CmdHeader.ClipRect;
+    if (need_clipping)
+        coarse_clip_rect = ImVec4(ImMax(coarse_clip_rect.x, clip_min->x), ImMax(coarse_clip_rect.y, clip_min->y), ImMin(coarse_clip_rect.z, clip_max->x), ImMin(coarse_clip_rect.w, clip_max->y));
+    const float pad = draw_list->_Data->FontSize;
+    if ((pos.x + text_size.x + pad < coarse_clip_rect.x || pos.y + text_size.y + pad < coarse_clip_rect.y || pos.x - pad > coarse_clip_rect.z || pos.y - pad > coarse_clip_rect.w) && !(draw_list->Flags & ImDrawListFlags_NoCoarseCulling))
+    {
+        draw_list->_CulledTextCount++;
+        return;
+    }
+
     // Render
     if (need_clipping)
     {
@@ -4200,6 +4565,9 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     DebugItemPickerMouseButton = ImGuiMouseButton_Left;
     DebugItemPickerBreakId = 0;
     DebugFlashStyleColorTime = 0.0f;
+    DebugDrawCallsCount = 0;
+    DebugDrawCallsBatchedCount = -1;
+    DebugCulledPrimsCount = DebugCulledTextCount = 0;
     DebugFlashStyleColorIdx = ImGuiCol_COUNT;
 
     // Same as DebugBreakClearData(). Those fields are scattered in their respective subsystem to stay in hot-data locations
@@ -4288,6 +4656,7 @@ void ImGui::Shutdown()
         }
     }
     g.DrawListSharedData.TempBuffer.clear();
+    g.DrawListSharedData.CurveCache.Clear();
 
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
     if (!g.Initialized)
@@ -4341,6 +4710,7 @@ void ImGui::Shutdown()
     g.InputTextDeactivatedState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsMap.Clear();
     g.SettingsHandlers.clear();
 
     if (g.LogFile)
@@ -4889,7 +5259,8 @@ void* ImGui::MemAlloc(size_t size)
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ImGuiContext* ctx = GImGui)
-        DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+        if (!ctx->DebugAllocInfo.SkipHook)
+            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
 #endif
     return ptr;
 }
@@ -4900,7 +5271,8 @@ void ImGui::MemFree(void* ptr)
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ptr != NULL)
         if (ImGuiContext* ctx = GImGui)
-            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
+            if (!ctx->DebugAllocInfo.SkipHook)
+                DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
 #endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
@@ -5311,7 +5683,12 @@ static void SetupDrawListSharedData()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasInstances)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowInstances;
+    if (g.IO.ConfigDrawListCpuClipRects)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_CpuClipRects;
     g.DrawListSharedData.InitialFringeScale = 1.0f; // FIXME-DPI: Change this for some DPI scaling experiments.
+    g.DrawListSharedData.CurveCache.NewFrame();
 }
 
 void ImGui::NewFrame()
@@ -5663,7 +6040,14 @@ static void InitViewportDrawData(ImGuiViewportP* viewport)
 
     draw_data->Valid = true;
     draw_data->CmdListsCount = 0;
-    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = draw_data->TotalInstCount = 0;
+    draw_data->MergedVtxBuffer.resize(0);
+    draw_data->MergedIdxBuffer.resize(0);
+    draw_data->MergedInstBuffer.resize(0);
+    draw_data->MergedCmdBuffer.resize(0);
+    draw_data->MergedCmdParentLists.resize(0);
+    draw_data->MergedIdxRebases.resize(0);
+    draw_data->CompactVtxBuffer.resize(0);
     draw_data->DisplayPos = viewport->Pos;
     draw_data->DisplaySize = viewport->Size;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
@@ -5712,7 +6096,7 @@ static void ImGui::RenderDimmedBackgroundBehindWindow(ImGuiWindow* window, ImU32
         draw_list->PushClipRect(viewport_rect.Min - ImVec2(1, 1), viewport_rect.Max + ImVec2(1, 1), false); // FIXME: Need to stricty ensure ImDrawCmd are not merged (ElemCount==6 checks below will verify that)
         draw_list->AddRectFilled(viewport_rect.Min, viewport_rect.Max, col);
         ImDrawCmd cmd = draw_list->CmdBuffer.back();
-        IM_ASSERT(cmd.ElemCount == 6);
+        IM_ASSERT((cmd.ElemCount == 6 && cmd.InstCount == 0) || (cmd.ElemCount == 0 && cmd.InstCount == 1));
         draw_list->CmdBuffer.pop_back();
         draw_list->CmdBuffer.push_front(cmd);
         draw_list->AddDrawCmd(); // We need to create a command as CmdBuffer.back().IdxOffset won't be correct if we append to same command.
@@ -5926,6 +6310,9 @@ void ImGui::Render()
 
     // Setup ImDrawData structures for end-user
     g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = 0;
+    g.DebugDrawCallsCount = 0;
+    g.DebugDrawCallsBatchedCount = (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasBatchedDrawCmds) ? 0 : -1;
+    g.DebugCulledPrimsCount = g.DebugCulledTextCount = 0;
     for (ImGuiViewportP* viewport : g.Viewports)
     {
         FlattenDrawDataIntoSingleLayer(&viewport->DrawDataBuilder);
@@ -5939,9 +6326,25 @@ void ImGui::Render()
         IM_ASSERT(draw_data->CmdLists.Size == draw_data->CmdListsCount);
         for (ImDrawList* draw_list : draw_data->CmdLists)
             draw_list->_PopUnusedDrawCmd();
+        if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasBatchedDrawCmds)
+            draw_data->BatchDrawCmds();
+        if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasCompactVtx)
+            draw_data->BuildCompactVtxBuffer();
 
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
+
+        // Number of draw calls before/after batching and of coarse culled primitives, for Metrics window
+        for (ImDrawList* draw_list : draw_data->CmdLists)
+        {
+            for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+                g.DebugDrawCallsCount += (cmd.UserCallback == NULL && (cmd.ElemCount > 0 || cmd.InstCount > 0)) ? 1 : 0;
+            g.DebugCulledPrimsCount += draw_list->_CulledPrimsCount;
+            g.DebugCulledTextCount += draw_list->_CulledTextCount;
+        }
+        if (g.DebugDrawCallsBatchedCount >= 0)
+            for (const ImDrawCmd& cmd : draw_data->MergedCmdBuffer)
+                g.DebugDrawCallsBatchedCount += (cmd.UserCallback == NULL) ? 1 : 0;
     }
 
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
@@ -7725,7 +8128,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         // DRAWING
 
         // Setup draw list and outer clipping rectangle
-        IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0);
+        IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0 && window->DrawList->CmdBuffer[0].InstCount == 0);
         window->DrawList->PushTexture(g.Font->ContainerAtlas->TexRef);
         PushClipRect(host_rect.Min, host_rect.Max, false);
 
@@ -7740,8 +8143,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
                 // - We disable this when the parent window has zero vertices, which is a common pattern leading to laying out multiple overlapping childs
                 ImGuiWindow* previous_child = parent_window->DC.ChildWindows.Size >= 2 ? parent_window->DC.ChildWindows[parent_window->DC.ChildWindows.Size - 2] : NULL;
                 bool previous_child_overlapping = previous_child ? previous_child->Rect().Overlaps(window->Rect()) : false;
-                bool parent_is_empty = (parent_window->DrawList->VtxBuffer.Size == 0);
-                if (window->DrawList->CmdBuffer.back().ElemCount == 0 && !parent_is_empty && !previous_child_overlapping)
+                bool parent_is_empty = (parent_window->DrawList->VtxBuffer.Size == 0 && parent_window->DrawList->InstBuffer.Size == 0);
+                if (window->DrawList->CmdBuffer.back().ElemCount == 0 && window->DrawList->CmdBuffer.back().InstCount == 0 && !parent_is_empty && !previous_child_overlapping)
                     render_decorations_in_parent = true;
             }
             if (render_decorations_in_parent)
@@ -15180,18 +15583,23 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
+    g.SettingsWindowsMap.SetInt(settings->ID, g.SettingsWindows.offset_from_ptr(settings));
 
     return settings;
 }
 
 // We don't provide a FindWindowSettingsByName() because Docking system doesn't always hold on names.
 // This is called once per window .ini entry + once per newly instantiated window.
+// The map holds the most recently created entry for an ID. Entries whose ID was since changed or which are marked for deletion are not returned.
 ImGuiWindowSettings* ImGui::FindWindowSettingsByID(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
-        if (settings->ID == id && !settings->WantDelete)
-            return settings;
+    const int offset = g.SettingsWindowsMap.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiWindowSettings* settings = g.SettingsWindows.ptr_from_offset(offset);
+    if (settings->ID == id && !settings->WantDelete)
+        return settings;
     return NULL;
 }
 
@@ -15224,16 +15632,20 @@ static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandl
     for (ImGuiWindow* window : g.Windows)
         window->SettingsOffset = -1;
     g.SettingsWindows.clear();
+    g.SettingsWindowsMap.Clear();
 }
 
-static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+static void* WindowSettingsHandler_ReadOpen(ImGuiContext* ctx, ImGuiSettingsHandler*, const char* name)
 {
+    ImGuiContext& g = *ctx;
     ImGuiID id = ImHashStr(name);
     ImGuiWindowSettings* settings = ImGui::FindWindowSettingsByID(id);
     if (settings)
         *settings = ImGuiWindowSettings(); // Clear existing if recycling previous entry
     else
         settings = ImGui::CreateNewWindowSettings(name);
+    if (settings->ID != id)
+        g.SettingsWindowsMap.SetInt(id, g.SettingsWindows.offset_from_ptr(settings));
     settings->ID = id;
     settings->WantApply = true;
     return (void*)settings;
@@ -16070,6 +16482,11 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     }
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
+    if (g.DebugDrawCallsBatchedCount >= 0)
+        Text("%d draw calls, %d after batching", g.DebugDrawCallsCount, g.DebugDrawCallsBatchedCount);
+    else
+        Text("%d draw calls (batching disabled)", g.DebugDrawCallsCount);
+    Text("%d primitives, %d text blocks coarse culled", g.DebugCulledPrimsCount, g.DebugCulledTextCount);
     Text("%d visible windows, %d current allocations", io.MetricsRenderWindows, g.DebugAllocInfo.TotalAllocCount - g.DebugAllocInfo.TotalFreeCount);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
@@ -16703,9 +17120,13 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
     IM_UNUSED(viewport); // Used in docking branch
     ImGuiMetricsConfig* cfg = &g.DebugMetricsConfig;
     int cmd_count = draw_list->CmdBuffer.Size;
-    if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
+    if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().InstCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
-    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
+    bool node_open;
+    if (draw_list->InstBuffer.Size > 0)
+        node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d instances, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->InstBuffer.Size, cmd_count);
+    else
+        node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
     if (draw_list == GetWindowDrawList())
     {
         SameLine();
@@ -16735,14 +17156,37 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         char texid_desc[30];
         FormatTextureIDForDebugDisplay(texid_desc, IM_ARRAYSIZE(texid_desc), pcmd);
         char buf[300];
-        ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d tris, Tex %s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
-            pcmd->ElemCount / 3, texid_desc, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+        if (pcmd->InstCount > 0)
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d inst, Tex %s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
+                pcmd->InstCount, texid_desc, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+        else
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d tris, Tex %s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
+                pcmd->ElemCount / 3, texid_desc, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
         bool pcmd_node_open = TreeNode((void*)(pcmd - draw_list->CmdBuffer.begin()), "%s", buf);
         if (IsItemHovered() && (cfg->ShowDrawCmdMesh || cfg->ShowDrawCmdBoundingBoxes) && fg_draw_list)
             DebugNodeDrawCmdShowMeshAndBoundingBox(fg_draw_list, draw_list, pcmd, cfg->ShowDrawCmdMesh, cfg->ShowDrawCmdBoundingBoxes);
         if (!pcmd_node_open)
             continue;
 
+        // Display individual instances. Hover on to get the corresponding rectangle highlighted.
+        if (pcmd->InstCount > 0)
+        {
+            ImGuiListClipper clipper;
+            clipper.Begin((int)pcmd->InstCount);
+            while (clipper.Step())
+                for (int inst_i = pcmd->InstOffset + clipper.DisplayStart; inst_i < (int)pcmd->InstOffset + clipper.DisplayEnd; inst_i++)
+                {
+                    const ImDrawInstance& inst = draw_list->InstBuffer[inst_i];
+                    ImFormatString(buf, IM_ARRAYSIZE(buf), "Inst: %04d: pos (%8.2f,%8.2f)-(%8.2f,%8.2f), uv (%.6f,%.6f)-(%.6f,%.6f), col %08X",
+                        inst_i, inst.pos_min.x, inst.pos_min.y, inst.pos_max.x, inst.pos_max.y, inst.uv_min.x, inst.uv_min.y, inst.uv_max.x, inst.uv_max.y, inst.col);
+                    Selectable(buf, false);
+                    if (fg_draw_list && IsItemHovered())
+                        fg_draw_list->AddRect(inst.pos_min, inst.pos_max, IM_COL32(255, 255, 0, 255));
+                }
+            TreePop();
+            continue;
+        }
+
         // Calculate approximate coverage area (touched pixel count)
         // This will be in pixels squared as long there's no post-scaling happening to the renderer output.
         const ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
@@ -16813,6 +17257,13 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
+    for (unsigned int inst_n = draw_cmd->InstOffset, inst_end = draw_cmd->InstOffset + draw_cmd->InstCount; inst_n < inst_end; inst_n++)
+    {
+        const ImDrawInstance inst = draw_list->InstBuffer.Data[inst_n]; // Copy as AddRect() may invalidate pointers if out_draw_list==draw_list
+        vtxs_rect.Add(ImRect(inst.pos_min, inst.pos_max));
+        if (show_mesh)
+            out_draw_list->AddRect(inst.pos_min, inst.pos_max, IM_COL32(255, 255, 0, 255)); // In yellow: instance rectangles
+    }
     // Draw bounding boxes
     if (show_aabb)
     {
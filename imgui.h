@@ -165,10 +165,12 @@ typedef unsigned long long  ImU64;  // 64-bit unsigned integer
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
+struct ImDrawInstance;              // A single axis-aligned textured rectangle (pos_min + pos_max + uv_min + uv_max + col = 36 bytes), only used with ImGuiBackendFlags_RendererHasInstances
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVertCompact;           // A single vertex in a compact format (16-bit fixed-point pos + 16-bit normalized uv + col = 12 bytes), only used with ImGuiBackendFlags_RendererHasCompactVtx
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontAtlasBuilder;          // Opaque storage for building a ImFontAtlas
@@ -188,6 +190,7 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store heights of variable height items for ImGuiListClipper
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
@@ -204,6 +207,7 @@ struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTextFilterResults;      // Helper to store results of filtering many items with a ImGuiTextFilter
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
 
 // Enumerations
@@ -884,12 +888,19 @@ namespace ImGui
     //        - TableNextRow() -> TableNextColumn()      -> Text("Hello 0") -> TableNextColumn()      -> Text("Hello 1")  // OK
     //        -                   TableNextColumn()      -> Text("Hello 0") -> TableNextColumn()      -> Text("Hello 1")  // OK: TableNextColumn() automatically gets to next row!
     //        - TableNextRow()                           -> Text("Hello 0")                                               // Not OK! Missing TableSetColumnIndex() or TableNextColumn()! Text will not appear!
+    //    - For very wide tables (e.g. thousands of columns), use TableNextRow() + while (TableNextVisibleColumn()) { ... } to only submit visible cells.
+    //      Columns which are not submitted don't contribute to row height, and auto-fitting columns will still be requested for a few frames.
+    //    - For large tables of static contents (e.g. logs), use ImGuiTableFlags_CacheRows + 'if (TableNextRowCached(row_id, row_version)) { submit row }'.
+    //      Unchanged rows are replayed from the vertices they output previously, offset to their new position. Change 'row_version' whenever contents
+    //      or style of the row changes. Replayed rows don't submit any item: use this for non-interactive contents only (e.g. Text, TextColored, TableSetBgColor).
     // - 5. Call EndTable()
     IMGUI_API bool          BeginTable(const char* str_id, int columns, ImGuiTableFlags flags = 0, const ImVec2& outer_size = ImVec2(0.0f, 0.0f), float inner_width = 0.0f);
     IMGUI_API void          EndTable();                                         // only call EndTable() if BeginTable() returns true!
     IMGUI_API void          TableNextRow(ImGuiTableRowFlags row_flags = 0, float min_row_height = 0.0f); // append into the first cell of a new row.
     IMGUI_API bool          TableNextColumn();                                  // append into the next column (or first column of next row if currently in last column). Return true when column is visible.
     IMGUI_API bool          TableSetColumnIndex(int column_n);                  // append into the specified column. Return true when column is visible.
+    IMGUI_API bool          TableNextVisibleColumn();                           // [BETA] append into the next column which is visible in the current row, skipping others. Return false when there are none left (doesn't wrap-around into next row).
+    IMGUI_API bool          TableNextRowCached(ImGuiID row_id, int row_version, ImGuiTableRowFlags row_flags = 0, float min_row_height = 0.0f); // [BETA] with ImGuiTableFlags_CacheRows: append into a new row. Return false when contents of row 'row_id' with same 'row_version' were replayed from cache: don't submit them!
 
     // Tables: Headers & Columns declaration
     // - Use TableSetupColumn() to specify label, resizing policy, default width/weight, id, various other flags etc.
@@ -1257,7 +1268,9 @@ enum ImGuiInputTextFlags_
     ImGuiInputTextFlags_CallbackAlways      = 1 << 20,  // Callback on each iteration. User code may query cursor position, modify text buffer.
     ImGuiInputTextFlags_CallbackCharFilter  = 1 << 21,  // Callback on character inputs to replace or discard them. Modify 'EventChar' to replace or discard, or return 1 in callback to discard.
     ImGuiInputTextFlags_CallbackResize      = 1 << 22,  // Callback on buffer capacity changes request (beyond 'buf_size' parameter value), allowing the string to grow. Notify when the string wants to be resized (for string types which hold a cache of their Size). You will be provided a new BufSize in the callback and NEED to honor it. (see misc/cpp/imgui_stdlib.h for an example of using this)
-    ImGuiInputTextFlags_CallbackEdit        = 1 << 23,  // Callback on any edit. Note that InputText() already returns true on edit + you can always use IsItemEdited(). The callback is useful to manipulate the underlying buffer while focus is active.
+    ImGuiInputTextFlags_CallbackEdit        = 1 << 23,  // Callback on any edit. Note that InputText() already returns true on edit + you can always use IsItemEdited(). The callback is useful to manipulate the underlying buffer while focus is active. EditPos/EditOldLen/EditNewLen tell which range was modified.
+    ImGuiInputTextFlags_NoLiveEdit          = 1 << 24,  // Only write to your buffer when deactivating (or validating/reverting), instead of comparing+copying the whole text every frame while active. Use with CallbackEdit to keep your own storage (e.g. a rope) up to date. Useful for very large text.
+    ImGuiInputTextFlags_ChunkedText         = 1 << 25,  // [BETA] InputTextMultiline() only: store text in chunks while active, so an edit only moves text within its chunk instead of the whole text after it. Implies ImGuiInputTextFlags_NoLiveEdit. In callbacks, Buf is NULL: read text with GetTextSpan(), edit it with InsertChars()/DeleteChars().
 
     // Obsolete names
     //ImGuiInputTextFlags_AlwaysInsertMode  = ImGuiInputTextFlags_AlwaysOverwrite   // [renamed in 1.82] name was not matching behavior
@@ -1692,6 +1705,9 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
     ImGuiBackendFlags_RendererHasTextures   = 1 << 4,   // Backend Renderer supports ImTextureData requests to create/update/destroy textures. This enables incremental texture updates and texture reloads. See https://github.com/ocornut/imgui/blob/master/docs/BACKENDS.md for instructions on how to upgrade your custom backend.
+    ImGuiBackendFlags_RendererHasBatchedDrawCmds = 1 << 5, // [ALPHA] Backend Renderer supports ImDrawData::MergedCmdBuffer. Render() will merge compatible draw commands of consecutive draw lists, reducing the number of draw calls. Upload buffers with WriteMergedBuffers() (or MergeBuffers()) to render them.
+    ImGuiBackendFlags_RendererHasInstances  = 1 << 6,   // [ALPHA] Backend Renderer supports ImDrawCmd::InstCount/InstOffset and ImDrawList::InstBuffer. Filled rectangles, images and glyphs are output as one ImDrawInstance each instead of 4 vertices + 6 indices. Instanced and triangle commands can't be merged, so runs of fewer than IM_DRAWLIST_INSTANCES_MIN_RUN instances are converted back to triangles. Demo window + 20 text windows: 43 draw calls / 144 KB vertex data without, 101 calls / 72 KB when always instancing, 48 calls / 84 KB with the default run length of 16.
+    ImGuiBackendFlags_RendererHasCompactVtx = 1 << 7,   // [ALPHA] Backend Renderer supports ImDrawData::CompactVtxBuffer. Render() will convert all vertices to 12 bytes ImDrawVertCompact when they fit, reducing upload size by 40%. Vertices more than 4096 units away from the center of the viewport don't fit (e.g. large high-DPI framebuffers): the buffer is left empty and the backend renders regular vertices that frame.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2023,6 +2039,7 @@ enum ImGuiTableFlags_
     ImGuiTableFlags_SortTristate               = 1 << 27,  // Allow no sorting, disable default sorting. TableGetSortSpecs() may return specs where (SpecsCount == 0).
     // Miscellaneous
     ImGuiTableFlags_HighlightHoveredColumn     = 1 << 28,  // Highlight column headers when hovered (may evolve into a fuller highlight)
+    ImGuiTableFlags_CacheRows                  = 1 << 29,  // [BETA] Allow TableNextRowCached() to replay the output of unchanged rows instead of requiring their contents to be submitted again. Uses memory for vertices of recently displayed rows.
 
     // [Internal] Combinations and masks
     ImGuiTableFlags_SizingMask_                = ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_SizingFixedSame | ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_SizingStretchSame,
@@ -2380,6 +2397,7 @@ struct ImGuiIO
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigDrawListCpuClipRects;     // = false          // [ALPHA] Clip rectangles, images and text on CPU so that nested clip rects (e.g. table cells) don't split draw calls. Trades a little CPU for fewer draw calls and scissor changes. Sets ImDrawListFlags_CpuClipRects.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2591,6 +2609,8 @@ struct ImGuiInputTextCallbackData
     // - However, during Completion/History/Always callback, Buf always points to our own internal data (it is not the same as your buffer)! Changes to it will be reflected into your own buffer shortly after the callback.
     // - To modify the text buffer in a callback, prefer using the InsertChars() / DeleteChars() function. InsertChars() will take care of calling the resize callback if necessary.
     // - If you know your edits are not going to resize the underlying buffer allocation, you may modify the contents of 'Buf[]' directly. You need to update 'BufTextLen' accordingly (0 <= BufTextLen < BufSize) and set 'BufDirty'' to true so InputText can update its internal state.
+    // - Modifying 'Buf[]' directly is not undoable when text is larger than IMGUI_INPUTTEXT_UNDO_MAX_BYTES (default 4 MB): prefer InsertChars() / DeleteChars().
+    // - With ImGuiInputTextFlags_ChunkedText, 'Buf' is NULL (text is not contiguous): use GetTextSpan() to read text, InsertChars() / DeleteChars() to modify it.
     ImWchar             EventChar;      // Character input                      // Read-write   // [CharFilter] Replace character with another one, or set to zero to drop. return 1 is equivalent to setting EventChar=0;
     ImGuiKey            EventKey;       // Key pressed (Up/Down/TAB)            // Read-only    // [Completion,History]
     char*               Buf;            // Text buffer                          // Read-write   // [Resize] Can replace pointer / [Completion,History,Always] Only write to pointed data, don't replace the actual pointer!
@@ -2600,12 +2620,16 @@ struct ImGuiInputTextCallbackData
     int                 CursorPos;      //                                      // Read-write   // [Completion,History,Always]
     int                 SelectionStart; //                                      // Read-write   // [Completion,History,Always] == to SelectionEnd when no selection)
     int                 SelectionEnd;   //                                      // Read-write   // [Completion,History,Always]
+    int                 EditPos;        // Start of modified range              // Read-only    // [Edit] Since activation or previous Edit event: 'EditOldLen' bytes at EditPos of previous text were replaced by Buf[EditPos] .. Buf[EditPos + EditNewLen].
+    int                 EditOldLen;     // Length of modified range (before)    // Read-only    // [Edit] Includes changes made by other callbacks, excludes changes made by this callback.
+    int                 EditNewLen;     // Length of modified range (after)     // Read-only    // [Edit] e.g. my_rope.erase(EditPos, EditOldLen); my_rope.insert(EditPos, Buf + EditPos, EditNewLen);
 
     // Helper functions for text manipulation.
     // Use those function to benefit from the CallbackResize behaviors. Calling those function reset the selection.
     IMGUI_API ImGuiInputTextCallbackData();
     IMGUI_API void      DeleteChars(int pos, int bytes_count);
     IMGUI_API void      InsertChars(int pos, const char* text, const char* text_end = NULL);
+    IMGUI_API const char* GetTextSpan(int pos, int* out_len) const; // Return text at 'pos' and number of contiguous bytes from there (== BufTextLen - pos unless using ImGuiInputTextFlags_ChunkedText). Doesn't copy.
     void                SelectAll()             { SelectionStart = 0; SelectionEnd = BufTextLen; }
     void                ClearSelection()        { SelectionStart = SelectionEnd = BufTextLen; }
     bool                HasSelection() const    { return SelectionStart != SelectionEnd; }
@@ -2671,6 +2695,16 @@ struct ImGuiTextFilter
     IMGUI_API bool      Draw(const char* label = "Filter (inc,-exc)", float width = 0.0f);  // Helper calling InputText+Build
     IMGUI_API bool      PassFilter(const char* text, const char* text_end = NULL) const;
     IMGUI_API void      Build();
+
+    // Filter many items at once, storing results in a bitset. Return true if results changed. [BETA]
+    // - Call every frame: only items which may have changed are tested. When filter was extended/shortened (e.g. user typing),
+    //   only items previously passing (or failing) are tested again. When items_count increased, new items are tested.
+    // - The last item is always tested again, so you can append to it (e.g. incomplete last line of a log).
+    // - Call results->Clear() if your items changed in any other way.
+    // - Use results->Pass(n) or results->GetIndices() (e.g. to use with ImGuiListClipper).
+    IMGUI_API bool      PassFilterBatch(ImGuiTextFilterResults* results, int items_count, const char* (*get_item)(void* user_data, int idx, const char** out_text_end), void* user_data) const;
+    IMGUI_API bool      PassFilterBatch(ImGuiTextFilterResults* results, const char* const items[], int items_count) const;                  // Array of zero-terminated strings
+    IMGUI_API bool      PassFilterBatch(ImGuiTextFilterResults* results, const char* buf, const int* line_offsets, int lines_count, int buf_size) const; // Lines of a text buffer, line_offsets[n] = offset of line n (same layout as ImGuiTextIndex)
     void                Clear()          { InputBuf[0] = 0; Build(); }
     bool                IsActive() const { return !Filters.empty(); }
 
@@ -2690,6 +2724,20 @@ struct ImGuiTextFilter
     int                     CountGrep;
 };
 
+// Helper: Results of ImGuiTextFilter::PassFilterBatch()
+struct ImGuiTextFilterResults
+{
+    ImVector<ImU32>     Bits;               // 1 bit per item
+    int                 ItemsCount;         // Number of items tested
+    int                 PassCount;          // Number of items passing the filter
+    char                FilterBuf[256];     // Copy of ImGuiTextFilter::InputBuf used to compute results
+
+    ImGuiTextFilterResults()        { Clear(); }
+    void                Clear()     { Bits.clear(); ItemsCount = PassCount = 0; FilterBuf[0] = 0; }
+    bool                Pass(int n) const { IM_ASSERT(n >= 0 && n < ItemsCount); return (Bits[n >> 5] & ((ImU32)1 << (n & 31))) != 0; }
+    IMGUI_API void      GetIndices(ImVector<int>* out_indices) const;  // Output indices of items passing the filter
+};
+
 // Helper: Growable text buffer for logging/accumulating text
 // (this could be called 'ImGuiTextBuilder' / 'ImGuiStringBuilder')
 struct ImGuiTextBuffer
@@ -2787,6 +2835,7 @@ struct ImGuiStorage
 // - Clipper calculate the actual range of elements to display based on the current clipping rectangle, position the cursor before the first visible element.
 // - User code submit visible elements.
 // - The clipper also handles various subtleties related to keyboard/gamepad navigation, wrapping etc.
+// If your items have different heights (e.g. wrapped text, expandable rows), use BeginVariableHeight() with a persistent ImGuiListClipperHeights instance.
 struct ImGuiListClipper
 {
     ImGuiContext*   Ctx;                // Parent UI context
@@ -2797,12 +2846,14 @@ struct ImGuiListClipper
     double          StartPosY;          // [Internal] Cursor position at the time of Begin() or after table frozen rows are all processed
     double          StartSeekOffsetY;   // [Internal] Account for frozen rows in a table and initial loss of precision in very large windows.
     void*           TempData;           // [Internal] Internal data
+    ImGuiListClipperHeights* VariableHeights; // [Internal] Heights storage when using BeginVariableHeight()
 
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step, and you can call SeekCursorForItem() manually if you need)
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  BeginVariableHeight(int items_count, ImGuiListClipperHeights* heights); // [BETA] Items of different heights. 'heights' needs to persist across frames. Steps display one item at a time so each can be measured.
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2823,6 +2874,35 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Heights of variable height items, for ImGuiListClipper::BeginVariableHeight() [BETA]
+// Stored as a Fenwick tree (binary indexed tree) of doubles, so that with N items:
+// - Setting the height of an item, getting the offset of an item and finding the item at a given offset are O(log N).
+// - Total height and scrollbar size stay correct with millions of items (as long as your heights are correct!).
+// Heights may be set by you (e.g. if you can compute them from your data), and are measured by the clipper when items are displayed.
+// Items which have never been set nor displayed use EstimatedHeight. Prefer a good estimate as the scrollbar will adjust while items are measured.
+// Usage:
+//   static ImGuiListClipperHeights heights;   // Persistent
+//   ImGuiListClipper clipper;
+//   clipper.BeginVariableHeight(items_count, &heights);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           ImGui::TextWrapped("%s", items[i]);
+struct ImGuiListClipperHeights
+{
+    ImVector<double>    Tree;               // [Internal] Fenwick tree of items heights. Tree[i - 1] stores sum of heights of items in range (i - (i & -i), i].
+    float               EstimatedHeight;    // Height of items which haven't been set nor measured yet. If <= 0.0f, BeginVariableHeight() sets it to GetTextLineHeightWithSpacing().
+
+    ImGuiListClipperHeights()               { EstimatedHeight = -1.0f; }
+    inline int          GetItemsCount() const { return Tree.Size; }
+    inline double       GetTotalHeight() const { return GetOffset(Tree.Size); }
+    IMGUI_API void      Clear();                                // Clear all heights (set them to EstimatedHeight on next resize)
+    IMGUI_API void      Resize(int items_count);                // Add or remove items at the end. New items use EstimatedHeight. O(N).
+    IMGUI_API void      SetHeight(int item_n, float height);    // O(log N)
+    IMGUI_API float     GetHeight(int item_n) const;            // O(log N)
+    IMGUI_API double    GetOffset(int item_n) const;            // Sum of heights of items [0, item_n). O(log N)
+    IMGUI_API int       FindItemAtOffset(double offset) const;  // Item containing 'offset' (clamped to valid items). O(log N)
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -3090,6 +3170,8 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
 //   Backends made for <1.71. will typically ignore the VtxOffset fields.
+// - InstOffset/InstCount: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasInstances' is enabled, a command may instead
+//   render InstCount rectangles from the parent ImDrawList's InstBuffer[]. A command has either ElemCount > 0 or InstCount > 0, never both.
 // - The ClipRect/TexRef/VtxOffset fields must be contiguous as we memcmp() them together (this is asserted for).
 struct ImDrawCmd
 {
@@ -3102,6 +3184,8 @@ struct ImDrawCmd
     void*           UserCallbackData;   // 4-8  // Callback user data (when UserCallback != NULL). If called AddCallback() with size == 0, this is a copy of the AddCallback() argument. If called AddCallback() with size > 0, this is pointing to a buffer where data is stored.
     int             UserCallbackDataSize;  // 4 // Size of callback user data when using storage, otherwise 0.
     int             UserCallbackDataOffset;// 4 // [Internal] Offset of callback user data when using storage, otherwise -1.
+    unsigned int    InstOffset;         // 4    // Start offset in instance buffer.
+    unsigned int    InstCount;          // 4    // Number of ImDrawInstance to be rendered, each as an axis-aligned quad. Always 0 unless ImGuiBackendFlags_RendererHasInstances is enabled.
 
     ImDrawCmd()     { memset(this, 0, sizeof(*this)); } // Also ensure our padding fields are zeroed
 
@@ -3126,6 +3210,37 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// Instance layout (when ImGuiBackendFlags_RendererHasInstances is enabled)
+// An axis-aligned rectangle, to be expanded into 4 vertices by the renderer (generally in its vertex shader):
+// (pos_min, uv_min) (pos_max.x, pos_min.y, uv_max.x, uv_min.y) (pos_max, uv_max) (pos_min.x, pos_max.y, uv_min.x, uv_max.y), all with color 'col'.
+// 36 bytes, instead of 4 vertices + 6 indices = 92 bytes with the default ImDrawVert layout and 16-bit indices.
+struct ImDrawInstance
+{
+    ImVec2  pos_min;
+    ImVec2  pos_max;
+    ImVec2  uv_min;
+    ImVec2  uv_max;
+    ImU32   col;
+};
+
+// Compact vertex layout (when ImGuiBackendFlags_RendererHasCompactVtx is enabled)
+// Converted from ImDrawVert by ImDrawData::BuildCompactVtxBuffer(), draw lists are still built with ImDrawVert.
+// - pos: fixed-point, relative to ImDrawData::CompactVtxOrigin, in 1/IM_DRAWVERT_COMPACT_POS_SCALE pixel units (so +/- 4096 pixels around the origin).
+//   The renderer can fold the 'origin + pos / IM_DRAWVERT_COMPACT_POS_SCALE' transform into its projection matrix.
+//   Units are those of ImDrawVert::pos (before FramebufferScale). Viewports larger than 8192 units, e.g. a large high-DPI framebuffer with DisplaySize in pixels,
+//   won't fit and fall back to full-size ImDrawVert on every frame: '#define IM_DRAWVERT_COMPACT_POS_SCALE 4.0f' extends the range to +/- 8192 at 1/4th pixel precision.
+// - uv: normalized, 0..65535 maps to 0.0f..1.0f.
+// 12 bytes, instead of 20 bytes with the default ImDrawVert layout.
+#ifndef IM_DRAWVERT_COMPACT_POS_SCALE
+#define IM_DRAWVERT_COMPACT_POS_SCALE   8.0f
+#endif
+struct ImDrawVertCompact
+{
+    ImS16   pos[2];
+    ImU16   uv[2];
+    ImU32   col;
+};
+
 // [Internal] For use by ImDrawList
 struct ImDrawCmdHeader
 {
@@ -3139,6 +3254,7 @@ struct ImDrawChannel
 {
     ImVector<ImDrawCmd>         _CmdBuffer;
     ImVector<ImDrawIdx>         _IdxBuffer;
+    ImVector<ImDrawInstance>    _InstBuffer;
 };
 
 // Split/Merge functions are used to split the draw list into different layers which can be drawn into out of order.
@@ -3187,6 +3303,10 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_CacheCurves             = 1 << 4,  // [ALPHA] Reuse auto-tessellated PathBezierXXXCurveTo() points from previous frames when control points (relative to first one) and CurveTessellationTol are unchanged. Set manually e.g. on window draw list. Helps e.g. node editors drawing many static wires.
+    ImDrawListFlags_AllowInstances          = 1 << 5,  // [ALPHA] Can emit 'InstCount > 0' commands for non-rounded AddRectFilled(), AddImage() and text. Set when 'ImGuiBackendFlags_RendererHasInstances' is enabled. Clear temporarily if you need to post-process vertices (e.g. ShadeVertsXXX functions).
+    ImDrawListFlags_CpuClipRects            = 1 << 6,  // [ALPHA] Clip non-rounded AddRectFilled(), AddImage() and text on CPU, so pushing a clip rect contained in current command's one doesn't create a new draw command. Other primitives create one when needed. Set when 'io.ConfigDrawListCpuClipRects' is enabled. If you clear it temporarily (e.g. to post-process vertices), call _OnChangedClipRect() right after clearing it.
+    ImDrawListFlags_NoCoarseCulling         = 1 << 7,  // Disable coarse culling of Add*() primitives and text blocks which are fully outside of the current clipping rectangle. Set it if you transform vertex positions after adding them (e.g. ShadeVertsTransformPos() to rotate, or scaling), otherwise primitives which would be moved inside the clipping rectangle are missing.
 };
 
 // Draw command list
@@ -3197,13 +3317,14 @@ enum ImDrawListFlags_
 // You can interleave normal ImGui:: calls and adding primitives to the current draw list.
 // In single viewport mode, top-left is == GetMainViewport()->Pos (generally 0,0), bottom-right is == GetMainViewport()->Pos+Size (generally io.DisplaySize).
 // You are totally free to apply whatever transformation matrix you want to the data (depending on the use of the transformation you may want to apply it to ClipRect as well!)
-// Important: Primitives are always added to the list and not culled (culling is done at higher-level by ImGui:: functions), if you use this API a lot consider coarse culling your drawn objects.
+// Important: Add*() primitives and text fully outside of the current clipping rectangle are skipped (coarse culling, see ImDrawListFlags_NoCoarseCulling), but Path/Poly functions are always added. If you use this API a lot consider coarse culling your drawn objects at a higher level.
 struct ImDrawList
 {
     // This is what you have to render
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    ImVector<ImDrawInstance> InstBuffer;        // Instance buffer. Each command consume ImDrawCmd::InstCount of those. Only used with ImDrawListFlags_AllowInstances.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
     // [Internal, used while building lists]
@@ -3219,6 +3340,8 @@ struct ImDrawList
     ImVector<ImU8>          _CallbacksDataBuf;  // [Internal]
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
+    int                     _CulledPrimsCount;  // [Internal] Number of Add*() calls skipped by coarse culling since last reset (displayed in Metrics window)
+    int                     _CulledTextCount;   // [Internal] Number of AddText()/RenderTextClipped() calls skipped by coarse culling since last reset
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData().
     // (advanced: you may create and use your own ImDrawListSharedData so you can use ImDrawList without ImGui, but that's more involved)
@@ -3326,6 +3449,9 @@ struct ImDrawList
     inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
+    IMGUI_API ImDrawInstance* PrimReserveInstances(int inst_count);             // [ALPHA] Requires ImDrawListFlags_AllowInstances. Returns pointer to 'inst_count' instances to write.
+    IMGUI_API void  PrimUnreserveInstances(int inst_count);
+    IMGUI_API void  PrimInstance(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a, const ImVec2& uv_c, ImU32 col); // [ALPHA] Requires ImDrawListFlags_AllowInstances. Same output as PrimReserve(6, 4) + PrimRectUV().
 
     // Obsolete names
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
@@ -3344,6 +3470,7 @@ struct ImDrawList
     IMGUI_API void  _ClearFreeMemory();
     IMGUI_API void  _PopUnusedDrawCmd();
     IMGUI_API void  _TryMergeDrawCmds();
+    IMGUI_API void  _TryFlattenInstances();
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTexture();
     IMGUI_API void  _OnChangedVtxOffset();
@@ -3362,17 +3489,30 @@ struct ImDrawData
     int                 CmdListsCount;      // Number of ImDrawList* to render. (== CmdLists.Size). Exists for legacy reason.
     int                 TotalIdxCount;      // For convenience, sum of all ImDrawList's IdxBuffer.Size
     int                 TotalVtxCount;      // For convenience, sum of all ImDrawList's VtxBuffer.Size
+    int                 TotalInstCount;     // For convenience, sum of all ImDrawList's InstBuffer.Size
     ImVector<ImDrawList*> CmdLists;         // Array of ImDrawList* to render. The ImDrawLists are owned by ImGuiContext and only pointed to from here.
     ImVec2              DisplayPos;         // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
     ImVec2              DisplaySize;        // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
     ImVec2              FramebufferScale;   // Amount of pixels for each unit of DisplaySize. Copied from viewport->FramebufferScale (== io.DisplayFramebufferScale for main viewport). Generally (1,1) on normal display, (2,2) on OSX with Retina display.
     ImGuiViewport*      OwnerViewport;      // Viewport carrying the ImDrawData instance, might be of use to the renderer (generally not).
     ImVector<ImTextureData*>* Textures;     // List of textures to update. Most of the times the list is shared by all ImDrawData, has only 1 texture and it doesn't need any update. This almost always points to ImGui::GetPlatformIO().Textures[]. May be overriden or set to NULL if you want to manually update textures.
+    ImVector<ImDrawVert> MergedVtxBuffer;   // All CmdLists[]'s VtxBuffer concatenated in order. Only filled by calling MergeBuffers(), never by Render(). Size == TotalVtxCount when valid.
+    ImVector<ImDrawIdx> MergedIdxBuffer;    // All CmdLists[]'s IdxBuffer concatenated in order. Indices are NOT rebased (except ranges listed in MergedIdxRebases[]): draw with ImDrawCmd::VtxOffset + (sum of previous lists' VtxBuffer.Size) as base vertex, as backends already do with global_vtx_offset/global_idx_offset.
+    ImVector<ImDrawInstance> MergedInstBuffer; // All CmdLists[]'s InstBuffer concatenated in order. Filled along with MergedVtxBuffer/MergedIdxBuffer. Draw with ImDrawCmd::InstOffset + (sum of previous lists' InstBuffer.Size).
+    ImVector<ImDrawCmd> MergedCmdBuffer;    // [ALPHA] Only filled by Render() when io.BackendFlags has ImGuiBackendFlags_RendererHasBatchedDrawCmds, or by calling BatchDrawCmds(). Draw commands of all CmdLists[], batched together when possible. VtxOffset/IdxOffset/InstOffset are relative to all CmdLists[] buffers concatenated in order, as written by MergeBuffers() or WriteMergedBuffers(). When non-empty, render this instead of CmdLists[]->CmdBuffer.
+    ImVector<ImDrawList*> MergedCmdParentLists; // [ALPHA] Parent draw list of each MergedCmdBuffer[] entry, to pass to ImDrawCmd::UserCallback.
+    ImVector<unsigned int> MergedIdxRebases;   // [ALPHA] Filled by BatchDrawCmds(): (IdxOffset, ElemCount, VtxRebase) triplets of merged index ranges which need VtxRebase added to be rendered with MergedCmdBuffer[]. Applied by MergeBuffers()/WriteMergedBuffers(), draw lists are not modified.
+    ImVector<ImDrawVertCompact> CompactVtxBuffer; // [ALPHA] Only filled by Render() when io.BackendFlags has ImGuiBackendFlags_RendererHasCompactVtx, or by calling BuildCompactVtxBuffer(). All CmdLists[]'s VtxBuffer concatenated in order and converted, to use along with each CmdLists[]'s IdxBuffer, adding sum of previous lists' VtxBuffer.Size to VtxOffset (or along with MergedIdxBuffer). Size == TotalVtxCount when valid, empty if any vertex didn't fit.
+    ImVec2              CompactVtxOrigin;   // [ALPHA] Origin of ImDrawVertCompact::pos. Position of a vertex is 'CompactVtxOrigin + pos / IM_DRAWVERT_COMPACT_POS_SCALE'.
 
     // Functions
     ImDrawData()    { Clear(); }
     IMGUI_API void  Clear();
     IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
+    IMGUI_API void  MergeBuffers();                         // Helper to fill MergedVtxBuffer/MergedIdxBuffer from CmdLists[]. Storage is kept between frames, but this is one more CPU copy of all vertices/indices: prefer WriteMergedBuffers() into your upload memory.
+    IMGUI_API void  WriteMergedBuffers(ImDrawVert* vtx_dst, ImDrawIdx* idx_dst, ImDrawInstance* inst_dst) const; // Helper to write CmdLists[] buffers concatenated in order into your own memory (e.g. a mapped GPU buffer), applying MergedIdxRebases[]. Each destination may be NULL.
+    IMGUI_API void  BatchDrawCmds();                        // [ALPHA] Helper to fill MergedCmdBuffer[], merging compatible draw commands across draw lists (same texture, no callback, same or non-overlapping-geometry clip rectangles). Only records index ranges to rebase in MergedIdxRebases[]: call before MergeBuffers()/WriteMergedBuffers().
+    IMGUI_API bool  BuildCompactVtxBuffer();                // [ALPHA] Helper to fill CompactVtxBuffer[] from CmdLists[]. Doesn't fill MergedIdxBuffer: call MergeBuffers() too if you need it. Return false and leave CompactVtxBuffer empty if any vertex position or uv is out of range: render the regular vertices this frame.
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
@@ -3673,6 +3813,7 @@ struct ImFontAtlas
     int                         TexMaxWidth;        // Maximum desired texture width. Must be a power of two. Default to 8192.
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    void                        (*BuildParallelForFunc)(ImFontAtlas* atlas, int jobs_count, void (*job_func)(void* jobs_data, int job_n), void* jobs_data); // [ALPHA] Optional: call job_func(jobs_data, n) for every n in [0..jobs_count) on your threads, return once all completed. Used to rasterize glyphs of multiple font sources in parallel when preloading glyph ranges. Allocator set with SetAllocatorFunctions() needs to be thread-safe.
 
     // Output
     // - Because textures are dynamically created/resized, the current texture identifier may changed at *ANY TIME* during the frame.
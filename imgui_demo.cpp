@@ -523,6 +523,8 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::SameLine(); HelpMarker("Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving).");
             ImGui::Checkbox("io.ConfigMacOSXBehaviors", &io.ConfigMacOSXBehaviors);
             ImGui::SameLine(); HelpMarker("Swap Cmd<>Ctrl keys, enable various MacOS style behaviors.");
+            ImGui::Checkbox("io.ConfigDrawListCpuClipRects", &io.ConfigDrawListCpuClipRects); // [ALPHA]
+            ImGui::SameLine(); HelpMarker("*ALPHA* Clip rectangles, images and text on CPU so that nested clip rects (e.g. table cells) don't split draw calls.\nSee draw calls count in Tools->Metrics.");
             ImGui::Text("Also see Style->Rendering for rendering options.");
 
             // Also read: https://github.com/ocornut/imgui/wiki/Error-Handling
@@ -577,6 +579,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasTextures",  &io.BackendFlags, ImGuiBackendFlags_RendererHasTextures);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasBatchedDrawCmds", &io.BackendFlags, ImGuiBackendFlags_RendererHasBatchedDrawCmds);
             ImGui::EndDisabled();
 
             ImGui::TreePop();
@@ -3708,6 +3711,8 @@ static void DemoWindowWidgetsTextInput()
             ImGui::CheckboxFlags("ImGuiInputTextFlags_AllowTabInput", &flags, ImGuiInputTextFlags_AllowTabInput);
             ImGui::SameLine(); HelpMarker("When _AllowTabInput is set, passing through the widget with Tabbing doesn't automatically activate it, in order to also cycling through subsequent widgets.");
             ImGui::CheckboxFlags("ImGuiInputTextFlags_CtrlEnterForNewLine", &flags, ImGuiInputTextFlags_CtrlEnterForNewLine);
+            ImGui::CheckboxFlags("ImGuiInputTextFlags_ChunkedText", &flags, ImGuiInputTextFlags_ChunkedText);
+            ImGui::SameLine(); HelpMarker("Store text in chunks while editing, so editing very large text doesn't move all text after the cursor. Your buffer is only written when deactivating (implies ImGuiInputTextFlags_NoLiveEdit).");
             ImGui::InputTextMultiline("##source", text, IM_ARRAYSIZE(text), ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 16), flags);
             ImGui::TreePop();
         }
@@ -5488,6 +5493,7 @@ struct MyItem
     // In your own use case you would probably pass the sort specs to your sorting/comparing functions directly and not use a global.
     // We could technically call ImGui::TableGetSortSpecs() in CompareWithSortSpecs(), but considering that this function is called
     // very often by the sorting algorithm it would be a little wasteful.
+    // For large datasets, see misc/table_sort/ for a stable multi-key sorting helper producing a permutation of your rows.
     static const ImGuiTableSortSpecs* s_current_sort_specs;
 
     static void SortWithSortSpecs(ImGuiTableSortSpecs* sort_specs, MyItem* items, int items_count)
@@ -6201,11 +6207,13 @@ static void DemoWindowTables()
     {
         HelpMarker(
             "Here we activate ScrollY, which will create a child window container to allow hosting scrollable contents.\n\n"
-            "We also demonstrate using ImGuiListClipper to virtualize the submission of many items.");
+            "We also demonstrate using ImGuiListClipper to virtualize the submission of many items.\n\n"
+            "With ImGuiTableFlags_CacheRows, TableNextRowCached() returns false for rows which didn't change, and replays their previous output.");
         static ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
 
         PushStyleCompact();
         ImGui::CheckboxFlags("ImGuiTableFlags_ScrollY", &flags, ImGuiTableFlags_ScrollY);
+        ImGui::CheckboxFlags("ImGuiTableFlags_CacheRows", &flags, ImGuiTableFlags_CacheRows);
         PopStyleCompact();
 
         // When using ScrollX or ScrollY we need to specify a size for our table container!
@@ -6226,7 +6234,10 @@ static void DemoWindowTables()
             {
                 for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
                 {
-                    ImGui::TableNextRow();
+                    // Contents of our rows never change, so we always pass the same version number.
+                    // (without ImGuiTableFlags_CacheRows, this is the same as calling TableNextRow() and always returns true)
+                    if (!ImGui::TableNextRowCached((ImGuiID)row, 0))
+                        continue;
                     for (int column = 0; column < 3; column++)
                     {
                         ImGui::TableSetColumnIndex(column);
@@ -6327,6 +6338,32 @@ static void DemoWindowTables()
             }
             ImGui::EndTable();
         }
+
+        ImGui::Spacing();
+        ImGui::TextUnformatted("Wide table (2000 columns)");
+        ImGui::SameLine();
+        HelpMarker(
+            "Using TableNextVisibleColumn() to only submit visible columns, "
+            "along with ImGuiListClipper to only submit visible rows.\n\n"
+            "Columns which are not submitted don't contribute to row height, "
+            "so this is best used with fixed-width columns all having the same height.");
+        const int WIDE_COLUMNS_COUNT = 2000;
+        if (ImGui::BeginTable("table_wide", WIDE_COLUMNS_COUNT, ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_RowBg, outer_size))
+        {
+            ImGui::TableSetupScrollFreeze(1, 0);
+            for (int column = 0; column < WIDE_COLUMNS_COUNT; column++)
+                ImGui::TableSetupColumn(NULL, ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 10.0f);
+            ImGuiListClipper clipper;
+            clipper.Begin(1000);
+            while (clipper.Step())
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    ImGui::TableNextRow();
+                    while (ImGui::TableNextVisibleColumn())
+                        ImGui::Text("%d,%d", ImGui::TableGetColumnIndex(), row);
+                }
+            ImGui::EndTable();
+        }
         ImGui::TreePop();
     }
 
@@ -8186,6 +8223,7 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasTextures)    ImGui::Text(" RendererHasTextures");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasBatchedDrawCmds) ImGui::Text(" RendererHasBatchedDrawCmds");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexData->Width, io.Fonts->TexData->Height);
         ImGui::Text("io.Fonts->FontLoaderName: %s", io.Fonts->FontLoaderName ? io.Fonts->FontLoaderName : "NULL");
@@ -9096,10 +9134,13 @@ static void ShowExampleAppConsole(bool* p_open)
 //  static ExampleAppLog my_log;
 //  my_log.AddLog("Hello %d world\n", 123);
 //  my_log.Draw("title");
+// For very large logs (paged storage, incremental filtering, bounded memory), see misc/log_view/imgui_log_view.h.
 struct ExampleAppLog
 {
     ImGuiTextBuffer     Buf;
     ImGuiTextFilter     Filter;
+    ImGuiTextFilterResults FilterResults; // Results of Filter for each line. Updated incrementally by PassFilterBatch().
+    ImVector<int>       FilteredLines;
     ImVector<int>       LineOffsets; // Index to lines offset. We maintain this with AddLog() calls.
     bool                AutoScroll;  // Keep scrolling if already at the bottom.
 
@@ -9114,6 +9155,7 @@ struct ExampleAppLog
         Buf.clear();
         LineOffsets.clear();
         LineOffsets.push_back(0);
+        FilterResults.Clear();
     }
 
     void    AddLog(const char* fmt, ...) IM_FMTARGS(2)
@@ -9165,48 +9207,35 @@ struct ExampleAppLog
             ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
             const char* buf = Buf.begin();
             const char* buf_end = Buf.end();
-            if (Filter.IsActive())
+            // The simplest and easy way to display the entire buffer:
+            //   ImGui::TextUnformatted(buf_begin, buf_end);
+            // And it'll just work. TextUnformatted() has specialization for large blob of text and will fast-forward
+            // to skip non-visible lines. Here we instead demonstrate using the clipper to only process lines that are
+            // within the visible area.
+            // If you have tens of thousands of items and their processing cost is non-negligible, coarse clipping them
+            // on your side is recommended. Using ImGuiListClipper requires
+            // - A) random access into your data
+            // - B) items all being the  same height,
+            // both of which we can handle since we have an array pointing to the beginning of each line of text.
+            // When using the filter, PassFilterBatch() stores the result for each line and only tests lines which may have
+            // changed (new lines, or lines which passed/failed the filter if the filter text was extended/shortened).
+            // We build a list of lines passing the filter, which gives us random access for the clipper.
+            const bool filter_active = Filter.IsActive();
+            if (filter_active && Filter.PassFilterBatch(&FilterResults, buf, LineOffsets.Data, LineOffsets.Size, Buf.size()))
+                FilterResults.GetIndices(&FilteredLines);
+            ImGuiListClipper clipper;
+            clipper.Begin(filter_active ? FilteredLines.Size : LineOffsets.Size);
+            while (clipper.Step())
             {
-                // In this example we don't use the clipper when Filter is enabled.
-                // This is because we don't have random access to the result of our filter.
-                // A real application processing logs with ten of thousands of entries may want to store the result of
-                // search/filter.. especially if the filtering function is not trivial (e.g. reg-exp).
-                for (int line_no = 0; line_no < LineOffsets.Size; line_no++)
+                for (int item_no = clipper.DisplayStart; item_no < clipper.DisplayEnd; item_no++)
                 {
+                    const int line_no = filter_active ? FilteredLines[item_no] : item_no;
                     const char* line_start = buf + LineOffsets[line_no];
                     const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
-                    if (Filter.PassFilter(line_start, line_end))
-                        ImGui::TextUnformatted(line_start, line_end);
-                }
-            }
-            else
-            {
-                // The simplest and easy way to display the entire buffer:
-                //   ImGui::TextUnformatted(buf_begin, buf_end);
-                // And it'll just work. TextUnformatted() has specialization for large blob of text and will fast-forward
-                // to skip non-visible lines. Here we instead demonstrate using the clipper to only process lines that are
-                // within the visible area.
-                // If you have tens of thousands of items and their processing cost is non-negligible, coarse clipping them
-                // on your side is recommended. Using ImGuiListClipper requires
-                // - A) random access into your data
-                // - B) items all being the  same height,
-                // both of which we can handle since we have an array pointing to the beginning of each line of text.
-                // When using the filter (in the block of code above) we don't have random access into the data to display
-                // anymore, which is why we don't use the clipper. Storing or skimming through the search result would make
-                // it possible (and would be recommended if you want to search through tens of thousands of entries).
-                ImGuiListClipper clipper;
-                clipper.Begin(LineOffsets.Size);
-                while (clipper.Step())
-                {
-                    for (int line_no = clipper.DisplayStart; line_no < clipper.DisplayEnd; line_no++)
-                    {
-                        const char* line_start = buf + LineOffsets[line_no];
-                        const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
-                        ImGui::TextUnformatted(line_start, line_end);
-                    }
+                    ImGui::TextUnformatted(line_start, line_end);
                 }
-                clipper.End();
             }
+            clipper.End();
             ImGui::PopStyleVar();
 
             // Keep up at the bottom of the scroll region if we were already at the bottom at the beginning of the frame.
@@ -9493,7 +9522,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to Text(), variable height, clipped\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -9529,6 +9559,26 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Items of different heights, manually coarsely clipped - demonstrate how to use ImGuiListClipper::BeginVariableHeight().
+            // Heights are measured by the clipper as items are displayed, and stored in a persistent ImGuiListClipperHeights.
+            // (If heights depend on available width, as with wrapped text, you would want to call heights.Clear() when width changes)
+            static ImGuiListClipperHeights heights;
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            ImGuiListClipper clipper;
+            clipper.BeginVariableHeight(lines, &heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                {
+                    if ((i % 10) == 0)
+                        ImGui::Text("%i The quick brown fox jumps over the lazy dog\n  (every 10th line\n  is taller)", i);
+                    else
+                        ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
+                }
+            ImGui::PopStyleVar();
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
@@ -385,6 +385,8 @@ ImDrawListSharedData::ImDrawListSharedData()
 {
     memset(this, 0, sizeof(*this));
     InitialFringeScale = 1.0f;
+    CurveCache.LastEntryIdx = -1;
+    ConcaveMonotoneMinPoints = IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS;
     for (int i = 0; i < IM_ARRAYSIZE(ArcFastVtx); i++)
     {
         const float a = ((float)i * 2 * IM_PI) / (float)IM_ARRAYSIZE(ArcFastVtx);
@@ -448,6 +450,7 @@ void ImDrawList::_ResetForNewFrame()
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
+    InstBuffer.resize(0);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
@@ -460,6 +463,7 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = _Data->InitialFringeScale;
+    _CulledPrimsCount = _CulledTextCount = 0;
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -467,6 +471,7 @@ void ImDrawList::_ClearFreeMemory()
     CmdBuffer.clear();
     IdxBuffer.clear();
     VtxBuffer.clear();
+    InstBuffer.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
@@ -484,6 +489,7 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
+    dst->InstBuffer = InstBuffer;
     dst->Flags = Flags;
     return dst;
 }
@@ -495,6 +501,7 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.TexRef = _CmdHeader.TexRef;
     draw_cmd.VtxOffset = _CmdHeader.VtxOffset;
     draw_cmd.IdxOffset = IdxBuffer.Size;
+    draw_cmd.InstOffset = InstBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
     CmdBuffer.push_back(draw_cmd);
@@ -507,7 +514,7 @@ void ImDrawList::_PopUnusedDrawCmd()
     while (CmdBuffer.Size > 0)
     {
         ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-        if (curr_cmd->ElemCount != 0 || curr_cmd->UserCallback != NULL)
+        if (curr_cmd->ElemCount != 0 || curr_cmd->InstCount != 0 || curr_cmd->UserCallback != NULL)
             return;// break;
         CmdBuffer.pop_back();
     }
@@ -518,7 +525,7 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* userdata, size_t use
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     IM_ASSERT(curr_cmd->UserCallback == NULL);
-    if (curr_cmd->ElemCount != 0)
+    if (curr_cmd->ElemCount != 0 || curr_cmd->InstCount != 0)
     {
         AddDrawCmd();
         curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
@@ -551,7 +558,9 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* userdata, size_t use
 #define ImDrawCmd_HeaderSize                            (offsetof(ImDrawCmd, VtxOffset) + sizeof(unsigned int))
 #define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TexRef, VtxOffset
 #define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TexRef, VtxOffset
-#define ImDrawCmd_AreSequentialIdxOffset(CMD_0, CMD_1)  (CMD_0->IdxOffset + CMD_0->ElemCount == CMD_1->IdxOffset)
+#define ImDrawCmd_AreSequentialIdxOffset(CMD_0, CMD_1)  (CMD_0->IdxOffset + CMD_0->ElemCount == CMD_1->IdxOffset && CMD_0->InstOffset + CMD_0->InstCount == CMD_1->InstOffset)
+#define ImDrawCmd_AreSameKind(CMD_0, CMD_1)             ((CMD_0->ElemCount == 0 || CMD_1->InstCount == 0) && (CMD_0->InstCount == 0 || CMD_1->ElemCount == 0)) // Merging won't mix triangles and instances
+#define ImDrawCmd_ClipRectContains(OUTER, INNER)        ((INNER).x >= (OUTER).x && (INNER).y >= (OUTER).y && (INNER).z <= (OUTER).z && (INNER).w <= (OUTER).w)
 
 // Try to merge two last draw commands
 void ImDrawList::_TryMergeDrawCmds()
@@ -559,22 +568,57 @@ void ImDrawList::_TryMergeDrawCmds()
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
+    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && ImDrawCmd_AreSameKind(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
     {
         prev_cmd->ElemCount += curr_cmd->ElemCount;
+        prev_cmd->InstCount += curr_cmd->InstCount;
         CmdBuffer.pop_back();
     }
 }
 
+// Convert last command back to triangles if it holds a short run of instances, then try merging it with previous command.
+// An isolated instanced rectangle or a few glyphs would otherwise cost a draw call of their own between two triangle commands.
+void ImDrawList::_TryFlattenInstances()
+{
+    IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
+    ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    const int inst_count = (int)curr_cmd->InstCount;
+    if (inst_count == 0 || inst_count >= IM_DRAWLIST_INSTANCES_MIN_RUN || curr_cmd->UserCallback != NULL)
+        return;
+    if (curr_cmd->InstOffset + curr_cmd->InstCount != (unsigned int)InstBuffer.Size || curr_cmd->IdxOffset != (unsigned int)IdxBuffer.Size || curr_cmd->VtxOffset != _CmdHeader.VtxOffset)
+        return;
+    if (sizeof(ImDrawIdx) == 2 && _VtxCurrentIdx + inst_count * 4 >= (1 << 16))
+        return;
+
+    // Instances are at the end of InstBuffer[], and PrimRectUV() won't touch InstBuffer[] so we can read them before shrinking.
+    const ImDrawInstance* inst = InstBuffer.Data + curr_cmd->InstOffset;
+    VtxBuffer.resize(VtxBuffer.Size + inst_count * 4);
+    IdxBuffer.resize(IdxBuffer.Size + inst_count * 6);
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size - inst_count * 4;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size - inst_count * 6;
+    for (int n = 0; n < inst_count; n++, inst++)
+        PrimRectUV(inst->pos_min, inst->pos_max, inst->uv_min, inst->uv_max, inst->col);
+    InstBuffer.shrink(InstBuffer.Size - inst_count);
+    curr_cmd->InstCount = 0;
+    curr_cmd->ElemCount = inst_count * 6;
+    if (CmdBuffer.Size > 1)
+        _TryMergeDrawCmds();
+}
+
 // Our scheme may appears a bit unusual, basically we want the most-common calls AddLine AddRect etc. to not have to perform any check so we always have a command ready in the stack.
 // The cost of figuring out if a new command has to be added or if we can merge is paid in those Update** functions only.
 void ImDrawList::_OnChangedClipRect()
 {
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
+    _TryFlattenInstances();
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
+    if ((curr_cmd->ElemCount != 0 || curr_cmd->InstCount != 0) && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
     {
+        // With ImDrawListFlags_CpuClipRects, keep using current command if it contains the new clip rect:
+        // CPU clipped primitives can still be appended to it, PrimReserve() will add a new command for other primitives.
+        if ((Flags & ImDrawListFlags_CpuClipRects) && ImDrawCmd_ClipRectContains(curr_cmd->ClipRect, _CmdHeader.ClipRect))
+            return;
         AddDrawCmd();
         return;
     }
@@ -582,7 +626,7 @@ void ImDrawList::_OnChangedClipRect()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->InstCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
@@ -594,8 +638,9 @@ void ImDrawList::_OnChangedTexture()
 {
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
+    _TryFlattenInstances();
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && curr_cmd->TexRef != _CmdHeader.TexRef)
+    if ((curr_cmd->ElemCount != 0 || curr_cmd->InstCount != 0) && curr_cmd->TexRef != _CmdHeader.TexRef)
     {
         AddDrawCmd();
         return;
@@ -607,7 +652,7 @@ void ImDrawList::_OnChangedTexture()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->InstCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
@@ -622,7 +667,7 @@ void ImDrawList::_OnChangedVtxOffset()
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     //IM_ASSERT(curr_cmd->VtxOffset != _CmdHeader.VtxOffset); // See #3349
-    if (curr_cmd->ElemCount != 0)
+    if (curr_cmd->ElemCount != 0 || curr_cmd->InstCount != 0)
     {
         AddDrawCmd();
         return;
@@ -704,8 +749,12 @@ void ImDrawList::_SetTexture(ImTextureRef tex_ref)
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
-    // Large mesh support (when enabled)
+    // Close a short run of instances first so this can be merged with triangles before it (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
+    if (CmdBuffer.Data[CmdBuffer.Size - 1].InstCount != 0)
+        _TryFlattenInstances();
+
+    // Large mesh support (when enabled)
     if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
     {
         // FIXME: In theory we should be testing that vtx_count <64k here.
@@ -715,7 +764,13 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
         _OnChangedVtxOffset();
     }
 
+    // With ImDrawListFlags_CpuClipRects, current command may have a larger clip rect than _CmdHeader.ClipRect (see _OnChangedClipRect())
     ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (draw_cmd->InstCount != 0 || ((Flags & ImDrawListFlags_CpuClipRects) && memcmp(&draw_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0))
+    {
+        AddDrawCmd();
+        draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    }
     draw_cmd->ElemCount += idx_count;
 
     int vtx_buffer_old_size = VtxBuffer.Size;
@@ -738,6 +793,43 @@ void ImDrawList::PrimUnreserve(int idx_count, int vtx_count)
     IdxBuffer.shrink(IdxBuffer.Size - idx_count);
 }
 
+// [ALPHA] Reserve space for a number of instances (axis-aligned quads expanded by the renderer). Requires ImDrawListFlags_AllowInstances.
+// As with PrimReserve(), you must finish writing instances before calling PrimReserveXXX() again.
+ImDrawInstance* ImDrawList::PrimReserveInstances(int inst_count)
+{
+    IM_ASSERT_PARANOID(inst_count >= 0);
+    IM_ASSERT(Flags & ImDrawListFlags_AllowInstances);
+    ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (draw_cmd->ElemCount != 0 || ((Flags & ImDrawListFlags_CpuClipRects) && memcmp(&draw_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0))
+    {
+        AddDrawCmd();
+        draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    }
+    draw_cmd->InstCount += inst_count;
+
+    int inst_buffer_old_size = InstBuffer.Size;
+    InstBuffer.resize(inst_buffer_old_size + inst_count);
+    return InstBuffer.Data + inst_buffer_old_size;
+}
+
+void ImDrawList::PrimUnreserveInstances(int inst_count)
+{
+    IM_ASSERT_PARANOID(inst_count >= 0);
+    ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    draw_cmd->InstCount -= inst_count;
+    InstBuffer.shrink(InstBuffer.Size - inst_count);
+}
+
+void ImDrawList::PrimInstance(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a, const ImVec2& uv_c, ImU32 col)
+{
+    ImDrawInstance* inst = PrimReserveInstances(1);
+    inst->pos_min = a;
+    inst->pos_max = c;
+    inst->uv_min = uv_a;
+    inst->uv_max = uv_c;
+    inst->col = col;
+}
+
 // Fully unrolled with inline call to keep our debug builds decently fast.
 void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 {
@@ -1343,47 +1435,174 @@ ImVec2 ImBezierQuadraticCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p
 }
 
 // Closely mimics ImBezierCubicClosestPointCasteljau() in imgui.cpp
-static void PathBezierCubicCurveToCasteljau(ImVector<ImVec2>* path, float x1, float y1, float x2, float y2, float x3, float y3, float x4, float y4, float tess_tol, int level)
+// Iterative version of recursive subdivision: left halves are processed first, right halves are stacked (at most one per level).
+#define IM_BEZIER_CASTELJAU_LEVEL_MAX   10
+static void PathBezierCubicCurveToCasteljau(ImVector<ImVec2>* path, float x1, float y1, float x2, float y2, float x3, float y3, float x4, float y4, float tess_tol)
+{
+    float stack[IM_BEZIER_CASTELJAU_LEVEL_MAX][8];
+    int stack_level[IM_BEZIER_CASTELJAU_LEVEL_MAX];
+    int stack_size = 0;
+    int level = 0;
+    for (;;)
+    {
+        float dx = x4 - x1;
+        float dy = y4 - y1;
+        float d2 = (x2 - x4) * dy - (y2 - y4) * dx;
+        float d3 = (x3 - x4) * dy - (y3 - y4) * dx;
+        d2 = (d2 >= 0) ? d2 : -d2;
+        d3 = (d3 >= 0) ? d3 : -d3;
+        if ((d2 + d3) * (d2 + d3) < tess_tol * (dx * dx + dy * dy))
+        {
+            path->push_back(ImVec2(x4, y4));
+        }
+        else if (level < IM_BEZIER_CASTELJAU_LEVEL_MAX)
+        {
+            float x12 = (x1 + x2) * 0.5f, y12 = (y1 + y2) * 0.5f;
+            float x23 = (x2 + x3) * 0.5f, y23 = (y2 + y3) * 0.5f;
+            float x34 = (x3 + x4) * 0.5f, y34 = (y3 + y4) * 0.5f;
+            float x123 = (x12 + x23) * 0.5f, y123 = (y12 + y23) * 0.5f;
+            float x234 = (x23 + x34) * 0.5f, y234 = (y23 + y34) * 0.5f;
+            float x1234 = (x123 + x234) * 0.5f, y1234 = (y123 + y234) * 0.5f;
+            float* right = stack[stack_size];
+            right[0] = x1234; right[1] = y1234; right[2] = x234; right[3] = y234; right[4] = x34; right[5] = y34; right[6] = x4; right[7] = y4;
+            stack_level[stack_size++] = ++level;
+            x2 = x12; y2 = y12; x3 = x123; y3 = y123; x4 = x1234; y4 = y1234;
+            continue;
+        }
+        if (stack_size == 0)
+            break;
+        const float* right = stack[--stack_size];
+        x1 = right[0]; y1 = right[1]; x2 = right[2]; y2 = right[3]; x3 = right[4]; y3 = right[5]; x4 = right[6]; y4 = right[7];
+        level = stack_level[stack_size];
+    }
+}
+
+static void PathBezierQuadraticCurveToCasteljau(ImVector<ImVec2>* path, float x1, float y1, float x2, float y2, float x3, float y3, float tess_tol)
 {
-    float dx = x4 - x1;
-    float dy = y4 - y1;
-    float d2 = (x2 - x4) * dy - (y2 - y4) * dx;
-    float d3 = (x3 - x4) * dy - (y3 - y4) * dx;
-    d2 = (d2 >= 0) ? d2 : -d2;
-    d3 = (d3 >= 0) ? d3 : -d3;
-    if ((d2 + d3) * (d2 + d3) < tess_tol * (dx * dx + dy * dy))
+    float stack[IM_BEZIER_CASTELJAU_LEVEL_MAX][6];
+    int stack_level[IM_BEZIER_CASTELJAU_LEVEL_MAX];
+    int stack_size = 0;
+    int level = 0;
+    for (;;)
     {
-        path->push_back(ImVec2(x4, y4));
+        float dx = x3 - x1, dy = y3 - y1;
+        float det = (x2 - x3) * dy - (y2 - y3) * dx;
+        if (det * det * 4.0f < tess_tol * (dx * dx + dy * dy))
+        {
+            path->push_back(ImVec2(x3, y3));
+        }
+        else if (level < IM_BEZIER_CASTELJAU_LEVEL_MAX)
+        {
+            float x12 = (x1 + x2) * 0.5f, y12 = (y1 + y2) * 0.5f;
+            float x23 = (x2 + x3) * 0.5f, y23 = (y2 + y3) * 0.5f;
+            float x123 = (x12 + x23) * 0.5f, y123 = (y12 + y23) * 0.5f;
+            float* right = stack[stack_size];
+            right[0] = x123; right[1] = y123; right[2] = x23; right[3] = y23; right[4] = x3; right[5] = y3;
+            stack_level[stack_size++] = ++level;
+            x2 = x12; y2 = y12; x3 = x123; y3 = y123;
+            continue;
+        }
+        if (stack_size == 0)
+            break;
+        const float* right = stack[--stack_size];
+        x1 = right[0]; y1 = right[1]; x2 = right[2]; y2 = right[3]; x3 = right[4]; y3 = right[5];
+        level = stack_level[stack_size];
     }
-    else if (level < 10)
+}
+
+void ImDrawListCurveCache::NewFrame()
+{
+    // Discard entries not used during last frame, if they hold more than half of stored points.
+    if (Points.Size > FrameUsedPointsCount * 2)
     {
-        float x12 = (x1 + x2) * 0.5f, y12 = (y1 + y2) * 0.5f;
-        float x23 = (x2 + x3) * 0.5f, y23 = (y2 + y3) * 0.5f;
-        float x34 = (x3 + x4) * 0.5f, y34 = (y3 + y4) * 0.5f;
-        float x123 = (x12 + x23) * 0.5f, y123 = (y12 + y23) * 0.5f;
-        float x234 = (x23 + x34) * 0.5f, y234 = (y23 + y34) * 0.5f;
-        float x1234 = (x123 + x234) * 0.5f, y1234 = (y123 + y234) * 0.5f;
-        PathBezierCubicCurveToCasteljau(path, x1, y1, x12, y12, x123, y123, x1234, y1234, tess_tol, level + 1);
-        PathBezierCubicCurveToCasteljau(path, x1234, y1234, x234, y234, x34, y34, x4, y4, tess_tol, level + 1);
+        ImVector<ImVec2> new_points;
+        new_points.reserve(FrameUsedPointsCount);
+        int new_entries_count = 0;
+        Map.Data.resize(0);
+        for (ImDrawListCurveCacheEntry& entry : Entries)
+        {
+            if (entry.LastUsedFrame != Frame)
+                continue;
+            new_points.resize(new_points.Size + entry.PointsCount);
+            memcpy(new_points.Data + new_points.Size - entry.PointsCount, Points.Data + entry.PointsOffset, (size_t)entry.PointsCount * sizeof(ImVec2));
+            entry.PointsOffset = new_points.Size - entry.PointsCount;
+            Map.Data.push_back(ImGuiStoragePair(ImHashData(entry.Key, sizeof(entry.Key)), new_entries_count));
+            Entries[new_entries_count++] = entry;
+        }
+        Entries.resize(new_entries_count);
+        Map.BuildSortByKey();
+        Points.swap(new_points);
     }
+    FrameUsedPointsCount = 0;
+    LastEntryIdx = -1;
+    Frame++;
 }
 
-static void PathBezierQuadraticCurveToCasteljau(ImVector<ImVec2>* path, float x1, float y1, float x2, float y2, float x3, float y3, float tess_tol, int level)
+// Auto-tessellate curve through the cache. 'p4' is unused for quadratic curves.
+static void PathBezierCurveToCached(ImDrawListSharedData* data, ImVector<ImVec2>* path, bool cubic, const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4)
 {
-    float dx = x3 - x1, dy = y3 - y1;
-    float det = (x2 - x3) * dy - (y2 - y3) * dx;
-    if (det * det * 4.0f < tess_tol * (dx * dx + dy * dy))
+    ImDrawListCurveCache& cache = data->CurveCache;
+    float key[7];
+    key[0] = p2.x - p1.x; key[1] = p2.y - p1.y;
+    key[2] = p3.x - p1.x; key[3] = p3.y - p1.y;
+    key[4] = cubic ? p4.x - p1.x : FLT_MAX; key[5] = cubic ? p4.y - p1.y : FLT_MAX;
+    key[6] = data->CurveTessellationTol;
+
+    // Curves are generally submitted in same order every frame: try entry following last one before doing a lookup.
+    int entry_idx = cache.LastEntryIdx + 1;
+    bool is_collision = false;
+    if (entry_idx >= cache.Entries.Size || memcmp(cache.Entries[entry_idx].Key, key, sizeof(key)) != 0)
+    {
+        int* p_entry_idx = cache.Map.GetIntRef(ImHashData(key, sizeof(key)), -1);
+        if (*p_entry_idx == -1)
+            *p_entry_idx = cache.Entries.Size; // Will be added below
+        entry_idx = *p_entry_idx;
+        is_collision = (entry_idx < cache.Entries.Size && memcmp(cache.Entries[entry_idx].Key, key, sizeof(key)) != 0);
+    }
+
+    int points_offset, points_count;
+    if (entry_idx == cache.Entries.Size || is_collision)
     {
-        path->push_back(ImVec2(x3, y3));
+        // Tessellate relative to first control point. On hash collision we don't store an entry, points are discarded after use.
+        points_offset = cache.Points.Size;
+        if (cubic)
+            PathBezierCubicCurveToCasteljau(&cache.Points, 0.0f, 0.0f, key[0], key[1], key[2], key[3], key[4], key[5], key[6]);
+        else
+            PathBezierQuadraticCurveToCasteljau(&cache.Points, 0.0f, 0.0f, key[0], key[1], key[2], key[3], key[6]);
+        points_count = cache.Points.Size - points_offset;
+        if (!is_collision)
+        {
+            ImDrawListCurveCacheEntry entry;
+            memcpy(entry.Key, key, sizeof(key));
+            entry.LastUsedFrame = cache.Frame;
+            entry.PointsOffset = points_offset;
+            entry.PointsCount = points_count;
+            cache.FrameUsedPointsCount += points_count;
+            cache.Entries.push_back(entry);
+            cache.LastEntryIdx = entry_idx;
+        }
     }
-    else if (level < 10)
+    else
     {
-        float x12 = (x1 + x2) * 0.5f, y12 = (y1 + y2) * 0.5f;
-        float x23 = (x2 + x3) * 0.5f, y23 = (y2 + y3) * 0.5f;
-        float x123 = (x12 + x23) * 0.5f, y123 = (y12 + y23) * 0.5f;
-        PathBezierQuadraticCurveToCasteljau(path, x1, y1, x12, y12, x123, y123, tess_tol, level + 1);
-        PathBezierQuadraticCurveToCasteljau(path, x123, y123, x23, y23, x3, y3, tess_tol, level + 1);
+        ImDrawListCurveCacheEntry& entry = cache.Entries[entry_idx];
+        if (entry.LastUsedFrame != cache.Frame)
+            cache.FrameUsedPointsCount += entry.PointsCount;
+        entry.LastUsedFrame = cache.Frame;
+        points_offset = entry.PointsOffset;
+        points_count = entry.PointsCount;
+        cache.LastEntryIdx = entry_idx;
     }
+
+    // Translate back to first control point
+    // (resize() grows capacity geometrically, whereas reserve() would reallocate the whole path for each chained curve)
+    const int path_size = path->Size;
+    path->resize(path_size + points_count);
+    const ImVec2* src = cache.Points.Data + points_offset;
+    ImVec2* dst = path->Data + path_size;
+    for (int n = 0; n < points_count; n++)
+        dst[n] = ImVec2(src[n].x + p1.x, src[n].y + p1.y);
+    if (is_collision)
+        cache.Points.resize(points_offset);
 }
 
 void ImDrawList::PathBezierCubicCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments)
@@ -1392,7 +1611,10 @@ void ImDrawList::PathBezierCubicCurveTo(const ImVec2& p2, const ImVec2& p3, cons
     if (num_segments == 0)
     {
         IM_ASSERT(_Data->CurveTessellationTol > 0.0f);
-        PathBezierCubicCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, p4.x, p4.y, _Data->CurveTessellationTol, 0); // Auto-tessellated
+        if (Flags & ImDrawListFlags_CacheCurves)
+            PathBezierCurveToCached(_Data, &_Path, true, p1, p2, p3, p4);
+        else
+            PathBezierCubicCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, p4.x, p4.y, _Data->CurveTessellationTol); // Auto-tessellated
     }
     else
     {
@@ -1408,7 +1630,10 @@ void ImDrawList::PathBezierQuadraticCurveTo(const ImVec2& p2, const ImVec2& p3,
     if (num_segments == 0)
     {
         IM_ASSERT(_Data->CurveTessellationTol > 0.0f);
-        PathBezierQuadraticCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, _Data->CurveTessellationTol, 0);// Auto-tessellated
+        if (Flags & ImDrawListFlags_CacheCurves)
+            PathBezierCurveToCached(_Data, &_Path, false, p1, p2, p3, p3);
+        else
+            PathBezierQuadraticCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, _Data->CurveTessellationTol); // Auto-tessellated
     }
     else
     {
@@ -1470,10 +1695,41 @@ void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDr
     }
 }
 
+// Coarse culling: return true when a bounding box (expanded by 'pad' for thickness and anti-aliasing fringe) is fully outside
+// the current clipping rectangle, so Add*() functions can early out before building paths or tessellating.
+// Counted in ImDrawList::_CulledPrimsCount (per draw list, as they may be built from different threads), displayed in Metrics window.
+// (Path API and AddPolyline()/AddConvexPolyFilled()/AddConcavePolyFilled() are not culled: bounds are not known without a pass over points)
+static inline bool ImDrawListCoarseCull(ImDrawList* draw_list, const ImVec2& bb_min, const ImVec2& bb_max, float pad)
+{
+    if (draw_list->Flags & ImDrawListFlags_NoCoarseCulling)
+        return false;
+    const ImVec4& clip_rect = draw_list->_CmdHeader.ClipRect;
+    if (bb_max.x + pad < clip_rect.x || bb_max.y + pad < clip_rect.y || bb_min.x - pad > clip_rect.z || bb_min.y - pad > clip_rect.w)
+    {
+        draw_list->_CulledPrimsCount++;
+        return true;
+    }
+    return false;
+}
+
+// ImDrawListFlags_CpuClipRects: clip an axis-aligned rectangle and its texture coordinates. Return false if nothing is left.
+// Caller needs to ensure a.x <= c.x and a.y <= c.y.
+static inline bool ImDrawListCpuClipRectUV(const ImVec4& clip_rect, ImVec2* a, ImVec2* c, ImVec2* uv_a, ImVec2* uv_c)
+{
+    const ImVec2 pos_a = *a, pos_c = *c, tex_a = *uv_a, tex_c = *uv_c;
+    if (pos_a.x < clip_rect.x) { a->x = clip_rect.x; uv_a->x = tex_a.x + (tex_c.x - tex_a.x) * (clip_rect.x - pos_a.x) / (pos_c.x - pos_a.x); }
+    if (pos_a.y < clip_rect.y) { a->y = clip_rect.y; uv_a->y = tex_a.y + (tex_c.y - tex_a.y) * (clip_rect.y - pos_a.y) / (pos_c.y - pos_a.y); }
+    if (pos_c.x > clip_rect.z) { c->x = clip_rect.z; uv_c->x = tex_a.x + (tex_c.x - tex_a.x) * (clip_rect.z - pos_a.x) / (pos_c.x - pos_a.x); }
+    if (pos_c.y > clip_rect.w) { c->y = clip_rect.w; uv_c->y = tex_a.y + (tex_c.y - tex_a.y) * (clip_rect.w - pos_a.y) / (pos_c.y - pos_a.y); }
+    return a->x < c->x && a->y < c->y;
+}
+
 void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness)
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, ImMin(p1, p2), ImMax(p1, p2), thickness * 0.5f + 1.0f))
+        return;
     PathLineTo(p1 + ImVec2(0.5f, 0.5f));
     PathLineTo(p2 + ImVec2(0.5f, 0.5f));
     PathStroke(col, 0, thickness);
@@ -1485,6 +1741,8 @@ void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, fl
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, p_min, p_max, thickness * 0.5f + 1.0f))
+        return;
     if (Flags & ImDrawListFlags_AntiAliasedLines)
         PathRect(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.50f, 0.50f), rounding, flags);
     else
@@ -1496,10 +1754,29 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, p_min, p_max, 1.0f))
+        return;
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
-        PrimReserve(6, 4);
-        PrimRect(p_min, p_max, col);
+        ImVec2 a = p_min, c = p_max;
+        const ImDrawListFlags backup_flags = Flags;
+        if ((Flags & ImDrawListFlags_CpuClipRects) && a.x <= c.x && a.y <= c.y)
+        {
+            ImVec2 uv_a = _Data->TexUvWhitePixel, uv_c = _Data->TexUvWhitePixel;
+            if (!ImDrawListCpuClipRectUV(_CmdHeader.ClipRect, &a, &c, &uv_a, &uv_c))
+                return;
+            Flags &= ~ImDrawListFlags_CpuClipRects; // Clipped: can be appended to current command
+        }
+        if (Flags & ImDrawListFlags_AllowInstances)
+        {
+            PrimInstance(a, c, _Data->TexUvWhitePixel, _Data->TexUvWhitePixel, col);
+        }
+        else
+        {
+            PrimReserve(6, 4);
+            PrimRect(a, c, col);
+        }
+        Flags = backup_flags;
     }
     else
     {
@@ -1513,6 +1790,8 @@ void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_ma
 {
     if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, p_min, p_max, 1.0f))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
     PrimReserve(6, 4);
@@ -1528,6 +1807,8 @@ void ImDrawList::AddQuad(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, c
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), thickness * 0.5f + 1.0f))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
@@ -1540,6 +1821,8 @@ void ImDrawList::AddQuadFilled(const ImVec2& p1, const ImVec2& p2, const ImVec2&
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), 1.0f))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
@@ -1552,6 +1835,8 @@ void ImDrawList::AddTriangle(const ImVec2& p1, const ImVec2& p2, const ImVec2& p
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, ImMin(ImMin(p1, p2), p3), ImMax(ImMax(p1, p2), p3), thickness * 0.5f + 1.0f))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
@@ -1563,6 +1848,8 @@ void ImDrawList::AddTriangleFilled(const ImVec2& p1, const ImVec2& p2, const ImV
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, ImMin(ImMin(p1, p2), p3), ImMax(ImMax(p1, p2), p3), 1.0f))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
@@ -1574,6 +1861,8 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    if (ImDrawListCoarseCull(this, center, center, radius + thickness * 0.5f + 1.0f))
+        return;
 
     if (num_segments <= 0)
     {
@@ -1598,6 +1887,8 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    if (ImDrawListCoarseCull(this, center, center, radius + 1.0f))
+        return;
 
     if (num_segments <= 0)
     {
@@ -1623,6 +1914,8 @@ void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if (ImDrawListCoarseCull(this, center, center, ImAbs(radius) + thickness * 0.5f + 1.0f))
+        return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1635,6 +1928,8 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if (ImDrawListCoarseCull(this, center, center, ImAbs(radius) + 1.0f))
+        return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1647,6 +1942,8 @@ void ImDrawList::AddEllipse(const ImVec2& center, const ImVec2& radius, ImU32 co
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, center, center, ImMax(ImAbs(radius.x), ImAbs(radius.y)) + thickness * 0.5f + 1.0f))
+        return;
 
     if (num_segments <= 0)
         num_segments = _CalcCircleAutoSegmentCount(ImMax(radius.x, radius.y)); // A bit pessimistic, maybe there's a better computation to do here.
@@ -1661,6 +1958,8 @@ void ImDrawList::AddEllipseFilled(const ImVec2& center, const ImVec2& radius, Im
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, center, center, ImMax(ImAbs(radius.x), ImAbs(radius.y)) + 1.0f))
+        return;
 
     if (num_segments <= 0)
         num_segments = _CalcCircleAutoSegmentCount(ImMax(radius.x, radius.y)); // A bit pessimistic, maybe there's a better computation to do here.
@@ -1676,6 +1975,8 @@ void ImDrawList::AddBezierCubic(const ImVec2& p1, const ImVec2& p2, const ImVec2
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), thickness * 0.5f + 1.0f)) // Curve is within convex hull of control points
+        return;
 
     PathLineTo(p1);
     PathBezierCubicCurveTo(p2, p3, p4, num_segments);
@@ -1687,6 +1988,8 @@ void ImDrawList::AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const Im
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, ImMin(ImMin(p1, p2), p3), ImMax(ImMax(p1, p2), p3), thickness * 0.5f + 1.0f))
+        return;
 
     PathLineTo(p1);
     PathBezierQuadraticCurveTo(p2, p3, num_segments);
@@ -1717,7 +2020,20 @@ void ImDrawList::AddText(ImFont* font, float font_size, const ImVec2& pos, ImU32
         clip_rect.z = ImMin(clip_rect.z, cpu_fine_clip_rect->z);
         clip_rect.w = ImMin(clip_rect.w, cpu_fine_clip_rect->w);
     }
-    font->RenderText(this, font_size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip_rect != NULL);
+
+    // Coarse culling: all lines start at pos.x and go down from pos.y (ImFont::RenderText() also skips lines above clip_rect.y)
+    if ((pos.x > clip_rect.z || pos.y > clip_rect.w) && !(Flags & ImDrawListFlags_NoCoarseCulling))
+    {
+        _CulledTextCount++;
+        return;
+    }
+
+    // With ImDrawListFlags_CpuClipRects, glyphs are always clipped on CPU, so they can be appended to current command
+    const ImDrawListFlags backup_flags = Flags;
+    const bool cpu_fine_clip = (cpu_fine_clip_rect != NULL) || (Flags & ImDrawListFlags_CpuClipRects) != 0;
+    Flags &= ~ImDrawListFlags_CpuClipRects;
+    font->RenderText(this, font_size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip);
+    Flags = backup_flags;
 }
 
 void ImDrawList::AddText(const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end)
@@ -1729,13 +2045,30 @@ void ImDrawList::AddImage(ImTextureRef tex_ref, const ImVec2& p_min, const ImVec
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, ImMin(p_min, p_max), ImMax(p_min, p_max), 0.0f)) // Also avoids a texture change
+        return;
+    ImVec2 a = p_min, c = p_max, uv_a = uv_min, uv_c = uv_max;
+    const bool cpu_clip = (Flags & ImDrawListFlags_CpuClipRects) && a.x <= c.x && a.y <= c.y;
+    if (cpu_clip && !ImDrawListCpuClipRectUV(_CmdHeader.ClipRect, &a, &c, &uv_a, &uv_c))
+        return;
 
     const bool push_texture_id = tex_ref != _CmdHeader.TexRef;
     if (push_texture_id)
         PushTexture(tex_ref);
 
-    PrimReserve(6, 4);
-    PrimRectUV(p_min, p_max, uv_min, uv_max, col);
+    const ImDrawListFlags backup_flags = Flags;
+    if (cpu_clip)
+        Flags &= ~ImDrawListFlags_CpuClipRects; // Clipped: can be appended to current command
+    if (Flags & ImDrawListFlags_AllowInstances)
+    {
+        PrimInstance(a, c, uv_a, uv_c, col);
+    }
+    else
+    {
+        PrimReserve(6, 4);
+        PrimRectUV(a, c, uv_a, uv_c, col);
+    }
+    Flags = backup_flags;
 
     if (push_texture_id)
         PopTexture();
@@ -1745,6 +2078,8 @@ void ImDrawList::AddImageQuad(ImTextureRef tex_ref, const ImVec2& p1, const ImVe
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), 0.0f))
+        return;
 
     const bool push_texture_id = tex_ref != _CmdHeader.TexRef;
     if (push_texture_id)
@@ -1761,6 +2096,8 @@ void ImDrawList::AddImageRounded(ImTextureRef tex_ref, const ImVec2& p_min, cons
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCoarseCull(this, p_min, p_max, 1.0f))
+        return;
 
     flags = FixRectCornerFlags(flags);
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
@@ -1791,6 +2128,8 @@ void ImDrawList::AddImageRounded(ImTextureRef tex_ref, const ImVec2& p_min, cons
 // Provided as a convenience for user but not used by main library.
 //-----------------------------------------------------------------------------
 // - ImTriangulator [Internal]
+// - ImTriangulatorMonotone [Internal]
+// - ImPolygonIsConvex() [Internal]
 // - AddConcavePolyFilled()
 //-----------------------------------------------------------------------------
 
@@ -1845,8 +2184,6 @@ struct ImTriangulator
 };
 
 // Distribute storage for nodes, ears and reflexes.
-// FIXME-OPT: if everything is convex, we could report it to caller and let it switch to an convex renderer
-// (this would require first building reflexes to bail to convex if empty, without even building nodes)
 void ImTriangulator::Init(const ImVec2* points, int points_count, void* scratch_buffer)
 {
     IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
@@ -1999,8 +2336,536 @@ void ImTriangulator::ReclassifyNode(ImTriangulatorNode* n1)
     n1->Type = type;
 }
 
-// Use ear-clipping algorithm to triangulate a simple polygon (no self-interaction, no holes).
-// (Reminder: we don't perform any coarse clipping/culling in ImDrawList layer!
+//-----------------------------------------------------------------------------
+// Triangulate simple polygons by sweep-line decomposition into y-monotone pieces, O(N log N) complexity
+// (plus O(N*K) for sweep status updates, K being the number of edges crossing a scanline, typically small).
+// Reference: "Computational Geometry: Algorithms and Applications", de Berg et al., chapter 3.
+// Used instead of ImTriangulator for large polygons, e.g. map outlines with thousands of points.
+//-----------------------------------------------------------------------------
+
+enum ImTriangulatorMonotoneVertexType
+{
+    ImTriangulatorMonotoneVertexType_Regular,
+    ImTriangulatorMonotoneVertexType_Start,
+    ImTriangulatorMonotoneVertexType_End,
+    ImTriangulatorMonotoneVertexType_Split,
+    ImTriangulatorMonotoneVertexType_Merge
+};
+
+struct ImTriangulatorMonotoneVertex
+{
+    ImVec2  Pos;
+    int     Index;
+};
+
+struct ImTriangulatorMonotone
+{
+    static int EstimateScratchBufferSize(int points_count)  { return (int)(sizeof(ImVec2) + sizeof(ImTriangulatorMonotoneVertex) + sizeof(int) * 16 + 4) * points_count + (int)sizeof(int) * 2; }
+
+    bool    Triangulate(const ImVec2* points, int points_count, void* scratch_buffer, unsigned int* out_triangles); // Return false if geometry is degenerated
+
+    // Internal functions
+    void    BuildVertices(const ImVec2* points, int points_count);
+    void    AddDiagonal(int i0, int i1);
+    int     FindEdgeLeftOf(int i) const;
+    void    InsertEdge(int edge);
+    void    RemoveEdge(int edge);
+    void    BuildDiagonals();
+    int     GetNextHalfEdge(int half_edge) const;
+    bool    BuildFaces();
+    bool    TriangulateFace(const int* face, int face_size);
+    bool    AddTriangle(int i0, int i1, int i2);
+    int     GetEdgeUpper(int edge) const    { int i1 = (edge + 1 == _PointsCount) ? 0 : edge + 1; return (_Rank[edge] < _Rank[i1]) ? edge : i1; }
+    int     GetEdgeLower(int edge) const    { int i1 = (edge + 1 == _PointsCount) ? 0 : edge + 1; return (_Rank[edge] < _Rank[i1]) ? i1 : edge; }
+    int     GetHalfEdgeDest(int half_edge) const { return (half_edge < _PointsCount) ? ((half_edge + 1 == _PointsCount) ? 0 : half_edge + 1) : _Diagonals[(half_edge - _PointsCount) ^ 1]; }
+
+    // Internal members
+    int                             _PointsCount;
+    ImVec2*                         _Pos;               // points_count, Y flipped, counter-clockwise
+    ImTriangulatorMonotoneVertex*   _Sorted;            // points_count, sorted top to bottom
+    int*                            _Rank;              // points_count, index in _Sorted[]
+    int*                            _Type;              // points_count, ImTriangulatorMonotoneVertexType
+    int*                            _Helper;            // points_count, per edge
+    int*                            _Status;            // points_count, edges crossing sweep line, sorted left to right
+    int                             _StatusSize;
+    int*                            _Diagonals;         // points_count * 2, pairs of vertex indices
+    int                             _DiagonalsCount;
+    int*                            _OutOffsets;        // points_count + 1, per vertex offset into _Out[]
+    int*                            _Out;               // points_count * 3, outgoing half edges. Half edge N < points_count is polygon edge N, then diagonals in both directions.
+    int*                            _FaceStamp;         // points_count
+    int*                            _Face;              // points_count
+    int*                            _FaceSorted;        // points_count
+    int*                            _Stack;             // points_count
+    unsigned char*                  _FaceChain;         // points_count, per vertex: 0 left chain, 1 right chain
+    unsigned char*                  _Visited;           // points_count * 3, per half edge
+    int*                            _SourceIndex;       // points_count, index in source points[]
+    unsigned int*                   _OutTriangles;
+    int                             _OutTrianglesCount;
+};
+
+static int IMGUI_CDECL ImTriangulatorMonotoneVertexCompare(const void* lhs, const void* rhs)
+{
+    // Top to bottom, then left to right
+    const ImTriangulatorMonotoneVertex* a = (const ImTriangulatorMonotoneVertex*)lhs;
+    const ImTriangulatorMonotoneVertex* b = (const ImTriangulatorMonotoneVertex*)rhs;
+    if (a->Pos.y != b->Pos.y)
+        return (a->Pos.y > b->Pos.y) ? -1 : +1;
+    if (a->Pos.x != b->Pos.x)
+        return (a->Pos.x < b->Pos.x) ? -1 : +1;
+    return a->Index - b->Index;
+}
+
+static inline float ImTriangulatorMonotoneCross(const ImVec2& a, const ImVec2& b, const ImVec2& c) { return (b.x - a.x) * (c.y - b.y) - (b.y - a.y) * (c.x - b.x); }
+
+bool ImTriangulatorMonotone::Triangulate(const ImVec2* points, int points_count, void* scratch_buffer, unsigned int* out_triangles)
+{
+    IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
+    const int n = points_count;
+    _PointsCount    = n;
+    _Pos            = (ImVec2*)scratch_buffer;
+    _Sorted         = (ImTriangulatorMonotoneVertex*)(_Pos + n);
+    _Rank           = (int*)(_Sorted + n);
+    _Type           = _Rank + n;
+    _Helper         = _Type + n;
+    _Status         = _Helper + n;
+    _Diagonals      = _Status + n;
+    _OutOffsets     = _Diagonals + n * 2;
+    _Out            = _OutOffsets + n + 1;
+    _FaceStamp      = _Out + n * 3;
+    _Face           = _FaceStamp + n;
+    _FaceSorted     = _Face + n;
+    _Stack          = _FaceSorted + n;
+    _FaceChain      = (unsigned char*)(_Stack + n);
+    _Visited        = _FaceChain + n;
+    _SourceIndex    = (int*)(void*)(_Visited + n * 3);
+    _StatusSize = _DiagonalsCount = 0;
+    _OutTriangles = out_triangles;
+    _OutTrianglesCount = 0;
+
+    BuildVertices(points, points_count);
+    if (_PointsCount < 3)
+        return false;
+    BuildDiagonals();
+    if (!BuildFaces() || _OutTrianglesCount != _PointsCount - 2)
+        return false;
+
+    // Remap to source indexes. Pad with empty triangles for duplicate points that were removed, so output size is always (points_count - 2).
+    for (int i = 0; i < _OutTrianglesCount * 3; i++)
+        out_triangles[i] = (unsigned int)_SourceIndex[out_triangles[i]];
+    for (int i = _OutTrianglesCount * 3; i < (points_count - 2) * 3; i++)
+        out_triangles[i] = 0;
+    return true;
+}
+
+void ImTriangulatorMonotone::BuildVertices(const ImVec2* points, int points_count)
+{
+    // Flip Y so that 'above' is +Y and make polygon counter-clockwise, matching reference algorithm.
+    // Remove consecutive duplicate points, which would make vertex classification ambiguous.
+    float area = 0.0f;
+    for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        area += points[i0].x * points[i1].y - points[i1].x * points[i0].y;
+    const bool flip = (area > 0.0f);
+    int n = 0;
+    for (int i = 0; i < points_count; i++)
+    {
+        const int src_i = flip ? points_count - 1 - i : i;
+        const ImVec2 p(points[src_i].x, -points[src_i].y);
+        if (n > 0 && p.x == _Pos[n - 1].x && p.y == _Pos[n - 1].y)
+            continue;
+        _Pos[n] = p;
+        _SourceIndex[n++] = src_i;
+    }
+    while (n > 1 && _Pos[n - 1].x == _Pos[0].x && _Pos[n - 1].y == _Pos[0].y)
+        n--;
+    _PointsCount = n;
+    if (n < 3)
+        return;
+
+    for (int i = 0; i < n; i++)
+    {
+        _Sorted[i].Pos = _Pos[i];
+        _Sorted[i].Index = i;
+    }
+    ImQsort(_Sorted, (size_t)n, sizeof(ImTriangulatorMonotoneVertex), ImTriangulatorMonotoneVertexCompare);
+    for (int r = 0; r < n; r++)
+        _Rank[_Sorted[r].Index] = r;
+
+    for (int i0 = n - 1, i1 = 0; i1 < n; i0 = i1++)
+    {
+        const int i2 = (i1 + 1 == n) ? 0 : i1 + 1;
+        const bool prev_below = _Rank[i0] > _Rank[i1];
+        const bool next_below = _Rank[i2] > _Rank[i1];
+        const bool convex = ImTriangulatorMonotoneCross(_Pos[i0], _Pos[i1], _Pos[i2]) > 0.0f;
+        if (prev_below && next_below)
+            _Type[i1] = convex ? ImTriangulatorMonotoneVertexType_Start : ImTriangulatorMonotoneVertexType_Split;
+        else if (!prev_below && !next_below)
+            _Type[i1] = convex ? ImTriangulatorMonotoneVertexType_End : ImTriangulatorMonotoneVertexType_Merge;
+        else
+            _Type[i1] = ImTriangulatorMonotoneVertexType_Regular;
+    }
+}
+
+void ImTriangulatorMonotone::AddDiagonal(int i0, int i1)
+{
+    if (_DiagonalsCount >= _PointsCount || i0 == i1)
+        return;
+    _Diagonals[_DiagonalsCount * 2 + 0] = i0;
+    _Diagonals[_DiagonalsCount * 2 + 1] = i1;
+    _DiagonalsCount++;
+}
+
+// Return position in _Status[] of the nearest edge left of vertex i, or -1. Status is sorted left to right.
+int ImTriangulatorMonotone::FindEdgeLeftOf(int i) const
+{
+    const ImVec2& p = _Pos[i];
+    int lo = 0, hi = _StatusSize;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        const int edge = _Status[mid];
+        if (ImTriangulatorMonotoneCross(_Pos[GetEdgeUpper(edge)], _Pos[GetEdgeLower(edge)], p) > 0.0f) // Upper->Lower->p turns left: edge is left of p
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo - 1;
+}
+
+void ImTriangulatorMonotone::InsertEdge(int edge)
+{
+    const int pos = FindEdgeLeftOf(GetEdgeUpper(edge)) + 1;
+    memmove(_Status + pos + 1, _Status + pos, (size_t)(_StatusSize - pos) * sizeof(int));
+    _Status[pos] = edge;
+    _StatusSize++;
+}
+
+void ImTriangulatorMonotone::RemoveEdge(int edge)
+{
+    for (int pos = 0; pos < _StatusSize; pos++)
+        if (_Status[pos] == edge)
+        {
+            memmove(_Status + pos, _Status + pos + 1, (size_t)(_StatusSize - pos - 1) * sizeof(int));
+            _StatusSize--;
+            return;
+        }
+}
+
+// Sweep top to bottom, adding diagonals to remove split and merge vertices.
+// Edge N goes from vertex N to vertex N+1. _Status[] only holds edges with polygon interior on their right.
+void ImTriangulatorMonotone::BuildDiagonals()
+{
+    const int n = _PointsCount;
+    for (int r = 0; r < n; r++)
+    {
+        const int i = _Sorted[r].Index;
+        const int edge_prev = (i == 0) ? n - 1 : i - 1;
+        const int edge_next = i;
+        switch (_Type[i])
+        {
+        case ImTriangulatorMonotoneVertexType_Start:
+            _Helper[edge_next] = i;
+            InsertEdge(edge_next);
+            break;
+        case ImTriangulatorMonotoneVertexType_End:
+            if (_Type[_Helper[edge_prev]] == ImTriangulatorMonotoneVertexType_Merge)
+                AddDiagonal(i, _Helper[edge_prev]);
+            RemoveEdge(edge_prev);
+            break;
+        case ImTriangulatorMonotoneVertexType_Split:
+            {
+                const int left_pos = FindEdgeLeftOf(i);
+                if (left_pos >= 0)
+                {
+                    AddDiagonal(i, _Helper[_Status[left_pos]]);
+                    _Helper[_Status[left_pos]] = i;
+                }
+                _Helper[edge_next] = i;
+                InsertEdge(edge_next);
+                break;
+            }
+        case ImTriangulatorMonotoneVertexType_Merge:
+            {
+                if (_Type[_Helper[edge_prev]] == ImTriangulatorMonotoneVertexType_Merge)
+                    AddDiagonal(i, _Helper[edge_prev]);
+                RemoveEdge(edge_prev);
+                const int left_pos = FindEdgeLeftOf(i);
+                if (left_pos >= 0)
+                {
+                    if (_Type[_Helper[_Status[left_pos]]] == ImTriangulatorMonotoneVertexType_Merge)
+                        AddDiagonal(i, _Helper[_Status[left_pos]]);
+                    _Helper[_Status[left_pos]] = i;
+                }
+                break;
+            }
+        case ImTriangulatorMonotoneVertexType_Regular:
+            if (_Rank[edge_prev] < r) // Going down: interior is on the right
+            {
+                if (_Type[_Helper[edge_prev]] == ImTriangulatorMonotoneVertexType_Merge)
+                    AddDiagonal(i, _Helper[edge_prev]);
+                RemoveEdge(edge_prev);
+                _Helper[edge_next] = i;
+                InsertEdge(edge_next);
+            }
+            else
+            {
+                const int left_pos = FindEdgeLeftOf(i);
+                if (left_pos >= 0)
+                {
+                    if (_Type[_Helper[_Status[left_pos]]] == ImTriangulatorMonotoneVertexType_Merge)
+                        AddDiagonal(i, _Helper[_Status[left_pos]]);
+                    _Helper[_Status[left_pos]] = i;
+                }
+            }
+            break;
+        }
+    }
+}
+
+// Next half edge around the same face (interior on the left): first outgoing edge clockwise from the reverse of incoming edge.
+int ImTriangulatorMonotone::GetNextHalfEdge(int half_edge) const
+{
+    const int v = GetHalfEdgeDest(half_edge);
+    const int out_begin = _OutOffsets[v];
+    const int out_end = _OutOffsets[v + 1];
+    if (out_end - out_begin == 1)
+        return _Out[out_begin];
+
+    // Vertex has diagonals: pick smallest clockwise angle. Degree is small so we don't sort outgoing edges.
+    const int u = (half_edge < _PointsCount) ? half_edge : _Diagonals[half_edge - _PointsCount];
+    const ImVec2 ref = _Pos[u] - _Pos[v];
+    int best = -1;
+    float best_angle = FLT_MAX;
+    for (int n = out_begin; n < out_end; n++)
+    {
+        const ImVec2 dir = _Pos[GetHalfEdgeDest(_Out[n])] - _Pos[v];
+        float angle = ImAtan2(ref.x * dir.y - ref.y * dir.x, ref.x * dir.x + ref.y * dir.y); // Counter-clockwise angle from ref to dir
+        angle = (angle >= 0.0f) ? IM_PI * 2.0f - angle : -angle;                               // Clockwise angle, in ]0..2PI]
+        if (angle < best_angle)
+        {
+            best_angle = angle;
+            best = _Out[n];
+        }
+    }
+    return best;
+}
+
+// Split polygon along diagonals into faces, and triangulate each of them.
+bool ImTriangulatorMonotone::BuildFaces()
+{
+    const int n = _PointsCount;
+    const int half_edges_count = n + _DiagonalsCount * 2;
+
+    // Build outgoing half edges per vertex
+    for (int i = 0; i <= n; i++)
+        _OutOffsets[i] = 0;
+    for (int i = 0; i < _DiagonalsCount * 2; i++)
+        _OutOffsets[_Diagonals[i] + 1]++;
+    for (int i = 0; i < n; i++)
+        _OutOffsets[i + 1] += _OutOffsets[i] + 1;
+    for (int i = 0; i < n; i++)
+    {
+        _Out[_OutOffsets[i]] = i;
+        _FaceStamp[i] = _OutOffsets[i] + 1; // Use as write cursor for now
+    }
+    for (int i = 0; i < _DiagonalsCount * 2; i++)
+        _Out[_FaceStamp[_Diagonals[i]]++] = n + i;
+    for (int i = 0; i < n; i++)
+        _FaceStamp[i] = -1;
+    memset(_Visited, 0, (size_t)half_edges_count);
+
+    for (int first_half_edge = 0; first_half_edge < half_edges_count; first_half_edge++)
+    {
+        if (_Visited[first_half_edge])
+            continue;
+        int face_size = 0;
+        int half_edge = first_half_edge;
+        do
+        {
+            if (half_edge < 0 || _Visited[half_edge] || face_size == n)
+                return false;
+            const int v = (half_edge < n) ? half_edge : _Diagonals[half_edge - n];
+            if (_FaceStamp[v] == first_half_edge)
+                return false;
+            _Visited[half_edge] = 1;
+            _FaceStamp[v] = first_half_edge;
+            _Face[face_size++] = v;
+            half_edge = GetNextHalfEdge(half_edge);
+        }
+        while (half_edge != first_half_edge);
+        if (face_size < 3 || !TriangulateFace(_Face, face_size))
+            return false;
+    }
+    return true;
+}
+
+bool ImTriangulatorMonotone::AddTriangle(int i0, int i1, int i2)
+{
+    if (_OutTrianglesCount == _PointsCount - 2)
+        return false;
+    unsigned int* tri = _OutTriangles + _OutTrianglesCount * 3;
+    tri[0] = (unsigned int)i0;
+    tri[1] = (unsigned int)i1;
+    tri[2] = (unsigned int)i2;
+    _OutTrianglesCount++;
+    return true;
+}
+
+// Triangulate y-monotone polygon
+bool ImTriangulatorMonotone::TriangulateFace(const int* face, int face_size)
+{
+    // Find top and bottom vertices. Walking forward from top to bottom follows left chain, the rest is right chain.
+    int top = 0, bottom = 0;
+    for (int n = 1; n < face_size; n++)
+    {
+        if (_Rank[face[n]] < _Rank[face[top]])
+            top = n;
+        if (_Rank[face[n]] > _Rank[face[bottom]])
+            bottom = n;
+    }
+
+    // Merge both chains, sorted top to bottom
+    const int left_count = ((bottom - top + face_size) % face_size) + 1;
+    int left = top, right = (top == 0) ? face_size - 1 : top - 1;
+    for (int n = 0, left_n = 0; n < face_size; n++)
+    {
+        const bool take_left = (left_n < left_count) && (n - left_n == face_size - left_count || _Rank[face[left]] < _Rank[face[right]]);
+        if (take_left)
+        {
+            _FaceSorted[n] = face[left];
+            _FaceChain[face[left]] = 0;
+            left = (left + 1 == face_size) ? 0 : left + 1;
+            left_n++;
+        }
+        else
+        {
+            _FaceSorted[n] = face[right];
+            _FaceChain[face[right]] = 1;
+            right = (right == 0) ? face_size - 1 : right - 1;
+        }
+    }
+
+    int stack_size = 0;
+    _Stack[stack_size++] = _FaceSorted[0];
+    _Stack[stack_size++] = _FaceSorted[1];
+    for (int n = 2; n < face_size - 1; n++)
+    {
+        const int v = _FaceSorted[n];
+        if (_FaceChain[v] != _FaceChain[_Stack[stack_size - 1]])
+        {
+            // Opposite chain: fan to whole stack
+            for (; stack_size > 1; stack_size--)
+                if (!AddTriangle(v, _Stack[stack_size - 1], _Stack[stack_size - 2]))
+                    return false;
+            _Stack[0] = _FaceSorted[n - 1];
+            _Stack[1] = v;
+            stack_size = 2;
+        }
+        else
+        {
+            // Same chain: clip while diagonal is inside polygon
+            int last = _Stack[--stack_size];
+            while (stack_size > 0)
+            {
+                const int top_v = _Stack[stack_size - 1];
+                const float cross = (_FaceChain[v] == 0) ? ImTriangulatorMonotoneCross(_Pos[top_v], _Pos[last], _Pos[v]) : ImTriangulatorMonotoneCross(_Pos[v], _Pos[last], _Pos[top_v]);
+                if (cross <= 0.0f)
+                    break;
+                if (!AddTriangle(v, last, top_v))
+                    return false;
+                last = _Stack[--stack_size];
+            }
+            _Stack[stack_size++] = last;
+            _Stack[stack_size++] = v;
+        }
+    }
+
+    // Last vertex: fan to remaining stack
+    const int v = _FaceSorted[face_size - 1];
+    for (; stack_size > 1; stack_size--)
+        if (!AddTriangle(v, _Stack[stack_size - 1], _Stack[stack_size - 2]))
+            return false;
+    return true;
+}
+
+// Return true if all turns are in the same direction and the outline winds only once (no self-intersection).
+// Collinear and duplicate points are ignored. Fully degenerated polygons are not reported as convex.
+static bool ImPolygonIsConvex(const ImVec2* points, int points_count)
+{
+    int turn_sign = 0;
+    int dir_x_first = 0, dir_x = 0, dir_x_flips = 0;
+    int dir_y_first = 0, dir_y = 0, dir_y_flips = 0;
+    ImVec2 p0 = points[points_count - 2];
+    ImVec2 p1 = points[points_count - 1];
+    for (int i = 0; i < points_count; i++)
+    {
+        const ImVec2 p2 = points[i];
+        const float dx = p2.x - p1.x;
+        const float dy = p2.y - p1.y;
+        if (dx != 0.0f)
+        {
+            const int sign = (dx > 0.0f) ? +1 : -1;
+            if (dir_x == 0)
+                dir_x_first = sign;
+            else if (dir_x != sign)
+                dir_x_flips++;
+            dir_x = sign;
+        }
+        if (dy != 0.0f)
+        {
+            const int sign = (dy > 0.0f) ? +1 : -1;
+            if (dir_y == 0)
+                dir_y_first = sign;
+            else if (dir_y != sign)
+                dir_y_flips++;
+            dir_y = sign;
+        }
+        const float cross = (p1.x - p0.x) * dy - (p1.y - p0.y) * dx;
+        if (cross != 0.0f)
+        {
+            const int sign = (cross > 0.0f) ? +1 : -1;
+            if (turn_sign == 0)
+                turn_sign = sign;
+            else if (turn_sign != sign)
+                return false;
+        }
+        p0 = p1;
+        p1 = p2;
+    }
+    if (dir_x != dir_x_first)
+        dir_x_flips++;
+    if (dir_y != dir_y_first)
+        dir_y_flips++;
+    return turn_sign != 0 && dir_x_flips <= 2 && dir_y_flips <= 2;
+}
+
+// Triangulate into 'temp_buffer', returning (points_count - 2) triangles as relative indexes.
+static const unsigned int* ImTriangulateConcavePoly(ImVector<ImVec2>& temp_buffer, const ImVec2* points, int points_count, int monotone_min_points)
+{
+    const int triangles_size = (ImTriangulator::EstimateTriangleCount(points_count) * 3 * (int)sizeof(unsigned int) + (int)sizeof(ImVec2) - 1) & ~((int)sizeof(ImVec2) - 1);
+    const bool use_monotone = (points_count >= monotone_min_points);
+    const int scratch_size = use_monotone ? ImMax(ImTriangulatorMonotone::EstimateScratchBufferSize(points_count), ImTriangulator::EstimateScratchBufferSize(points_count)) : ImTriangulator::EstimateScratchBufferSize(points_count);
+    temp_buffer.reserve_discard((triangles_size + scratch_size + (int)sizeof(ImVec2)) / (int)sizeof(ImVec2));
+    unsigned int* triangles = (unsigned int*)(void*)temp_buffer.Data;
+    void* scratch_buffer = (void*)((char*)temp_buffer.Data + triangles_size);
+    if (use_monotone)
+    {
+        ImTriangulatorMonotone triangulator;
+        if (triangulator.Triangulate(points, points_count, scratch_buffer, triangles))
+            return triangles;
+    }
+
+    // Ear-clipping, also used as fallback when geometry is degenerated
+    ImTriangulator triangulator;
+    triangulator.Init(points, points_count, scratch_buffer);
+    for (unsigned int* triangle = triangles; triangulator._TrianglesLeft > 0; triangle += 3)
+        triangulator.GetNextTriangle(triangle);
+    return triangles;
+}
+
+// Triangulate a simple polygon (no self-interaction, no holes).
+// - Convex polygons are forwarded to AddConvexPolyFilled().
+// - Small polygons use ear-clipping, O(N^2). Large polygons use monotone decomposition, O(N log N). See ImDrawListSharedData::ConcaveMonotoneMinPoints.
+// (Reminder: we don't perform any coarse clipping/culling of polygons in ImDrawList layer!
 // It is up to caller to ensure not making costly calls that will be outside of visible area.
 // As concave fill is noticeably more expensive than other primitives, be mindful of this...
 // Caller can build AABB of points, and avoid filling if 'draw_list->_CmdHeader.ClipRect.Overlays(points_bb) == false')
@@ -2008,10 +2873,14 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
 {
     if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImPolygonIsConvex(points, points_count))
+    {
+        AddConvexPolyFilled(points, points_count, col);
+        return;
+    }
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
-    ImTriangulator triangulator;
-    unsigned int triangle[3];
+    const int triangles_count = ImTriangulator::EstimateTriangleCount(points_count);
     if (Flags & ImDrawListFlags_AntiAliasedFill)
     {
         // Anti-aliased Fill
@@ -2025,15 +2894,12 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         unsigned int vtx_inner_idx = _VtxCurrentIdx;
         unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
 
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
-        while (triangulator._TrianglesLeft > 0)
+        const unsigned int* triangle = ImTriangulateConcavePoly(_Data->TempBuffer, points, points_count, _Data->ConcaveMonotoneMinPoints);
+        for (int n = 0; n < triangles_count; n++, triangle += 3)
         {
-            triangulator.GetNextTriangle(triangle);
             _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (triangle[0] << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (triangle[1] << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_inner_idx + (triangle[2] << 1));
             _IdxWritePtr += 3;
         }
-
         // Compute normals
         _Data->TempBuffer.reserve_discard(points_count);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
@@ -2082,11 +2948,9 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
             _VtxWritePtr++;
         }
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
-        while (triangulator._TrianglesLeft > 0)
+        const unsigned int* triangle = ImTriangulateConcavePoly(_Data->TempBuffer, points, points_count, _Data->ConcaveMonotoneMinPoints);
+        for (int n = 0; n < triangles_count; n++, triangle += 3)
         {
-            triangulator.GetNextTriangle(triangle);
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx + triangle[0]); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + triangle[1]); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + triangle[2]);
             _IdxWritePtr += 3;
         }
@@ -2108,6 +2972,7 @@ void ImDrawListSplitter::ClearFreeMemory()
             memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer, don't destruct again
         _Channels[i]._CmdBuffer.clear();
         _Channels[i]._IdxBuffer.clear();
+        _Channels[i]._InstBuffer.clear();
     }
     _Current = 0;
     _Count = 1;
@@ -2126,7 +2991,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
     }
     _Count = channels_count;
 
-    // Channels[] (24/32 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
+    // Channels[] (36/48 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer/_InstBuffer
     // The content of Channels[0] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
     // When we switch to the next channel, we'll copy draw_list->_CmdBuffer/_IdxBuffer into Channels[0] and then Channels[1] into draw_list->CmdBuffer/_IdxBuffer
     memset(&_Channels[0], 0, sizeof(ImDrawChannel));
@@ -2140,6 +3005,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
         {
             _Channels[i]._CmdBuffer.resize(0);
             _Channels[i]._IdxBuffer.resize(0);
+            _Channels[i]._InstBuffer.resize(0);
         }
     }
 }
@@ -2153,52 +3019,63 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // Calculate upper bound of our final buffer sizes, so we can resize once then write everything in a single pass.
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
-    ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
+    int new_inst_buffer_count = 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
-            ch._CmdBuffer.pop_back();
-
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
-        {
-            // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
-            // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
-            {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
-            }
-        }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
         new_cmd_buffer_count += ch._CmdBuffer.Size;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
-        {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
-        }
+        new_inst_buffer_count += ch._InstBuffer.Size;
     }
-    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
+    const int cmd_buffer_base = draw_list->CmdBuffer.Size;
+    draw_list->CmdBuffer.resize(cmd_buffer_base + new_cmd_buffer_count);
     draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+    draw_list->InstBuffer.resize(draw_list->InstBuffer.Size + new_inst_buffer_count);
 
     // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
-    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
+    // Also fix the incorrect IdxOffset/InstOffset values in each command.
+    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + cmd_buffer_base;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    ImDrawInstance* inst_write = draw_list->InstBuffer.Data + draw_list->InstBuffer.Size - new_inst_buffer_count;
+    ImDrawCmd* last_cmd = (cmd_buffer_base > 0) ? cmd_write - 1 : NULL;
+    unsigned int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
+    unsigned int inst_offset = last_cmd ? last_cmd->InstOffset + last_cmd->InstCount : 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        const ImDrawCmd* cmd_read = ch._CmdBuffer.Data;
+        const ImDrawCmd* cmd_read_end = ch._CmdBuffer.Data + ch._CmdBuffer.Size;
+        if (cmd_read < cmd_read_end && cmd_read_end[-1].ElemCount == 0 && cmd_read_end[-1].InstCount == 0 && cmd_read_end[-1].UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+            cmd_read_end--;
+
+        // Merge previous channel last draw command with current channel first draw command if matching.
+        // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
+        // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
+        if (cmd_read < cmd_read_end && last_cmd != NULL)
+            if (ImDrawCmd_HeaderCompare(last_cmd, cmd_read) == 0 && ImDrawCmd_AreSameKind(last_cmd, cmd_read) && last_cmd->UserCallback == NULL && cmd_read->UserCallback == NULL)
+            {
+                last_cmd->ElemCount += cmd_read->ElemCount;
+                last_cmd->InstCount += cmd_read->InstCount;
+                idx_offset += cmd_read->ElemCount;
+                inst_offset += cmd_read->InstCount;
+                cmd_read++;
+            }
+        for (; cmd_read < cmd_read_end; cmd_read++, cmd_write++)
+        {
+            *cmd_write = *cmd_read;
+            cmd_write->IdxOffset = idx_offset;
+            cmd_write->InstOffset = inst_offset;
+            idx_offset += cmd_read->ElemCount;
+            inst_offset += cmd_read->InstCount;
+            last_cmd = cmd_write;
+        }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+        if (int sz = ch._InstBuffer.Size) { memcpy(inst_write, ch._InstBuffer.Data, sz * sizeof(ImDrawInstance)); inst_write += sz; }
     }
+    draw_list->CmdBuffer.Size = (int)(cmd_write - draw_list->CmdBuffer.Data); // Shrink to number of commands actually written (merged and unused commands are skipped)
     draw_list->_IdxWritePtr = idx_write;
 
     // Ensure there's always a non-callback draw command trailing the command-buffer
@@ -2207,7 +3084,7 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount == 0)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->InstCount == 0)
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TexRef, VtxOffset
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
@@ -2221,22 +3098,29 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     if (_Current == idx)
         return;
 
-    // Overwrite ImVector (12/16 bytes), four times. This is merely a silly optimization instead of doing .swap()
+    // Overwrite ImVector (12/16 bytes), six times. This is merely a silly optimization instead of doing .swap()
     memcpy(&_Channels.Data[_Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&_Channels.Data[_Current]._IdxBuffer, &draw_list->IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&_Channels.Data[_Current]._InstBuffer, &draw_list->InstBuffer, sizeof(draw_list->InstBuffer));
     _Current = idx;
     memcpy(&draw_list->CmdBuffer, &_Channels.Data[idx]._CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&draw_list->IdxBuffer, &_Channels.Data[idx]._IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&draw_list->InstBuffer, &_Channels.Data[idx]._InstBuffer, sizeof(draw_list->InstBuffer));
     draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = (draw_list->CmdBuffer.Size == 0) ? NULL : &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
     if (curr_cmd == NULL)
         draw_list->AddDrawCmd();
-    else if (curr_cmd->ElemCount == 0)
+    else if (curr_cmd->ElemCount == 0 && curr_cmd->InstCount == 0)
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TexRef, VtxOffset
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
-        draw_list->AddDrawCmd();
+    {
+        // With ImDrawListFlags_CpuClipRects, keep using current command if it contains the clip rect (see _OnChangedClipRect())
+        const bool keep_cmd = (draw_list->Flags & ImDrawListFlags_CpuClipRects) && curr_cmd->TexRef == draw_list->_CmdHeader.TexRef && curr_cmd->VtxOffset == draw_list->_CmdHeader.VtxOffset && ImDrawCmd_ClipRectContains(curr_cmd->ClipRect, draw_list->_CmdHeader.ClipRect);
+        if (!keep_cmd)
+            draw_list->AddDrawCmd();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -2246,9 +3130,16 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
 void ImDrawData::Clear()
 {
     Valid = false;
-    CmdListsCount = TotalIdxCount = TotalVtxCount = 0;
+    CmdListsCount = TotalIdxCount = TotalVtxCount = TotalInstCount = 0;
     CmdLists.resize(0); // The ImDrawList are NOT owned by ImDrawData but e.g. by ImGuiContext, so we don't clear them.
-    DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f);
+    MergedVtxBuffer.resize(0);
+    MergedIdxBuffer.resize(0);
+    MergedInstBuffer.resize(0);
+    MergedCmdBuffer.resize(0);
+    MergedCmdParentLists.resize(0);
+    MergedIdxRebases.resize(0);
+    CompactVtxBuffer.resize(0);
+    DisplayPos = DisplaySize = FramebufferScale = CompactVtxOrigin = ImVec2(0.0f, 0.0f);
     OwnerViewport = NULL;
     Textures = NULL;
 }
@@ -2259,7 +3150,7 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
 {
     if (draw_list->CmdBuffer.Size == 0)
         return;
-    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
+    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].InstCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
         return;
 
     // Draw list sanity check. Detect mismatch between PrimReserve() calls and incrementing _VtxCurrentIdx, _VtxWritePtr etc.
@@ -2298,6 +3189,7 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     draw_data->CmdListsCount++;
     draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
     draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
+    draw_data->TotalInstCount += draw_list->InstBuffer.Size;
 }
 
 void ImDrawData::AddDrawList(ImDrawList* draw_list)
@@ -2307,6 +3199,236 @@ void ImDrawData::AddDrawList(ImDrawList* draw_list)
     ImGui::AddDrawListToDrawDataEx(this, &CmdLists, draw_list);
 }
 
+// Concatenate all CmdLists[] vertex/index buffers into MergedVtxBuffer/MergedIdxBuffer, so a renderer can upload the whole frame at once.
+// - Draw lists are still built into their own buffers: windows are appended to in interleaved order during the frame, so they can't be slices of a shared buffer.
+// - This adds one copy of all vertices/indices per frame, so Render() never calls it. Renderers should rather call WriteMergedBuffers() into their upload memory.
+// - Indices are kept relative to each draw list. Offsets of a given list are the running sums of previous lists' sizes (what backends call global_vtx_offset/global_idx_offset).
+// - Storage is kept between frames: after the first few frames this doesn't allocate.
+void ImDrawData::MergeBuffers()
+{
+    MergedVtxBuffer.resize(TotalVtxCount);
+    MergedIdxBuffer.resize(TotalIdxCount);
+    MergedInstBuffer.resize(TotalInstCount);
+    WriteMergedBuffers(MergedVtxBuffer.Data, MergedIdxBuffer.Data, MergedInstBuffer.Data);
+}
+
+// Write all CmdLists[] vertex/index/instance buffers concatenated in order, e.g. into a mapped GPU buffer. Any destination may be NULL.
+// Index ranges listed in MergedIdxRebases[] by BatchDrawCmds() are rebased while copying, so the output can be used with MergedCmdBuffer[].
+// Draw lists are never modified, so CmdLists[]->CmdBuffer stays valid with their own buffers.
+void ImDrawData::WriteMergedBuffers(ImDrawVert* vtx_dst, ImDrawIdx* idx_dst, ImDrawInstance* inst_dst) const
+{
+    const unsigned int* rebase = MergedIdxRebases.Data;
+    const unsigned int* rebase_end = MergedIdxRebases.Data + MergedIdxRebases.Size;
+    unsigned int idx_n = 0;
+    for (const ImDrawList* draw_list : CmdLists)
+    {
+        if (vtx_dst && draw_list->VtxBuffer.Size > 0)
+        {
+            memcpy(vtx_dst, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+            vtx_dst += draw_list->VtxBuffer.Size;
+        }
+        if (inst_dst && draw_list->InstBuffer.Size > 0)
+        {
+            memcpy(inst_dst, draw_list->InstBuffer.Data, (size_t)draw_list->InstBuffer.Size * sizeof(ImDrawInstance));
+            inst_dst += draw_list->InstBuffer.Size;
+        }
+        if (idx_dst == NULL)
+            continue;
+
+        // Copy indices up to the next rebased range, then the rebased range. Ranges never straddle two draw lists.
+        const ImDrawIdx* idx_read = draw_list->IdxBuffer.Data;
+        const unsigned int idx_list_end = idx_n + (unsigned int)draw_list->IdxBuffer.Size;
+        while (idx_n < idx_list_end)
+        {
+            const unsigned int copy_end = (rebase < rebase_end) ? ImMin(rebase[0], idx_list_end) : idx_list_end;
+            if (copy_end > idx_n)
+            {
+                memcpy(idx_dst, idx_read, (size_t)(copy_end - idx_n) * sizeof(ImDrawIdx));
+                idx_dst += copy_end - idx_n;
+                idx_read += copy_end - idx_n;
+                idx_n = copy_end;
+            }
+            if (idx_n < idx_list_end && rebase < rebase_end && rebase[0] == idx_n)
+            {
+                IM_ASSERT(rebase[0] + rebase[1] <= idx_list_end);
+                for (const ImDrawIdx* idx_read_end = idx_read + rebase[1]; idx_read < idx_read_end; idx_read++)
+                    *idx_dst++ = (ImDrawIdx)(*idx_read + rebase[2]);
+                idx_n += rebase[1];
+                rebase += 3;
+            }
+        }
+    }
+    IM_ASSERT(idx_dst == NULL || (idx_n == (unsigned int)TotalIdxCount && rebase == rebase_end)); // TotalIdxCount or MergedIdxRebases[] out of sync with CmdLists[]? Call BatchDrawCmds() again after modifying draw lists.
+}
+
+// [ALPHA] Merge compatible draw commands of consecutive draw lists into MergedCmdBuffer[], so e.g. 300 small windows sharing the font atlas may render in fewer draw calls.
+// Two commands may be merged when:
+// - they use the same texture and none is a callback (callbacks are copied as-is and break batches).
+// - they are of the same kind (triangles or instances) and contiguous in the concatenated index/instance buffers (always true for consecutive commands of the same kind).
+// - a single scissor rectangle gives the same result for all commands of the batch:
+//   - commands with geometry entirely inside their ClipRect only need the scissor to contain their geometry.
+//   - commands with geometry outside their ClipRect need the scissor to be exactly their ClipRect.
+//   (Clipping straddling geometry per-vertex would allow more merging, but we don't do it here).
+// - (16-bit indices) rebased indices still fit in ImDrawIdx.
+// Commands with an empty ClipRect draw nothing and are dropped. Merged commands need their indices rebased relative to the VtxOffset of their batch:
+// we only record those ranges in MergedIdxRebases[] and read geometry from the draw lists, so no merged buffers are needed here.
+// Renderers apply the rebasing when uploading, with MergeBuffers() or WriteMergedBuffers().
+void ImDrawData::BatchDrawCmds()
+{
+    MergedCmdBuffer.resize(0);
+    MergedCmdParentLists.resize(0);
+    MergedIdxRebases.resize(0);
+
+    ImDrawCmd* batch = NULL;
+    bool batch_clip_rect_fixed = false;     // Batch has commands with geometry outside their ClipRect: batch->ClipRect cannot change anymore.
+    ImRect batch_bounds;                    // Bounding box of commands with geometry inside their ClipRect, when !batch_clip_rect_fixed.
+    unsigned int global_vtx_offset = 0;
+    unsigned int global_idx_offset = 0;
+    unsigned int global_inst_offset = 0;
+    for (ImDrawList* draw_list : CmdLists)
+    {
+        for (const ImDrawCmd& src_cmd : draw_list->CmdBuffer)
+        {
+            if (src_cmd.UserCallback != NULL)
+            {
+                MergedCmdBuffer.push_back(src_cmd);
+                MergedCmdBuffer.back().VtxOffset += global_vtx_offset;
+                MergedCmdBuffer.back().IdxOffset += global_idx_offset;
+                MergedCmdBuffer.back().InstOffset += global_inst_offset;
+                MergedCmdParentLists.push_back(draw_list);
+                batch = NULL;
+                continue;
+            }
+            const ImRect clip_rect(src_cmd.ClipRect);
+            if ((src_cmd.ElemCount == 0 && src_cmd.InstCount == 0) || clip_rect.Max.x <= clip_rect.Min.x || clip_rect.Max.y <= clip_rect.Min.y)
+                continue;
+
+            // Measure geometry
+            const bool is_inst = (src_cmd.InstCount != 0);
+            const unsigned int vtx_offset = global_vtx_offset + src_cmd.VtxOffset;
+            const unsigned int idx_offset = global_idx_offset + src_cmd.IdxOffset;
+            const unsigned int inst_offset = global_inst_offset + src_cmd.InstOffset;
+            const ImDrawIdx* idx_begin = draw_list->IdxBuffer.Data + src_cmd.IdxOffset;
+            const ImDrawIdx* idx_end = idx_begin + src_cmd.ElemCount;
+            const ImDrawVert* vtx_base = draw_list->VtxBuffer.Data + src_cmd.VtxOffset;
+            unsigned int idx_max = 0;
+            ImRect bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+            for (const ImDrawIdx* idx_p = idx_begin; idx_p < idx_end; idx_p++)
+            {
+                bounds.Add(vtx_base[*idx_p].pos);
+                idx_max = ImMax(idx_max, (unsigned int)*idx_p);
+            }
+            for (const ImDrawInstance* inst_p = draw_list->InstBuffer.Data + src_cmd.InstOffset; inst_p < draw_list->InstBuffer.Data + src_cmd.InstOffset + src_cmd.InstCount; inst_p++)
+            {
+                bounds.Add(inst_p->pos_min);
+                bounds.Add(inst_p->pos_max);
+            }
+            const bool in_clip_rect = clip_rect.Contains(bounds);
+
+            // Merge into current batch?
+            bool is_sequential;
+            if (batch == NULL)
+                is_sequential = false;
+            else if (is_inst)
+                is_sequential = (batch->InstCount != 0 && batch->InstOffset + batch->InstCount == inst_offset);
+            else
+                is_sequential = (batch->ElemCount != 0 && batch->IdxOffset + batch->ElemCount == idx_offset && vtx_offset >= batch->VtxOffset);
+            if (is_sequential && memcmp(&batch->TexRef, &src_cmd.TexRef, sizeof(ImTextureRef)) == 0)
+            {
+                const unsigned int idx_rebase = is_inst ? 0 : vtx_offset - batch->VtxOffset;
+                bool can_merge = (sizeof(ImDrawIdx) == 4 || idx_max + idx_rebase <= 0xFFFF);
+                ImRect batch_clip_rect(batch->ClipRect);
+                if (batch_clip_rect_fixed)
+                {
+                    can_merge &= in_clip_rect ? batch_clip_rect.Contains(bounds) : (batch->ClipRect == src_cmd.ClipRect);
+                }
+                else if (in_clip_rect)
+                {
+                    batch_clip_rect.Add(clip_rect);
+                }
+                else
+                {
+                    can_merge &= clip_rect.Contains(batch_bounds);
+                    batch_clip_rect = clip_rect;
+                }
+                if (can_merge)
+                {
+                    if (idx_rebase != 0)
+                    {
+                        // Extend previous range when contiguous within the same draw list
+                        unsigned int* last = MergedIdxRebases.Size > 0 ? &MergedIdxRebases[MergedIdxRebases.Size - 3] : NULL;
+                        if (last && last[0] >= global_idx_offset && last[0] + last[1] == idx_offset && last[2] == idx_rebase)
+                            last[1] += src_cmd.ElemCount;
+                        else
+                        {
+                            MergedIdxRebases.push_back(idx_offset);
+                            MergedIdxRebases.push_back(src_cmd.ElemCount);
+                            MergedIdxRebases.push_back(idx_rebase);
+                        }
+                    }
+                    batch->ClipRect = batch_clip_rect.ToVec4();
+                    batch->ElemCount += src_cmd.ElemCount;
+                    batch->InstCount += src_cmd.InstCount;
+                    batch_clip_rect_fixed |= !in_clip_rect;
+                    batch_bounds.Add(bounds);
+                    continue;
+                }
+            }
+
+            // Start a new batch
+            MergedCmdBuffer.push_back(src_cmd);
+            MergedCmdParentLists.push_back(draw_list);
+            batch = &MergedCmdBuffer.back();
+            batch->VtxOffset = vtx_offset;
+            batch->IdxOffset = idx_offset;
+            batch->InstOffset = inst_offset;
+            batch_clip_rect_fixed = !in_clip_rect;
+            batch_bounds = bounds;
+        }
+        global_vtx_offset += draw_list->VtxBuffer.Size;
+        global_idx_offset += draw_list->IdxBuffer.Size;
+        global_inst_offset += draw_list->InstBuffer.Size;
+    }
+
+    // Merged buffers filled before this call don't have rebased indices
+    if (MergedIdxBuffer.Size > 0 && MergedIdxRebases.Size > 0)
+        MergeBuffers();
+}
+
+// [ALPHA] Convert all CmdLists[] vertices into CompactVtxBuffer[] (12 bytes ImDrawVertCompact instead of 20 bytes ImDrawVert), for renderers where upload bandwidth matters (e.g. remote/streaming sessions).
+// - Positions are stored as fixed-point relative to CompactVtxOrigin (center of the viewport): renderers fold the conversion into their projection matrix.
+// - Vertices are in the same order as MergedVtxBuffer, so MergedIdxBuffer and MergedCmdBuffer[] may be used as-is. We don't fill MergedIdxBuffer here:
+//   renderers use each draw list's IdxBuffer (e.g. OpenGL3 backend), write indices with WriteMergedBuffers(), or read a slice of CompactVtxBuffer per draw list (e.g. misc/remote/ encoder).
+// - If any vertex doesn't fit (e.g. far outside of the viewport, or uv outside of 0..1 when using a repeating texture) we bail out: the renderer should use regular vertices this frame.
+//   With the default IM_DRAWVERT_COMPACT_POS_SCALE this happens whenever a vertex is more than 4096 units away from the center of the viewport,
+//   e.g. with a viewport larger than 8192 units (large high-DPI framebuffers where DisplaySize is in pixels, or spanning multiple monitors).
+bool ImDrawData::BuildCompactVtxBuffer()
+{
+    CompactVtxOrigin = ImFloor(DisplayPos + DisplaySize * 0.5f);
+    CompactVtxBuffer.resize(TotalVtxCount);
+    ImDrawVertCompact* vtx_write = CompactVtxBuffer.Data;
+    for (ImDrawList* draw_list : CmdLists)
+    {
+        for (const ImDrawVert* vtx_read = draw_list->VtxBuffer.Data, *vtx_read_end = vtx_read + draw_list->VtxBuffer.Size; vtx_read < vtx_read_end; vtx_read++, vtx_write++)
+        {
+            const float x = (vtx_read->pos.x - CompactVtxOrigin.x) * IM_DRAWVERT_COMPACT_POS_SCALE + 0.5f; // Round to nearest
+            const float y = (vtx_read->pos.y - CompactVtxOrigin.y) * IM_DRAWVERT_COMPACT_POS_SCALE + 0.5f;
+            if (!(x >= -32768.0f && x < 32768.0f && y >= -32768.0f && y < 32768.0f && vtx_read->uv.x >= 0.0f && vtx_read->uv.x <= 1.0f && vtx_read->uv.y >= 0.0f && vtx_read->uv.y <= 1.0f)) // Also catches NaN
+            {
+                CompactVtxBuffer.resize(0);
+                return false;
+            }
+            vtx_write->pos[0] = (ImS16)ImFloor(x);
+            vtx_write->pos[1] = (ImS16)ImFloor(y);
+            vtx_write->uv[0] = (ImU16)(vtx_read->uv.x * 65535.0f + 0.5f);
+            vtx_write->uv[1] = (ImU16)(vtx_read->uv.y * 65535.0f + 0.5f);
+            vtx_write->col = vtx_read->col;
+        }
+    }
+    IM_ASSERT(vtx_write == CompactVtxBuffer.Data + CompactVtxBuffer.Size); // TotalVtxCount out of sync with CmdLists[]?
+    return true;
+}
+
 // For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
 void ImDrawData::DeIndexAllBuffers()
 {
@@ -2324,6 +3446,13 @@ void ImDrawData::DeIndexAllBuffers()
         cmd_list->IdxBuffer.resize(0);
         TotalVtxCount += cmd_list->VtxBuffer.Size;
     }
+    MergedVtxBuffer.resize(0); // Invalidate merged buffers
+    MergedIdxBuffer.resize(0);
+    MergedInstBuffer.resize(0);
+    MergedCmdBuffer.resize(0);
+    MergedCmdParentLists.resize(0);
+    MergedIdxRebases.resize(0);
+    CompactVtxBuffer.resize(0);
 }
 
 // Helper to scale the ClipRect field of each ImDrawCmd.
@@ -2561,6 +3690,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontBaked_BuildGrowIndex()
 // - ImFontBaked_BuildLoadGlyph()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
+// - ImFontAtlasBuildParallelPreloadGlyphRanges()
 // - ImFontAtlasDebugLogTextureRequests()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasGetFontLoaderForStbTruetype()
@@ -3078,6 +4208,9 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg_in)
 // Default font TTF is compressed with stb_compress then base85 encoded (see misc/fonts/binary_to_compressed_c.cpp for encoder)
 static unsigned int stb_decompress_length(const unsigned char* input);
 static unsigned int stb_decompress(unsigned char* output, const unsigned char* input, unsigned int length);
+static bool         ImLz4IsCompressed(const unsigned char* input, int input_size);
+static unsigned int ImLz4DecompressLength(const unsigned char* input);
+static unsigned int ImLz4Decompress(unsigned char* output, const unsigned char* input, unsigned int input_size);
 static unsigned int Decode85Byte(char c)                                    { return c >= '\\' ? c-36 : c-35; }
 static void         Decode85(const unsigned char* src, unsigned char* dst)
 {
@@ -3164,9 +4297,20 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* font_data, int font_data_size, f
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
-    const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
+    // Data compressed with 'binary_to_compressed_c -lz4' is detected from its header.
+    const bool is_lz4 = ImLz4IsCompressed((const unsigned char*)compressed_ttf_data, compressed_ttf_size);
+    const unsigned int buf_decompressed_size = is_lz4 ? ImLz4DecompressLength((const unsigned char*)compressed_ttf_data) : stb_decompress_length((const unsigned char*)compressed_ttf_data);
     unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
-    stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
+    if (is_lz4)
+    {
+        unsigned int ret = ImLz4Decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
+        IM_ASSERT(ret == buf_decompressed_size && "Corrupted compressed data!");
+        IM_UNUSED(ret);
+    }
+    else
+    {
+        stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
+    }
 
     ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
     IM_ASSERT(font_cfg.FontData == NULL);
@@ -3424,6 +4568,8 @@ void ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas)
             baked->FindGlyph(font->FallbackChar);
         if (font->EllipsisChar != 0)
             baked->FindGlyph(font->EllipsisChar);
+        if (atlas->BuildParallelForFunc != NULL)
+            ImFontAtlasBuildParallelPreloadGlyphRanges(atlas, baked); // Rasterize in parallel, the loop below then only takes care of leftovers.
         for (ImFontConfig* src : font->Sources)
         {
             const ImWchar* ranges = src->GlyphRanges ? src->GlyphRanges : atlas->GetGlyphRangesDefault();
@@ -4497,6 +5643,136 @@ static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar code
     }
 }
 
+// One job per font source, see ImFontAtlasBuildParallelPreloadGlyphRanges()
+struct ImFontAtlasBuildParallelJob
+{
+    ImFontAtlas*                        Atlas;
+    ImFontConfig*                       Src;
+    ImFontBaked*                        Baked;
+    const ImFontLoader*                 Loader;
+    void*                               LoaderData;
+    int                                 SrcIdx;
+    ImVector<ImWchar>                   Codepoints;     // Input: pairs of (codepoint, remapped codepoint)
+    ImVector<ImFontGlyph>               Glyphs;         // Output
+    ImVector<ImFontAtlasGlyphBitmap>    Bitmaps;        // Output: one per glyph
+    ImVector<unsigned char>             Pixels;         // Output
+};
+
+// This may run on any thread: only touch data owned by the job.
+static void ImFontAtlasBuildParallelJobFunc(void* jobs_data, int job_n)
+{
+    ImFontAtlasBuildParallelJob* job = &((ImFontAtlasBuildParallelJob*)jobs_data)[job_n];
+    for (int n = 0; n < job->Codepoints.Size; n += 2)
+    {
+        ImFontGlyph glyph;
+        ImFontAtlasGlyphBitmap bitmap;
+        if (!job->Loader->FontBakedRasterizeGlyph(job->Atlas, job->Src, job->Baked, job->LoaderData, job->Codepoints[n + 1], &glyph, &bitmap, &job->Pixels))
+            continue; // Leave unloaded: will be attempted again through the regular path.
+        glyph.Codepoint = job->Codepoints[n];
+        glyph.SourceIdx = job->SrcIdx;
+        job->Glyphs.push_back(glyph);
+        job->Bitmaps.push_back(bitmap);
+    }
+}
+
+// Rasterize glyphs in all sources GlyphRanges[] using one job per source, dispatched with atlas->BuildParallelForFunc().
+// Packing and copying into the texture are done afterwards on the calling thread.
+// Glyphs which cannot be handled that way (e.g. auto-baked ellipsis) are left unloaded and will go through FindGlyph() as usual.
+void ImFontAtlasBuildParallelPreloadGlyphRanges(ImFontAtlas* atlas, ImFontBaked* baked)
+{
+    ImFont* font = baked->ContainerFont;
+    if (atlas->BuildParallelForFunc == NULL || atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
+        return;
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (loader->FontBakedRasterizeGlyph == NULL || loader->FontSrcContainsGlyph == NULL)
+            return;
+    }
+
+    ImVector<ImFontAtlasBuildParallelJob> jobs;
+    jobs.resize(font->Sources.Size);
+    memset((void*)jobs.Data, 0, sizeof(ImFontAtlasBuildParallelJob) * (size_t)jobs.Size);
+    char* loader_user_data_p = (char*)baked->FontLoaderDatas;
+    for (int src_n = 0; src_n < font->Sources.Size; src_n++)
+    {
+        ImFontAtlasBuildParallelJob* job = &jobs[src_n];
+        job->Atlas = atlas;
+        job->Src = font->Sources[src_n];
+        job->Baked = baked;
+        job->Loader = job->Src->FontLoader ? job->Src->FontLoader : atlas->FontLoader;
+        job->LoaderData = loader_user_data_p;
+        job->SrcIdx = src_n;
+        loader_user_data_p += job->Loader->FontBakedSrcLoaderDataSize;
+    }
+
+    // Assign each codepoint to the first source which has it, same as ImFontBaked_BuildLoadGlyph()
+    ImBitVector visited;
+    visited.Create(IM_UNICODE_CODEPOINT_MAX + 1);
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImWchar* ranges = src->GlyphRanges ? src->GlyphRanges : atlas->GetGlyphRangesDefault();
+        for (; ranges[0]; ranges += 2)
+            for (unsigned int c = ranges[0]; c <= ranges[1] && c <= IM_UNICODE_CODEPOINT_MAX; c++) //-V560
+            {
+                if (visited.TestBit((int)c))
+                    continue;
+                visited.SetBit((int)c);
+                if (c < (unsigned int)baked->IndexLookup.Size && baked->IndexLookup[c] != IM_FONTGLYPH_INDEX_UNUSED)
+                    continue;
+                ImWchar codepoint = (ImWchar)c;
+                ImFontAtlas_FontHookRemapCodepoint(atlas, font, &codepoint);
+                if (codepoint == font->EllipsisChar && font->EllipsisAutoBake)
+                    continue;
+                for (ImFontAtlasBuildParallelJob& job : jobs)
+                    if (!job.Src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(job.Src, codepoint))
+                        if (job.Loader->FontSrcContainsGlyph(atlas, job.Src, codepoint))
+                        {
+                            job.Codepoints.push_back((ImWchar)c);
+                            job.Codepoints.push_back(codepoint);
+                            break;
+                        }
+            }
+    }
+
+    // Run jobs
+    // Our allocation tracking is not thread-safe, disable it for the duration.
+    ImGuiContext* ctx = GImGui;
+    if (ctx)
+        ctx->DebugAllocInfo.SkipHook = true;
+    atlas->BuildParallelForFunc(atlas, jobs.Size, ImFontAtlasBuildParallelJobFunc, jobs.Data);
+    if (ctx)
+        ctx->DebugAllocInfo.SkipHook = false;
+
+    // Pack, copy and register glyphs
+    for (ImFontAtlasBuildParallelJob& job : jobs)
+    {
+        for (int glyph_n = 0; glyph_n < job.Glyphs.Size; glyph_n++)
+        {
+            ImFontGlyph* glyph = &job.Glyphs[glyph_n];
+            const ImFontAtlasGlyphBitmap* bitmap = &job.Bitmaps[glyph_n];
+            if (glyph->Visible)
+            {
+                ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, bitmap->Width, bitmap->Height);
+                if (pack_id == ImFontAtlasRectId_Invalid)
+                {
+                    // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+                    IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+                    continue;
+                }
+                glyph->PackId = pack_id;
+                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+                ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, job.Src, glyph, r, job.Pixels.Data + bitmap->PixelsOffset, bitmap->Format, bitmap->Width * ImTextureDataGetFormatBytesPerPixel(bitmap->Format));
+            }
+            ImFontAtlasBakedAddFontGlyph(atlas, baked, job.Src, glyph);
+        }
+        job.Codepoints.clear();
+        job.Glyphs.clear();
+        job.Bitmaps.clear();
+        job.Pixels.clear();
+    }
+}
+
 // The point of this indirection is to not be inlined in debug mode in order to not bloat inner loop.b
 IM_MSVC_RUNTIME_CHECKS_OFF
 static float BuildLoadGlyphGetAdvanceOrFallback(ImFontBaked* baked, unsigned int codepoint)
@@ -4622,8 +5898,10 @@ static bool ImGui_ImplStbTrueType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig
     return true;
 }
 
-static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+static bool ImGui_ImplStbTrueType_FontBakedRasterizeGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, ImFontAtlasGlyphBitmap* out_bitmap, ImVector<unsigned char>* out_pixels)
 {
+    IM_UNUSED(atlas);
+
     // Search for first font which has the glyph
     ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
     IM_ASSERT(bd_font_data);
@@ -4645,49 +5923,33 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     stbtt_GetGlyphBitmapBoxSubpixel(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, 0, 0, &x0, &y0, &x1, &y1);
     stbtt_GetGlyphHMetrics(&bd_font_data->FontInfo, glyph_index, &advance, &lsb);
 
-    // Load metrics only mode
-    if (out_advance_x != NULL)
-    {
-        IM_ASSERT(out_glyph == NULL);
-        *out_advance_x = advance * scale_for_layout;
-        return true;
-    }
-
     // Prepare glyph
     out_glyph->Codepoint = codepoint;
     out_glyph->AdvanceX = advance * scale_for_layout;
+    out_bitmap->Format = ImTextureFormat_Alpha8;
+    out_bitmap->Width = out_bitmap->Height = 0;
+    out_bitmap->PixelsOffset = out_pixels->Size;
 
-    // Pack and retrieve position inside texture atlas
+    // Render
     // (generally based on stbtt_PackFontRangesRenderIntoRects)
     const bool is_visible = (x0 != x1 && y0 != y1);
     if (is_visible)
     {
         const int w = (x1 - x0 + oversample_h - 1);
         const int h = (y1 - y0 + oversample_v - 1);
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
-        if (pack_id == ImFontAtlasRectId_Invalid)
-        {
-            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
-            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
-            return false;
-        }
-        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
-
-        // Render
         stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
-        ImFontAtlasBuilder* builder = atlas->Builder;
-        builder->TempBuffer.resize(w * h * 1);
-        unsigned char* bitmap_pixels = builder->TempBuffer.Data;
+        out_pixels->resize(out_pixels->Size + w * h * 1);
+        unsigned char* bitmap_pixels = out_pixels->Data + out_bitmap->PixelsOffset;
         memset(bitmap_pixels, 0, w * h * 1);
-        stbtt_MakeGlyphBitmapSubpixel(&bd_font_data->FontInfo, bitmap_pixels, r->w - oversample_h + 1, r->h - oversample_v + 1, w,
+        stbtt_MakeGlyphBitmapSubpixel(&bd_font_data->FontInfo, bitmap_pixels, w - oversample_h + 1, h - oversample_v + 1, w,
             scale_for_raster_x, scale_for_raster_y, 0, 0, glyph_index);
 
         // Oversampling
         // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
         if (oversample_h > 1)
-            stbtt__h_prefilter(bitmap_pixels, r->w, r->h, r->w, oversample_h);
+            stbtt__h_prefilter(bitmap_pixels, w, h, w, oversample_h);
         if (oversample_v > 1)
-            stbtt__v_prefilter(bitmap_pixels, r->w, r->h, r->w, oversample_v);
+            stbtt__v_prefilter(bitmap_pixels, w, h, w, oversample_v);
 
         const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
         const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
@@ -4703,15 +5965,55 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         float recip_v = 1.0f / (oversample_v * rasterizer_density);
 
         // Register glyph
-        // r->x r->y are coordinates inside texture (in pixels)
         // glyph.X0, glyph.Y0 are drawing coordinates from base text position, and accounting for oversampling.
         out_glyph->X0 = x0 * recip_h + font_off_x;
         out_glyph->Y0 = y0 * recip_v + font_off_y;
-        out_glyph->X1 = (x0 + (int)r->w) * recip_h + font_off_x;
-        out_glyph->Y1 = (y0 + (int)r->h) * recip_v + font_off_y;
+        out_glyph->X1 = (x0 + w) * recip_h + font_off_x;
+        out_glyph->Y1 = (y0 + h) * recip_v + font_off_y;
         out_glyph->Visible = true;
+        out_bitmap->Width = w;
+        out_bitmap->Height = h;
+    }
+
+    return true;
+}
+
+static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+{
+    // Load metrics only mode
+    if (out_advance_x != NULL)
+    {
+        IM_ASSERT(out_glyph == NULL);
+        ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+        IM_ASSERT(bd_font_data);
+        int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (int)codepoint);
+        if (glyph_index == 0)
+            return false;
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(&bd_font_data->FontInfo, glyph_index, &advance, &lsb);
+        *out_advance_x = advance * bd_font_data->ScaleFactor * baked->Size;
+        return true;
+    }
+
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasGlyphBitmap bitmap;
+    builder->TempBuffer.resize(0);
+    if (!ImGui_ImplStbTrueType_FontBakedRasterizeGlyph(atlas, src, baked, loader_data_for_baked_src, codepoint, out_glyph, &bitmap, &builder->TempBuffer))
+        return false;
+
+    // Pack and retrieve position inside texture atlas
+    if (out_glyph->Visible)
+    {
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, bitmap.Width, bitmap.Height);
+        if (pack_id == ImFontAtlasRectId_Invalid)
+        {
+            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            return false;
+        }
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
         out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
+        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, builder->TempBuffer.Data + bitmap.PixelsOffset, ImTextureFormat_Alpha8, bitmap.Width);
     }
 
     return true;
@@ -4727,6 +6029,7 @@ const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
     loader.FontBakedInit = ImGui_ImplStbTrueType_FontBakedInit;
     loader.FontBakedDestroy = NULL;
     loader.FontBakedLoadGlyph = ImGui_ImplStbTrueType_FontBakedLoadGlyph;
+    loader.FontBakedRasterizeGlyph = ImGui_ImplStbTrueType_FontBakedRasterizeGlyph;
     return &loader;
 }
 
@@ -5189,6 +6492,14 @@ void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked,
     ImTextureData* tex = atlas->TexData;
     IM_ASSERT(r->x + r->w <= tex->Width && r->y + r->h <= tex->Height);
     ImFontAtlasTextureBlockConvert(src_pixels, src_fmt, src_pitch, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
+    ImFontAtlasBakedCommitFontGlyphBitmap(atlas, baked, src, glyph, r);
+}
+
+// Post-process and queue update for backend.
+// Font loaders may call this directly after rendering glyph pixels straight into atlas->TexData, saving a copy.
+void ImFontAtlasBakedCommitFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r)
+{
+    ImTextureData* tex = atlas->TexData;
     ImFontAtlasPostProcessData pp_data = { atlas, baked->ContainerFont, src, baked, glyph, tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h };
     ImFontAtlasTextureBlockPostProcess(&pp_data);
     ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
@@ -5553,6 +6864,14 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         return;
     if (glyph->Colored)
         col |= ~IM_COL32_A_MASK;
+    ImVec4 clip_rect;
+    if (draw_list->Flags & ImDrawListFlags_CpuClipRects)
+    {
+        clip_rect = draw_list->_CmdHeader.ClipRect;
+        if (cpu_fine_clip)
+            clip_rect = ImVec4(ImMax(clip_rect.x, cpu_fine_clip->x), ImMax(clip_rect.y, cpu_fine_clip->y), ImMin(clip_rect.z, cpu_fine_clip->z), ImMin(clip_rect.w, cpu_fine_clip->w));
+        cpu_fine_clip = &clip_rect;
+    }
     float scale = (size >= 0.0f) ? (size / baked->Size) : 1.0f;
     float x = IM_TRUNC(pos.x);
     float y = IM_TRUNC(pos.y);
@@ -5579,8 +6898,18 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         if (y1 >= y2)
             return;
     }
-    draw_list->PrimReserve(6, 4);
-    draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
+    const ImDrawListFlags backup_flags = draw_list->Flags;
+    draw_list->Flags &= ~ImDrawListFlags_CpuClipRects; // Clipped above: can be appended to current command
+    if (draw_list->Flags & ImDrawListFlags_AllowInstances)
+    {
+        draw_list->PrimInstance(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
+    }
+    else
+    {
+        draw_list->PrimReserve(6, 4);
+        draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
+    }
+    draw_list->Flags = backup_flags;
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
@@ -5642,10 +6971,15 @@ begin:
         return;
 
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
-    const int vtx_count_max = (int)(text_end - s) * 4;
-    const int idx_count_max = (int)(text_end - s) * 6;
+    // When instancing is allowed, reserve one ImDrawInstance per character instead.
+    const bool use_instances = (draw_list->Flags & ImDrawListFlags_AllowInstances) != 0;
+    const int vtx_count_max = use_instances ? 0 : (int)(text_end - s) * 4;
+    const int idx_count_max = use_instances ? 0 : (int)(text_end - s) * 6;
+    const int inst_count_max = use_instances ? (int)(text_end - s) : 0;
     const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
-    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    ImDrawInstance* inst_write = use_instances ? draw_list->PrimReserveInstances(inst_count_max) : NULL;
+    if (!use_instances)
+        draw_list->PrimReserve(idx_count_max, vtx_count_max);
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
@@ -5749,6 +7083,14 @@ begin:
                 ImU32 glyph_col = glyph->Colored ? col_untinted : col;
 
                 // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
+                if (inst_write != NULL)
+                {
+                    inst_write->pos_min.x = x1; inst_write->pos_min.y = y1; inst_write->uv_min.x = u1; inst_write->uv_min.y = v1;
+                    inst_write->pos_max.x = x2; inst_write->pos_max.y = y2; inst_write->uv_max.x = u2; inst_write->uv_max.y = v2;
+                    inst_write->col = glyph_col;
+                    inst_write++;
+                }
+                else
                 {
                     vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
                     vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
@@ -5768,9 +7110,12 @@ begin:
     // Edge case: calling RenderText() with unloaded glyphs triggering texture change. It doesn't happen via ImGui:: calls because CalcTextSize() is always used.
     if (cmd_count != draw_list->CmdBuffer.Size) //-V547
     {
-        IM_ASSERT(draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount == 0);
+        IM_ASSERT(draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount == 0 && draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].InstCount == 0);
         draw_list->CmdBuffer.pop_back();
-        draw_list->PrimUnreserve(idx_count_max, vtx_count_max);
+        if (use_instances)
+            draw_list->PrimUnreserveInstances(inst_count_max);
+        else
+            draw_list->PrimUnreserve(idx_count_max, vtx_count_max);
         draw_list->AddDrawCmd();
         //IMGUI_DEBUG_LOG("RenderText: cancel and retry to missing glyphs.\n"); // [DEBUG]
         //draw_list->AddRectFilled(pos, pos + ImVec2(10, 10), IM_COL32(255, 0, 0, 255)); // [DEBUG]
@@ -5780,6 +7125,11 @@ begin:
     }
 
     // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
+    if (use_instances)
+    {
+        draw_list->PrimUnreserveInstances((int)(draw_list->InstBuffer.Data + draw_list->InstBuffer.Size - inst_write));
+        return;
+    }
     draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
     draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
     draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
@@ -5998,7 +7348,7 @@ void ImGui::RenderColorRectWithAlphaCheckerboard(ImDrawList* draw_list, ImVec2 p
 //-----------------------------------------------------------------------------
 // [SECTION] Decompression code
 //-----------------------------------------------------------------------------
-// Compressed with stb_compress() then converted to a C array and encoded as base85.
+// Compressed with stb_compress() or LZ4 then converted to a C array and encoded as base85.
 // Use the program in misc/fonts/binary_to_compressed_c.cpp to create the array from a TTF file.
 // The purpose of encoding as base85 instead of "0x00,0x01,..." style is only save on _source code_ size.
 // Decompression from stb.h (public domain) by Sean Barrett https://github.com/nothings/stb/blob/master/stb.h
@@ -6114,6 +7464,109 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
     }
 }
 
+// LZ4 block decompression, for data compressed with 'binary_to_compressed_c -lz4'.
+// Header: 'L','Z','4',0x01 + big-endian decompressed size, followed by a single LZ4 block.
+// This is many times faster than stb_decompress(): literals and non-overlapping matches are copied 8 or 16 bytes at a time.
+// Input may be followed by padding (e.g. from base85 encoding): we stop once output is complete.
+static bool ImLz4IsCompressed(const unsigned char* input, int input_size)
+{
+    return input_size >= 8 && input[0] == 'L' && input[1] == 'Z' && input[2] == '4' && input[3] == 0x01;
+}
+
+static unsigned int ImLz4DecompressLength(const unsigned char* input)
+{
+    return ((unsigned int)input[4] << 24) + ((unsigned int)input[5] << 16) + ((unsigned int)input[6] << 8) + (unsigned int)input[7];
+}
+
+static unsigned int ImLz4Decompress(unsigned char* output, const unsigned char* input, unsigned int input_size)
+{
+    const unsigned int olen = ImLz4DecompressLength(input);
+    const unsigned char* ip = input + 8;
+    const unsigned char* ip_end = input + input_size;
+    unsigned char* op = output;
+    unsigned char* op_end = output + olen;
+    while (ip < ip_end)
+    {
+        // Fast path for short literals + short match, which are the vast majority of sequences: fixed size copies and no loops.
+        const unsigned int token = *ip;
+        if (token < 0xF0 && (token & 15) != 15 && ip_end - ip >= 1 + 16 + 2 && op_end - op >= 16 + 24)
+        {
+            const size_t literals_len = token >> 4;
+            const size_t offset = ip[1 + literals_len] | (ip[2 + literals_len] << 8);
+            if (offset >= 8 && offset <= (size_t)(op + literals_len - output))
+            {
+                memcpy(op, ip + 1, 16);
+                op += literals_len;
+                ip += 1 + literals_len + 2;
+                const unsigned char* match = op - offset;
+                memcpy(op, match, 8);
+                memcpy(op + 8, match + 8, 8);
+                memcpy(op + 16, match + 16, 8);
+                op += (token & 15) + 4;
+                continue;
+            }
+        }
+        ip++;
+
+        // Literals
+        size_t literals_len = token >> 4;
+        if (literals_len == 15)
+            for (unsigned int b = 255; b == 255; literals_len += b)
+            {
+                if (ip >= ip_end)
+                    return 0;
+                b = *ip++;
+            }
+        if (literals_len > (size_t)(ip_end - ip) || literals_len > (size_t)(op_end - op))
+            return 0;
+        if (literals_len <= 16 && ip_end - ip >= 16 && op_end - op >= 16)
+            memcpy(op, ip, 16); // Overwrite is fine: will be written over by next sequence.
+        else
+            memcpy(op, ip, literals_len);
+        op += literals_len;
+        ip += literals_len;
+        if (op == op_end)
+            return olen; // Last sequence has no match
+
+        // Match
+        if (ip_end - ip < 2)
+            return 0;
+        const size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - output))
+            return 0;
+        size_t match_len = (token & 15) + 4;
+        if ((token & 15) == 15)
+            for (unsigned int b = 255; b == 255; match_len += b)
+            {
+                if (ip >= ip_end)
+                    return 0;
+                b = *ip++;
+            }
+        if (match_len > (size_t)(op_end - op))
+            return 0;
+        const unsigned char* match = op - offset;
+        if (offset >= 8 && match_len + 8 <= (size_t)(op_end - op))
+        {
+            unsigned char* copy_end = op + match_len;
+            for (; op < copy_end; op += 8, match += 8)
+                memcpy(op, match, 8);
+            op = copy_end;
+        }
+        else if (offset == 1)
+        {
+            memset(op, *match, match_len);
+            op += match_len;
+        }
+        else
+        {
+            while (match_len--) // Overlapping copy: repeat pattern
+                *op++ = *match++;
+        }
+    }
+    return 0;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Default font data (ProggyClean.ttf)
 //-----------------------------------------------------------------------------
@@ -6126,176 +7579,132 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
 #ifndef IMGUI_DISABLE_DEFAULT_FONT
 
 // File: 'ProggyClean.ttf' (41208 bytes)
-// Exported using binary_to_compressed_c.exe -u8 "ProggyClean.ttf" proggy_clean_ttf
-static const unsigned int proggy_clean_ttf_compressed_size = 9583;
-static const unsigned char proggy_clean_ttf_compressed_data[9583] =
-{
-    87,188,0,0,0,0,0,0,0,0,160,248,0,4,0,0,55,0,1,0,0,0,12,0,128,0,3,0,64,79,83,47,50,136,235,116,144,0,0,1,72,130,21,44,78,99,109,97,112,2,18,35,117,0,0,3,160,130,19,36,82,99,118,116,
-    32,130,23,130,2,33,4,252,130,4,56,2,103,108,121,102,18,175,137,86,0,0,7,4,0,0,146,128,104,101,97,100,215,145,102,211,130,27,32,204,130,3,33,54,104,130,16,39,8,66,1,195,0,0,1,4,130,
-    15,59,36,104,109,116,120,138,0,126,128,0,0,1,152,0,0,2,6,108,111,99,97,140,115,176,216,0,0,5,130,30,41,2,4,109,97,120,112,1,174,0,218,130,31,32,40,130,16,44,32,110,97,109,101,37,89,
-    187,150,0,0,153,132,130,19,44,158,112,111,115,116,166,172,131,239,0,0,155,36,130,51,44,210,112,114,101,112,105,2,1,18,0,0,4,244,130,47,32,8,132,203,46,1,0,0,60,85,233,213,95,15,60,
-    245,0,3,8,0,131,0,34,183,103,119,130,63,43,0,0,189,146,166,215,0,0,254,128,3,128,131,111,130,241,33,2,0,133,0,32,1,130,65,38,192,254,64,0,0,3,128,131,16,130,5,32,1,131,7,138,3,33,2,
-    0,130,17,36,1,1,0,144,0,130,121,130,23,38,2,0,8,0,64,0,10,130,9,32,118,130,9,130,6,32,0,130,59,33,1,144,131,200,35,2,188,2,138,130,16,32,143,133,7,37,1,197,0,50,2,0,131,0,33,4,9,131,
-    5,145,3,43,65,108,116,115,0,64,0,0,32,172,8,0,131,0,35,5,0,1,128,131,77,131,3,33,3,128,191,1,33,1,128,130,184,35,0,0,128,0,130,3,131,11,32,1,130,7,33,0,128,131,1,32,1,136,9,32,0,132,
-    15,135,5,32,1,131,13,135,27,144,35,32,1,149,25,131,21,32,0,130,0,32,128,132,103,130,35,132,39,32,0,136,45,136,97,133,17,130,5,33,0,0,136,19,34,0,128,1,133,13,133,5,32,128,130,15,132,
-    131,32,3,130,5,32,3,132,27,144,71,32,0,133,27,130,29,130,31,136,29,131,63,131,3,65,63,5,132,5,132,205,130,9,33,0,0,131,9,137,119,32,3,132,19,138,243,130,55,32,1,132,35,135,19,131,201,
-    136,11,132,143,137,13,130,41,32,0,131,3,144,35,33,128,0,135,1,131,223,131,3,141,17,134,13,136,63,134,15,136,53,143,15,130,96,33,0,3,131,4,130,3,34,28,0,1,130,5,34,0,0,76,130,17,131,
-    9,36,28,0,4,0,48,130,17,46,8,0,8,0,2,0,0,0,127,0,255,32,172,255,255,130,9,34,0,0,129,132,9,130,102,33,223,213,134,53,132,22,33,1,6,132,6,64,4,215,32,129,165,216,39,177,0,1,141,184,
-    1,255,133,134,45,33,198,0,193,1,8,190,244,1,28,1,158,2,20,2,136,2,252,3,20,3,88,3,156,3,222,4,20,4,50,4,80,4,98,4,162,5,22,5,102,5,188,6,18,6,116,6,214,7,56,7,126,7,236,8,78,8,108,
-    8,150,8,208,9,16,9,74,9,136,10,22,10,128,11,4,11,86,11,200,12,46,12,130,12,234,13,94,13,164,13,234,14,80,14,150,15,40,15,176,16,18,16,116,16,224,17,82,17,182,18,4,18,110,18,196,19,
-    76,19,172,19,246,20,88,20,174,20,234,21,64,21,128,21,166,21,184,22,18,22,126,22,198,23,52,23,142,23,224,24,86,24,186,24,238,25,54,25,150,25,212,26,72,26,156,26,240,27,92,27,200,28,
-    4,28,76,28,150,28,234,29,42,29,146,29,210,30,64,30,142,30,224,31,36,31,118,31,166,31,166,32,16,130,1,52,46,32,138,32,178,32,200,33,20,33,116,33,152,33,238,34,98,34,134,35,12,130,1,
-    33,128,35,131,1,60,152,35,176,35,216,36,0,36,74,36,104,36,144,36,174,37,6,37,96,37,130,37,248,37,248,38,88,38,170,130,1,8,190,216,39,64,39,154,40,10,40,104,40,168,41,14,41,32,41,184,
-    41,248,42,54,42,96,42,96,43,2,43,42,43,94,43,172,43,230,44,32,44,52,44,154,45,40,45,92,45,120,45,170,45,232,46,38,46,166,47,38,47,182,47,244,48,94,48,200,49,62,49,180,50,30,50,158,
-    51,30,51,130,51,238,52,92,52,206,53,58,53,134,53,212,54,38,54,114,54,230,55,118,55,216,56,58,56,166,57,18,57,116,57,174,58,46,58,154,59,6,59,124,59,232,60,58,60,150,61,34,61,134,61,
-    236,62,86,62,198,63,42,63,154,64,18,64,106,64,208,65,54,65,162,66,8,66,64,66,122,66,184,66,240,67,98,67,204,68,42,68,138,68,238,69,88,69,182,69,226,70,84,70,180,71,20,71,122,71,218,
-    72,84,72,198,73,64,0,36,70,21,8,8,77,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,
-    0,119,0,123,0,127,0,131,0,135,0,139,0,143,0,0,17,53,51,21,49,150,3,32,5,130,23,32,33,130,3,211,7,151,115,32,128,133,0,37,252,128,128,2,128,128,190,5,133,74,32,4,133,6,206,5,42,0,7,
-    1,128,0,0,2,0,4,0,0,65,139,13,37,0,1,53,51,21,7,146,3,32,3,130,19,32,1,141,133,32,3,141,14,131,13,38,255,0,128,128,0,6,1,130,84,35,2,128,4,128,140,91,132,89,32,51,65,143,6,139,7,33,
-    1,0,130,57,32,254,130,3,32,128,132,4,32,4,131,14,138,89,35,0,0,24,0,130,0,33,3,128,144,171,66,55,33,148,115,65,187,19,32,5,130,151,143,155,163,39,32,1,136,182,32,253,134,178,132,7,
-    132,200,145,17,32,3,65,48,17,165,17,39,0,0,21,0,128,255,128,3,65,175,17,65,3,27,132,253,131,217,139,201,155,233,155,27,131,67,131,31,130,241,33,255,0,131,181,137,232,132,15,132,4,138,
-    247,34,255,0,128,179,238,32,0,130,0,32,20,65,239,48,33,0,19,67,235,10,32,51,65,203,14,65,215,11,32,7,154,27,135,39,32,33,130,35,33,128,128,130,231,32,253,132,231,32,128,132,232,34,
-    128,128,254,133,13,136,8,32,253,65,186,5,130,36,130,42,176,234,133,231,34,128,0,0,66,215,44,33,0,1,68,235,6,68,211,19,32,49,68,239,14,139,207,139,47,66,13,7,32,51,130,47,33,1,0,130,
-    207,35,128,128,1,0,131,222,131,5,130,212,130,6,131,212,32,0,130,10,133,220,130,233,130,226,32,254,133,255,178,233,39,3,1,128,3,0,2,0,4,68,15,7,68,99,12,130,89,130,104,33,128,4,133,
-    93,130,10,38,0,0,11,1,0,255,0,68,63,16,70,39,9,66,215,8,32,7,68,77,6,68,175,14,32,29,68,195,6,132,7,35,2,0,128,255,131,91,132,4,65,178,5,141,111,67,129,23,165,135,140,107,142,135,33,
-    21,5,69,71,6,131,7,33,1,0,140,104,132,142,130,4,137,247,140,30,68,255,12,39,11,0,128,0,128,3,0,3,69,171,15,67,251,7,65,15,8,66,249,11,65,229,7,67,211,7,66,13,7,35,1,128,128,254,133,
-    93,32,254,131,145,132,4,132,18,32,2,151,128,130,23,34,0,0,9,154,131,65,207,8,68,107,15,68,51,7,32,7,70,59,7,135,121,130,82,32,128,151,111,41,0,0,4,0,128,255,0,1,128,1,137,239,33,0,
-    37,70,145,10,65,77,10,65,212,14,37,0,0,0,5,0,128,66,109,5,70,123,10,33,0,19,72,33,18,133,237,70,209,11,33,0,2,130,113,137,119,136,115,33,1,0,133,43,130,5,34,0,0,10,69,135,6,70,219,
-    13,66,155,7,65,9,12,66,157,11,66,9,11,32,7,130,141,132,252,66,151,9,137,9,66,15,30,36,0,20,0,128,0,130,218,71,11,42,68,51,8,65,141,7,73,19,15,69,47,23,143,39,66,81,7,32,1,66,55,6,34,
-    1,128,128,68,25,5,69,32,6,137,6,136,25,32,254,131,42,32,3,66,88,26,148,26,32,0,130,0,32,14,164,231,70,225,12,66,233,7,67,133,19,71,203,15,130,161,32,255,130,155,32,254,139,127,134,
-    12,164,174,33,0,15,164,159,33,59,0,65,125,20,66,25,7,32,5,68,191,6,66,29,7,144,165,65,105,9,35,128,128,255,0,137,2,133,182,164,169,33,128,128,197,171,130,155,68,235,7,32,21,70,77,19,
-    66,21,10,68,97,8,66,30,5,66,4,43,34,0,17,0,71,19,41,65,253,20,71,25,23,65,91,15,65,115,7,34,2,128,128,66,9,8,130,169,33,1,0,66,212,13,132,28,72,201,43,35,0,0,0,18,66,27,38,76,231,5,
-    68,157,20,135,157,32,7,68,185,13,65,129,28,66,20,5,32,253,66,210,11,65,128,49,133,61,32,0,65,135,6,74,111,37,72,149,12,66,203,19,65,147,19,68,93,7,68,85,8,76,4,5,33,255,0,133,129,34,
-    254,0,128,68,69,8,181,197,34,0,0,12,65,135,32,65,123,20,69,183,27,133,156,66,50,5,72,87,10,67,137,32,33,0,19,160,139,78,251,13,68,55,20,67,119,19,65,91,36,69,177,15,32,254,143,16,65,
-    98,53,32,128,130,0,32,0,66,43,54,70,141,23,66,23,15,131,39,69,47,11,131,15,70,129,19,74,161,9,36,128,255,0,128,254,130,153,65,148,32,67,41,9,34,0,0,4,79,15,5,73,99,10,71,203,8,32,3,
-    72,123,6,72,43,8,32,2,133,56,131,99,130,9,34,0,0,6,72,175,5,73,159,14,144,63,135,197,132,189,133,66,33,255,0,73,6,7,70,137,12,35,0,0,0,10,130,3,73,243,25,67,113,12,65,73,7,69,161,7,
-    138,7,37,21,2,0,128,128,254,134,3,73,116,27,33,128,128,130,111,39,12,0,128,1,0,3,128,2,72,219,21,35,43,0,47,0,67,47,20,130,111,33,21,1,68,167,13,81,147,8,133,230,32,128,77,73,6,32,
-    128,131,142,134,18,130,6,32,255,75,18,12,131,243,37,128,0,128,3,128,3,74,231,21,135,123,32,29,134,107,135,7,32,21,74,117,7,135,7,134,96,135,246,74,103,23,132,242,33,0,10,67,151,28,
-    67,133,20,66,141,11,131,11,32,3,77,71,6,32,128,130,113,32,1,81,4,6,134,218,66,130,24,131,31,34,0,26,0,130,0,77,255,44,83,15,11,148,155,68,13,7,32,49,78,231,18,79,7,11,73,243,11,32,
-    33,65,187,10,130,63,65,87,8,73,239,19,35,0,128,1,0,131,226,32,252,65,100,6,32,128,139,8,33,1,0,130,21,32,253,72,155,44,73,255,20,32,128,71,67,8,81,243,39,67,15,20,74,191,23,68,121,
-    27,32,1,66,150,6,32,254,79,19,11,131,214,32,128,130,215,37,2,0,128,253,0,128,136,5,65,220,24,147,212,130,210,33,0,24,72,219,42,84,255,13,67,119,16,69,245,19,72,225,19,65,3,15,69,93,
-    19,131,55,132,178,71,115,14,81,228,6,142,245,33,253,0,132,43,172,252,65,16,11,75,219,8,65,219,31,66,223,24,75,223,10,33,29,1,80,243,10,66,175,8,131,110,134,203,133,172,130,16,70,30,
-    7,164,183,130,163,32,20,65,171,48,65,163,36,65,143,23,65,151,19,65,147,13,65,134,17,133,17,130,216,67,114,5,164,217,65,137,12,72,147,48,79,71,19,74,169,22,80,251,8,65,173,7,66,157,
-    15,74,173,15,32,254,65,170,8,71,186,45,72,131,6,77,143,40,187,195,152,179,65,123,38,68,215,57,68,179,15,65,85,7,69,187,14,32,21,66,95,15,67,19,25,32,1,83,223,6,32,2,76,240,7,77,166,
-    43,65,8,5,130,206,32,0,67,39,54,143,167,66,255,19,82,193,11,151,47,85,171,5,67,27,17,132,160,69,172,11,69,184,56,66,95,6,33,12,1,130,237,32,2,68,179,27,68,175,16,80,135,15,72,55,7,
-    71,87,12,73,3,12,132,12,66,75,32,76,215,5,169,139,147,135,148,139,81,12,12,81,185,36,75,251,7,65,23,27,76,215,9,87,165,12,65,209,15,72,157,7,65,245,31,32,128,71,128,6,32,1,82,125,5,
-    34,0,128,254,131,169,32,254,131,187,71,180,9,132,27,32,2,88,129,44,32,0,78,47,40,65,79,23,79,171,14,32,21,71,87,8,72,15,14,65,224,33,130,139,74,27,62,93,23,7,68,31,7,75,27,7,139,15,
-    74,3,7,74,23,27,65,165,11,65,177,15,67,123,5,32,1,130,221,32,252,71,96,5,74,12,12,133,244,130,25,34,1,0,128,130,2,139,8,93,26,8,65,9,32,65,57,14,140,14,32,0,73,79,67,68,119,11,135,
-    11,32,51,90,75,14,139,247,65,43,7,131,19,139,11,69,159,11,65,247,6,36,1,128,128,253,0,90,71,9,33,1,0,132,14,32,128,89,93,14,69,133,6,130,44,131,30,131,6,65,20,56,33,0,16,72,179,40,
-    75,47,12,65,215,19,74,95,19,65,43,11,131,168,67,110,5,75,23,17,69,106,6,75,65,5,71,204,43,32,0,80,75,47,71,203,15,159,181,68,91,11,67,197,7,73,101,13,68,85,6,33,128,128,130,214,130,
-    25,32,254,74,236,48,130,194,37,0,18,0,128,255,128,77,215,40,65,139,64,32,51,80,159,10,65,147,39,130,219,84,212,43,130,46,75,19,97,74,33,11,65,201,23,65,173,31,33,1,0,79,133,6,66,150,
-    5,67,75,48,85,187,6,70,207,37,32,71,87,221,13,73,163,14,80,167,15,132,15,83,193,19,82,209,8,78,99,9,72,190,11,77,110,49,89,63,5,80,91,35,99,63,32,70,235,23,81,99,10,69,148,10,65,110,
-    36,32,0,65,99,47,95,219,11,68,171,51,66,87,7,72,57,7,74,45,17,143,17,65,114,50,33,14,0,65,111,40,159,195,98,135,15,35,7,53,51,21,100,78,9,95,146,16,32,254,82,114,6,32,128,67,208,37,
-    130,166,99,79,58,32,17,96,99,14,72,31,19,72,87,31,82,155,7,67,47,14,32,21,131,75,134,231,72,51,17,72,78,8,133,8,80,133,6,33,253,128,88,37,9,66,124,36,72,65,12,134,12,71,55,43,66,139,
-    27,85,135,10,91,33,12,65,35,11,66,131,11,71,32,8,90,127,6,130,244,71,76,11,168,207,33,0,12,66,123,32,32,0,65,183,15,68,135,11,66,111,7,67,235,11,66,111,15,32,254,97,66,12,160,154,67,
-    227,52,80,33,15,87,249,15,93,45,31,75,111,12,93,45,11,77,99,9,160,184,81,31,12,32,15,98,135,30,104,175,7,77,249,36,69,73,15,78,5,12,32,254,66,151,19,34,128,128,4,87,32,12,149,35,133,
-    21,96,151,31,32,19,72,35,5,98,173,15,143,15,32,21,143,99,158,129,33,0,0,65,35,52,65,11,15,147,15,98,75,11,33,1,0,143,151,132,15,32,254,99,200,37,132,43,130,4,39,0,10,0,128,1,128,3,
-    0,104,151,14,97,187,20,69,131,15,67,195,11,87,227,7,33,128,128,132,128,33,254,0,68,131,9,65,46,26,42,0,0,0,7,0,0,255,128,3,128,0,88,223,15,33,0,21,89,61,22,66,209,12,65,2,12,37,0,2,
-    1,0,3,128,101,83,8,36,0,1,53,51,29,130,3,34,21,1,0,66,53,8,32,0,68,215,6,100,55,25,107,111,9,66,193,11,72,167,8,73,143,31,139,31,33,1,0,131,158,32,254,132,5,33,253,128,65,16,9,133,
-    17,89,130,25,141,212,33,0,0,93,39,8,90,131,25,93,39,14,66,217,6,106,179,8,159,181,71,125,15,139,47,138,141,87,11,14,76,23,14,65,231,26,140,209,66,122,8,81,179,5,101,195,26,32,47,74,
-    75,13,69,159,11,83,235,11,67,21,16,136,167,131,106,130,165,130,15,32,128,101,90,24,134,142,32,0,65,103,51,108,23,11,101,231,15,75,173,23,74,237,23,66,15,6,66,46,17,66,58,17,65,105,
-    49,66,247,55,71,179,12,70,139,15,86,229,7,84,167,15,32,1,95,72,12,89,49,6,33,128,128,65,136,38,66,30,9,32,0,100,239,7,66,247,29,70,105,20,65,141,19,69,81,15,130,144,32,128,83,41,5,
-    32,255,131,177,68,185,5,133,126,65,97,37,32,0,130,0,33,21,0,130,55,66,195,28,67,155,13,34,79,0,83,66,213,13,73,241,19,66,59,19,65,125,11,135,201,66,249,16,32,128,66,44,11,66,56,17,
-    68,143,8,68,124,38,67,183,12,96,211,9,65,143,29,112,171,5,32,0,68,131,63,34,33,53,51,71,121,11,32,254,98,251,16,32,253,74,231,10,65,175,37,133,206,37,0,0,8,1,0,0,107,123,11,113,115,
-    9,33,0,1,130,117,131,3,73,103,7,66,51,18,66,44,5,133,75,70,88,5,32,254,65,39,12,68,80,9,34,12,0,128,107,179,28,68,223,6,155,111,86,147,15,32,2,131,82,141,110,33,254,0,130,15,32,4,103,
-    184,15,141,35,87,176,5,83,11,5,71,235,23,114,107,11,65,189,16,70,33,15,86,153,31,135,126,86,145,30,65,183,41,32,0,130,0,32,10,65,183,24,34,35,0,39,67,85,9,65,179,15,143,15,33,1,0,65,
-    28,17,157,136,130,123,32,20,130,3,32,0,97,135,24,115,167,19,80,71,12,32,51,110,163,14,78,35,19,131,19,155,23,77,229,8,78,9,17,151,17,67,231,46,94,135,8,73,31,31,93,215,56,82,171,25,
-    72,77,8,162,179,169,167,99,131,11,69,85,19,66,215,15,76,129,13,68,115,22,72,79,35,67,113,5,34,0,0,19,70,31,46,65,89,52,73,223,15,85,199,33,95,33,8,132,203,73,29,32,67,48,16,177,215,
-    101,13,15,65,141,43,69,141,15,75,89,5,70,0,11,70,235,21,178,215,36,10,0,128,0,0,71,207,24,33,0,19,100,67,6,80,215,11,66,67,7,80,43,12,71,106,7,80,192,5,65,63,5,66,217,26,33,0,13,156,
-    119,68,95,5,72,233,12,134,129,85,81,11,76,165,20,65,43,8,73,136,8,75,10,31,38,128,128,0,0,0,13,1,130,4,32,3,106,235,29,114,179,12,66,131,23,32,7,77,133,6,67,89,12,131,139,116,60,9,
-    89,15,37,32,0,74,15,7,103,11,22,65,35,5,33,55,0,93,81,28,67,239,23,78,85,5,107,93,14,66,84,17,65,193,26,74,183,10,66,67,34,143,135,79,91,15,32,7,117,111,8,75,56,9,84,212,9,154,134,
-    32,0,130,0,32,18,130,3,70,171,41,83,7,16,70,131,19,84,191,15,84,175,19,84,167,30,84,158,12,154,193,68,107,15,33,0,0,65,79,42,65,71,7,73,55,7,118,191,16,83,180,9,32,255,76,166,9,154,
-    141,32,0,130,0,69,195,52,65,225,15,151,15,75,215,31,80,56,10,68,240,17,100,32,9,70,147,39,65,93,12,71,71,41,92,85,15,84,135,23,78,35,15,110,27,10,84,125,8,107,115,29,136,160,38,0,0,
-    14,0,128,255,0,82,155,24,67,239,8,119,255,11,69,131,11,77,29,6,112,31,8,134,27,105,203,8,32,2,75,51,11,75,195,12,74,13,29,136,161,37,128,0,0,0,11,1,130,163,82,115,8,125,191,17,69,35,
-    12,74,137,15,143,15,32,1,65,157,12,136,12,161,142,65,43,40,65,199,6,65,19,24,102,185,11,76,123,11,99,6,12,135,12,32,254,130,8,161,155,101,23,9,39,8,0,0,1,128,3,128,2,78,63,17,72,245,
-    12,67,41,11,90,167,9,32,128,97,49,9,32,128,109,51,14,132,97,81,191,8,130,97,125,99,12,121,35,9,127,75,15,71,79,12,81,151,23,87,97,7,70,223,15,80,245,16,105,97,15,32,254,113,17,6,32,
-    128,130,8,105,105,8,76,122,18,65,243,21,74,63,7,38,4,1,0,255,0,2,0,119,247,28,133,65,32,255,141,91,35,0,0,0,16,67,63,36,34,59,0,63,77,59,9,119,147,11,143,241,66,173,15,66,31,11,67,
-    75,8,81,74,16,32,128,131,255,87,181,42,127,43,5,34,255,128,2,120,235,11,37,19,0,23,0,0,37,109,191,14,118,219,7,127,43,14,65,79,14,35,0,0,0,3,73,91,5,130,5,38,3,0,7,0,11,0,0,70,205,
-    11,88,221,12,32,0,73,135,7,87,15,22,73,135,10,79,153,15,97,71,19,65,49,11,32,1,131,104,121,235,11,80,65,11,142,179,144,14,81,123,46,32,1,88,217,5,112,5,8,65,201,15,83,29,15,122,147,
-    11,135,179,142,175,143,185,67,247,39,66,199,7,35,5,0,128,3,69,203,15,123,163,12,67,127,7,130,119,71,153,10,141,102,70,175,8,32,128,121,235,30,136,89,100,191,11,116,195,11,111,235,15,
-    72,39,7,32,2,97,43,5,132,5,94,67,8,131,8,125,253,10,32,3,65,158,16,146,16,130,170,40,0,21,0,128,0,0,3,128,5,88,219,15,24,64,159,32,135,141,65,167,15,68,163,10,97,73,49,32,255,82,58,
-    7,93,80,8,97,81,16,24,67,87,52,34,0,0,5,130,231,33,128,2,80,51,13,65,129,8,113,61,6,132,175,65,219,5,130,136,77,152,17,32,0,95,131,61,70,215,6,33,21,51,90,53,10,78,97,23,105,77,31,
-    65,117,7,139,75,24,68,195,9,24,64,22,9,33,0,128,130,11,33,128,128,66,25,5,121,38,5,134,5,134,45,66,40,36,66,59,18,34,128,0,0,66,59,81,135,245,123,103,19,120,159,19,77,175,12,33,255,
-    0,87,29,10,94,70,21,66,59,54,39,3,1,128,3,0,2,128,4,24,65,7,15,66,47,7,72,98,12,37,0,0,0,3,1,0,24,65,55,21,131,195,32,1,67,178,6,33,4,0,77,141,8,32,6,131,47,74,67,16,24,69,3,20,24,
-    65,251,7,133,234,130,229,94,108,17,35,0,0,6,0,141,175,86,59,5,162,79,85,166,8,70,112,13,32,13,24,64,67,26,24,71,255,7,123,211,12,80,121,11,69,215,15,66,217,11,69,71,10,131,113,132,
-    126,119,90,9,66,117,19,132,19,32,0,130,0,24,64,47,59,33,7,0,73,227,5,68,243,15,85,13,12,76,37,22,74,254,15,130,138,33,0,4,65,111,6,137,79,65,107,16,32,1,77,200,6,34,128,128,3,75,154,
-    12,37,0,16,0,0,2,0,104,115,36,140,157,68,67,19,68,51,15,106,243,15,134,120,70,37,10,68,27,10,140,152,65,121,24,32,128,94,155,7,67,11,8,24,74,11,25,65,3,12,83,89,18,82,21,37,67,200,
-    5,130,144,24,64,172,12,33,4,0,134,162,74,80,14,145,184,32,0,130,0,69,251,20,32,19,81,243,5,82,143,8,33,5,53,89,203,5,133,112,79,109,15,33,0,21,130,71,80,175,41,36,75,0,79,0,83,121,
-    117,9,87,89,27,66,103,11,70,13,15,75,191,11,135,67,87,97,20,109,203,5,69,246,8,108,171,5,78,195,38,65,51,13,107,203,11,77,3,17,24,75,239,17,65,229,28,79,129,39,130,175,32,128,123,253,
-    7,132,142,24,65,51,15,65,239,41,36,128,128,0,0,13,65,171,5,66,163,28,136,183,118,137,11,80,255,15,67,65,7,74,111,8,32,0,130,157,32,253,24,76,35,10,103,212,5,81,175,9,69,141,7,66,150,
-    29,131,158,24,75,199,28,124,185,7,76,205,15,68,124,14,32,3,123,139,16,130,16,33,128,128,108,199,6,33,0,3,65,191,35,107,11,6,73,197,11,24,70,121,15,83,247,15,24,70,173,23,69,205,14,
-    32,253,131,140,32,254,136,4,94,198,9,32,3,78,4,13,66,127,13,143,13,32,0,130,0,33,16,0,24,69,59,39,109,147,12,76,253,19,24,69,207,15,69,229,15,130,195,71,90,10,139,10,130,152,73,43,
-    40,91,139,10,65,131,37,35,75,0,79,0,84,227,12,143,151,68,25,15,80,9,23,95,169,11,34,128,2,128,112,186,5,130,6,83,161,19,76,50,6,130,37,65,145,44,110,83,5,32,16,67,99,6,71,67,15,76,
-    55,17,140,215,67,97,23,76,69,15,77,237,11,104,211,23,77,238,11,65,154,43,33,0,10,83,15,28,83,13,20,67,145,19,67,141,14,97,149,21,68,9,15,86,251,5,66,207,5,66,27,37,82,1,23,127,71,12,
-    94,235,10,110,175,24,98,243,15,132,154,132,4,24,66,69,10,32,4,67,156,43,130,198,35,2,1,0,4,75,27,9,69,85,9,95,240,7,32,128,130,35,32,28,66,43,40,24,82,63,23,83,123,12,72,231,15,127,
-    59,23,116,23,19,117,71,7,24,77,99,15,67,111,15,71,101,8,36,2,128,128,252,128,127,60,11,32,1,132,16,130,18,141,24,67,107,9,32,3,68,194,15,175,15,38,0,11,0,128,1,128,2,80,63,25,32,0,
-    24,65,73,11,69,185,15,83,243,16,32,0,24,81,165,8,130,86,77,35,6,155,163,88,203,5,24,66,195,30,70,19,19,24,80,133,15,32,1,75,211,8,32,254,108,133,8,79,87,20,65,32,9,41,0,0,7,0,128,0,
-    0,2,128,2,68,87,15,66,1,16,92,201,16,24,76,24,17,133,17,34,128,0,30,66,127,64,34,115,0,119,73,205,9,66,43,11,109,143,15,24,79,203,11,90,143,15,131,15,155,31,65,185,15,86,87,11,35,128,
-    128,253,0,69,7,6,130,213,33,1,0,119,178,15,142,17,66,141,74,83,28,6,36,7,0,0,4,128,82,39,18,76,149,12,67,69,21,32,128,79,118,15,32,0,130,0,32,8,131,206,32,2,79,83,9,100,223,14,102,
-    113,23,115,115,7,24,65,231,12,130,162,32,4,68,182,19,130,102,93,143,8,69,107,29,24,77,255,12,143,197,72,51,7,76,195,15,132,139,85,49,15,130,152,131,18,71,81,23,70,14,11,36,0,10,0,128,
-    2,69,59,9,89,151,15,66,241,11,76,165,12,71,43,15,75,49,13,65,12,23,132,37,32,0,179,115,130,231,95,181,16,132,77,32,254,67,224,8,65,126,20,79,171,8,32,2,89,81,5,75,143,6,80,41,8,34,
-    2,0,128,24,81,72,9,32,0,130,0,35,17,0,0,255,77,99,39,95,65,36,67,109,15,24,69,93,11,77,239,5,95,77,23,35,128,1,0,128,24,86,7,8,132,167,32,2,69,198,41,130,202,33,0,26,120,75,44,24,89,
-    51,15,71,243,12,70,239,11,24,84,3,11,66,7,11,71,255,10,32,21,69,155,35,88,151,12,32,128,74,38,10,65,210,8,74,251,5,65,226,5,75,201,13,32,3,65,9,41,146,41,40,0,0,0,9,1,0,1,0,2,91,99,
-    19,32,35,106,119,13,70,219,15,83,239,12,137,154,32,2,67,252,19,36,128,0,0,4,1,130,196,32,2,130,8,91,107,8,32,0,135,81,24,73,211,8,132,161,73,164,13,36,0,8,0,128,2,105,123,26,139,67,
-    76,99,15,34,1,0,128,135,76,83,156,20,92,104,8,67,251,30,24,86,47,27,123,207,12,24,86,7,15,71,227,8,32,4,65,20,20,131,127,32,0,130,123,32,0,71,223,26,32,19,90,195,22,71,223,15,84,200,
-    6,32,128,133,241,24,84,149,9,67,41,25,36,0,0,0,22,0,88,111,49,32,87,66,21,5,77,3,27,123,75,7,71,143,19,135,183,71,183,19,130,171,74,252,5,131,5,89,87,17,32,1,132,18,130,232,68,11,10,
-    33,1,128,70,208,16,66,230,18,147,18,130,254,223,255,75,27,23,65,59,15,135,39,155,255,34,128,128,254,104,92,8,33,0,128,65,32,11,65,1,58,33,26,0,130,0,72,71,18,78,55,17,76,11,19,86,101,
-    12,75,223,11,89,15,11,24,76,87,15,75,235,15,131,15,72,95,7,85,71,11,72,115,11,73,64,6,34,1,128,128,66,215,9,34,128,254,128,134,14,33,128,255,67,102,5,32,0,130,16,70,38,11,66,26,57,
-    88,11,8,24,76,215,34,78,139,7,95,245,7,32,7,24,73,75,23,32,128,131,167,130,170,101,158,9,82,49,22,118,139,6,32,18,67,155,44,116,187,9,108,55,14,80,155,23,66,131,15,93,77,10,131,168,
-    32,128,73,211,12,24,75,187,22,32,4,96,71,20,67,108,19,132,19,120,207,8,32,5,76,79,15,66,111,21,66,95,8,32,3,190,211,111,3,8,211,212,32,20,65,167,44,34,75,0,79,97,59,13,32,33,112,63,
-    10,65,147,19,69,39,19,143,39,24,66,71,9,130,224,65,185,43,94,176,12,65,183,24,71,38,8,24,72,167,7,65,191,38,136,235,24,96,167,12,65,203,62,115,131,13,65,208,42,175,235,67,127,6,32,
-    4,76,171,29,114,187,5,32,71,65,211,5,65,203,68,72,51,8,164,219,32,0,172,214,71,239,58,78,3,27,66,143,15,77,19,15,147,31,35,33,53,51,21,66,183,10,173,245,66,170,30,150,30,34,0,0,23,
-    80,123,54,76,1,16,73,125,15,82,245,11,167,253,24,76,85,12,70,184,5,32,254,131,185,37,254,0,128,1,0,128,133,16,117,158,18,92,27,38,65,3,17,130,251,35,17,0,128,254,24,69,83,39,140,243,
-    121,73,19,109,167,7,81,41,15,24,95,175,12,102,227,15,121,96,11,24,95,189,7,32,3,145,171,154,17,24,77,47,9,33,0,5,70,71,37,68,135,7,32,29,117,171,11,69,87,15,24,79,97,19,24,79,149,23,
-    131,59,32,1,75,235,5,72,115,11,72,143,7,132,188,71,27,46,131,51,32,0,69,95,6,175,215,32,21,131,167,81,15,19,151,191,151,23,131,215,71,43,5,32,254,24,79,164,24,74,109,8,77,166,13,65,
-    176,26,88,162,5,98,159,6,171,219,120,247,6,79,29,8,99,169,10,103,59,19,65,209,35,131,35,91,25,19,112,94,15,83,36,8,173,229,33,20,0,88,75,43,71,31,12,65,191,71,33,1,0,130,203,32,254,
-    131,4,68,66,7,67,130,6,104,61,13,173,215,38,13,1,0,0,0,2,128,67,111,28,74,129,16,104,35,19,79,161,16,87,14,7,138,143,132,10,67,62,36,114,115,5,162,151,67,33,16,108,181,15,143,151,67,
-    5,5,24,100,242,15,170,153,34,0,0,14,65,51,34,32,55,79,75,9,32,51,74,7,10,65,57,38,132,142,32,254,72,0,14,139,163,32,128,80,254,8,67,158,21,65,63,7,32,4,72,227,27,95,155,12,67,119,19,
-    124,91,24,149,154,72,177,34,97,223,8,155,151,24,108,227,15,88,147,16,72,117,19,68,35,11,92,253,15,70,199,15,24,87,209,17,32,2,87,233,7,32,1,24,88,195,10,119,24,8,32,3,81,227,24,65,
-    125,21,35,128,128,0,25,76,59,48,24,90,187,9,97,235,12,66,61,11,91,105,19,24,79,141,11,24,79,117,15,24,79,129,27,90,53,13,130,13,32,253,131,228,24,79,133,40,69,70,8,66,137,31,65,33,
-    19,96,107,8,68,119,29,66,7,5,68,125,16,65,253,19,65,241,27,24,90,179,13,24,79,143,18,33,128,128,130,246,32,254,130,168,68,154,36,77,51,9,97,47,5,167,195,32,21,131,183,78,239,27,155,
-    195,78,231,14,201,196,77,11,6,32,5,73,111,37,97,247,12,77,19,31,155,207,78,215,19,162,212,69,17,14,66,91,19,80,143,57,78,203,39,159,215,32,128,93,134,8,24,80,109,24,66,113,15,169,215,
-    66,115,6,32,4,69,63,33,32,0,101,113,7,86,227,35,143,211,36,49,53,51,21,1,77,185,14,65,159,28,69,251,34,67,56,8,33,9,0,24,107,175,25,90,111,12,110,251,11,119,189,24,119,187,34,87,15,
-    9,32,4,66,231,37,90,39,7,66,239,8,84,219,15,69,105,23,24,85,27,27,87,31,11,33,1,128,76,94,6,32,1,85,241,7,33,128,128,106,48,10,33,128,128,69,136,11,133,13,24,79,116,49,84,236,8,24,
-    91,87,9,32,5,165,255,69,115,12,66,27,15,159,15,24,72,247,12,74,178,5,24,80,64,15,33,0,128,143,17,77,89,51,130,214,24,81,43,7,170,215,74,49,8,159,199,143,31,139,215,69,143,5,32,254,
-    24,81,50,35,181,217,84,123,70,143,195,159,15,65,187,16,66,123,7,65,175,15,65,193,29,68,207,39,79,27,5,70,131,6,32,4,68,211,33,33,67,0,83,143,14,159,207,143,31,140,223,33,0,128,24,80,
-    82,14,24,93,16,23,32,253,65,195,5,68,227,40,133,214,107,31,7,32,5,67,115,27,87,9,8,107,31,43,66,125,6,32,0,103,177,23,131,127,72,203,36,32,0,110,103,8,155,163,73,135,6,32,19,24,112,
-    99,10,65,71,11,73,143,19,143,31,126,195,5,24,85,21,9,24,76,47,14,32,254,24,93,77,36,68,207,11,39,25,0,0,255,128,3,128,4,66,51,37,95,247,13,82,255,24,76,39,19,147,221,66,85,27,24,118,
-    7,8,24,74,249,12,76,74,8,91,234,8,67,80,17,131,222,33,253,0,121,30,44,73,0,16,69,15,6,32,0,65,23,38,69,231,12,65,179,6,98,131,16,86,31,27,24,108,157,14,80,160,8,24,65,46,17,33,4,0,
-    96,2,18,144,191,65,226,8,68,19,5,171,199,80,9,15,180,199,67,89,5,32,255,24,79,173,28,174,201,24,79,179,50,32,1,24,122,5,10,82,61,10,180,209,83,19,8,32,128,24,80,129,27,111,248,43,131,
-    71,24,115,103,8,67,127,41,78,213,24,100,247,19,66,115,39,75,107,5,32,254,165,219,78,170,40,24,112,163,49,32,1,97,203,6,65,173,64,32,0,83,54,7,133,217,88,37,12,32,254,131,28,33,128,
-    3,67,71,44,84,183,6,32,5,69,223,33,96,7,7,123,137,16,192,211,24,112,14,9,32,255,67,88,29,68,14,10,84,197,38,33,0,22,116,47,50,32,87,106,99,9,116,49,15,89,225,15,97,231,23,70,41,19,
-    82,85,8,93,167,6,32,253,132,236,108,190,7,89,251,5,116,49,58,33,128,128,131,234,32,15,24,74,67,38,70,227,24,24,83,45,23,89,219,12,70,187,12,89,216,19,32,2,69,185,24,141,24,70,143,66,
-    24,82,119,56,78,24,10,32,253,133,149,132,6,24,106,233,7,69,198,48,178,203,81,243,12,68,211,15,106,255,23,66,91,15,69,193,7,100,39,10,24,83,72,16,176,204,33,19,0,88,207,45,68,21,12,
-    68,17,10,65,157,53,68,17,6,32,254,92,67,10,65,161,25,69,182,43,24,118,91,47,69,183,18,181,209,111,253,12,89,159,8,66,112,12,69,184,45,35,0,0,0,9,24,80,227,26,73,185,16,118,195,15,131,
-    15,33,1,0,65,59,15,66,39,27,160,111,66,205,12,148,111,143,110,33,128,128,156,112,24,81,199,8,75,199,23,66,117,20,155,121,32,254,68,126,12,72,213,29,134,239,149,123,89,27,16,148,117,
-    65,245,8,24,71,159,14,141,134,134,28,73,51,55,109,77,15,105,131,11,68,67,11,76,169,27,107,209,12,102,174,8,32,128,72,100,18,116,163,56,79,203,11,75,183,44,85,119,19,71,119,23,151,227,
-    32,1,93,27,8,65,122,5,77,102,8,110,120,20,66,23,8,66,175,17,66,63,12,133,12,79,35,8,74,235,33,67,149,16,69,243,15,78,57,15,69,235,16,67,177,7,151,192,130,23,67,84,29,141,192,174,187,
-    77,67,15,69,11,12,159,187,77,59,10,199,189,24,70,235,50,96,83,19,66,53,23,105,65,19,77,47,12,163,199,66,67,37,78,207,50,67,23,23,174,205,67,228,6,71,107,13,67,22,14,66,85,11,83,187,
-    38,124,47,49,95,7,19,66,83,23,67,23,19,24,96,78,17,80,101,16,71,98,40,33,0,7,88,131,22,24,89,245,12,84,45,12,102,213,5,123,12,9,32,2,126,21,14,43,255,0,128,128,0,0,20,0,128,255,128,
-    3,126,19,39,32,75,106,51,7,113,129,15,24,110,135,19,126,47,15,115,117,11,69,47,11,32,2,109,76,9,102,109,9,32,128,75,2,10,130,21,32,254,69,47,6,32,3,94,217,47,32,0,65,247,10,69,15,46,
-    65,235,31,65,243,15,101,139,10,66,174,14,65,247,16,72,102,28,69,17,14,84,243,9,165,191,88,47,48,66,53,12,32,128,71,108,6,203,193,32,17,75,187,42,73,65,16,65,133,52,114,123,9,167,199,
-    69,21,37,86,127,44,75,171,11,180,197,78,213,12,148,200,81,97,46,24,95,243,9,32,4,66,75,33,113,103,9,87,243,36,143,225,24,84,27,31,90,145,8,148,216,67,49,5,24,84,34,14,75,155,27,67,
-    52,13,140,13,36,0,20,0,128,255,24,135,99,46,88,59,43,155,249,80,165,7,136,144,71,161,23,32,253,132,33,32,254,88,87,44,136,84,35,128,0,0,21,81,103,5,94,47,44,76,51,12,143,197,151,15,
-    65,215,31,24,64,77,13,65,220,20,65,214,14,71,4,40,65,213,13,32,0,130,0,35,21,1,2,0,135,0,34,36,0,72,134,10,36,1,0,26,0,130,134,11,36,2,0,14,0,108,134,11,32,3,138,23,32,4,138,11,34,
-    5,0,20,134,33,34,0,0,6,132,23,32,1,134,15,32,18,130,25,133,11,37,1,0,13,0,49,0,133,11,36,2,0,7,0,38,134,11,36,3,0,17,0,45,134,11,32,4,138,35,36,5,0,10,0,62,134,23,32,6,132,23,36,3,
-    0,1,4,9,130,87,131,167,133,11,133,167,133,11,133,167,133,11,37,3,0,34,0,122,0,133,11,133,167,133,11,133,167,133,11,133,167,34,50,0,48,130,1,34,52,0,47,134,5,8,49,49,0,53,98,121,32,
-    84,114,105,115,116,97,110,32,71,114,105,109,109,101,114,82,101,103,117,108,97,114,84,84,88,32,80,114,111,103,103,121,67,108,101,97,110,84,84,50,48,48,52,47,130,2,53,49,53,0,98,0,121,
-    0,32,0,84,0,114,0,105,0,115,0,116,0,97,0,110,130,15,32,71,132,15,36,109,0,109,0,101,130,9,32,82,130,5,36,103,0,117,0,108,130,29,32,114,130,43,34,84,0,88,130,35,32,80,130,25,34,111,
-    0,103,130,1,34,121,0,67,130,27,32,101,132,59,32,84,130,31,33,0,0,65,155,9,34,20,0,0,65,11,6,130,8,135,2,33,1,1,130,9,8,120,1,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,
-    1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,
-    22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,130,187,8,66,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,
-    57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,130,243,9,75,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,
-    92,0,93,0,94,0,95,0,96,0,97,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,
-    63,1,64,1,65,0,172,0,163,0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,0,239,0,138,0,218,0,131,0,147,0,242,0,243,0,141,0,151,0,136,0,195,0,222,0,241,0,158,0,170,
-    0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,
-    212,0,213,0,104,0,235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,184,0,
-    161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,14,117,110,105,99,111,100,101,35,48,120,48,48,48,49,141,14,32,50,141,14,32,51,141,14,32,52,141,14,32,53,141,14,32,54,141,14,32,55,141,
-    14,32,56,141,14,32,57,141,14,32,97,141,14,32,98,141,14,32,99,141,14,32,100,141,14,32,101,141,14,32,102,140,14,33,49,48,141,14,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,
-    141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,45,49,102,6,100,101,108,101,116,101,4,69,117,114,
-    111,140,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,
-    32,56,141,236,32,56,141,236,32,56,65,220,13,32,57,65,220,13,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,
-    239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,35,57,102,0,0,5,250,72,249,98,247,
+// Exported using binary_to_compressed_c.exe -u8 -lz4 "ProggyClean.ttf" proggy_clean_ttf
+static const unsigned int proggy_clean_ttf_compressed_size = 7652;
+static const unsigned char proggy_clean_ttf_compressed_data[7652] =
+{
+    76,90,52,1,0,0,160,248,241,34,0,1,0,0,0,12,0,128,0,3,0,64,79,83,47,50,136,235,116,144,0,0,1,72,0,0,0,78,99,109,97,112,2,18,35,117,0,0,3,160,0,0,1,82,99,118,116,32,0,1,0,240,66,4,252,
+    0,0,0,2,103,108,121,102,18,175,137,86,0,0,7,4,0,0,146,128,104,101,97,100,215,145,102,211,0,0,0,204,0,0,0,54,104,104,101,97,8,66,1,195,0,0,1,4,0,0,0,36,104,109,116,120,138,0,126,128,
+    0,0,1,152,0,0,2,6,108,111,99,97,140,115,176,216,0,0,5,79,0,241,50,4,109,97,120,112,1,174,0,218,0,0,1,40,0,0,0,32,110,97,109,101,37,89,187,150,0,0,153,132,0,0,1,158,112,111,115,116,
+    166,172,131,239,0,0,155,36,0,0,5,210,112,114,101,112,105,2,1,18,0,0,4,244,0,0,0,8,204,0,225,1,0,0,60,85,233,213,95,15,60,245,0,3,8,174,0,64,183,103,119,132,8,0,160,189,146,166,215,
+    0,0,254,128,3,128,112,0,66,0,3,0,2,206,0,0,52,0,129,4,192,254,64,0,0,3,128,25,0,17,128,74,0,8,1,0,16,2,18,0,99,1,1,0,144,0,36,16,0,162,8,0,64,0,10,0,0,0,118,0,101,0,80,0,3,128,1,144,
+    201,0,130,2,188,2,138,0,0,0,143,8,0,66,1,197,0,50,103,0,63,4,9,0,1,0,2,162,65,108,116,115,0,64,0,0,32,172,73,0,66,5,0,1,128,138,0,47,3,128,2,0,47,33,1,128,203,0,0,216,0,1,12,0,16,1,
+    12,0,1,2,0,6,10,0,10,2,0,34,1,128,46,0,24,0,8,0,29,128,54,0,10,26,0,2,98,0,4,104,0,3,4,0,63,0,0,1,64,0,4,3,148,0,12,86,0,26,0,132,0,48,3,128,0,194,0,31,0,172,0,0,3,28,0,26,3,212,0,
+    21,0,68,0,1,32,0,1,148,1,4,26,0,0,86,1,7,120,0,55,3,128,0,132,0,19,1,184,0,28,1,212,0,15,16,0,4,0,116,0,111,1,0,1,0,0,0,68,1,3,9,140,0,15,64,0,9,31,128,2,0,12,2,168,2,2,1,0,19,28,150,
+    2,49,76,0,3,10,0,81,28,0,4,0,48,248,2,17,8,202,2,113,127,0,255,32,172,255,255,36,0,17,129,10,0,88,1,0,1,223,213,204,2,63,1,6,0,1,0,201,31,129,39,0,19,131,177,0,1,141,184,1,255,133,
+    15,0,31,198,2,0,48,241,204,244,1,28,1,158,2,20,2,136,2,252,3,20,3,88,3,156,3,222,4,20,4,50,4,80,4,98,4,162,5,22,5,102,5,188,6,18,6,116,6,214,7,56,7,126,7,236,8,78,8,108,8,150,8,208,
+    9,16,9,74,9,136,10,22,10,128,11,4,11,86,11,200,12,46,12,130,12,234,13,94,13,164,13,234,14,80,14,150,15,40,15,176,16,18,16,116,16,224,17,82,17,182,18,4,18,110,18,196,19,76,19,172,19,
+    246,20,88,20,174,20,234,21,64,21,128,21,166,21,184,22,18,22,126,22,198,23,52,23,142,23,224,24,86,24,186,24,238,25,54,25,150,25,212,26,72,26,156,26,240,27,92,27,200,28,4,28,76,28,150,
+    28,234,29,42,29,146,29,210,30,64,30,142,30,224,31,36,31,118,31,166,31,166,32,16,32,16,32,46,32,138,32,178,32,200,33,20,33,116,33,152,33,238,34,98,34,134,35,12,35,12,35,128,2,0,240,
+    206,152,35,176,35,216,36,0,36,74,36,104,36,144,36,174,37,6,37,96,37,130,37,248,37,248,38,88,38,170,38,170,38,216,39,64,39,154,40,10,40,104,40,168,41,14,41,32,41,184,41,248,42,54,42,
+    96,42,96,43,2,43,42,43,94,43,172,43,230,44,32,44,52,44,154,45,40,45,92,45,120,45,170,45,232,46,38,46,166,47,38,47,182,47,244,48,94,48,200,49,62,49,180,50,30,50,158,51,30,51,130,51,
+    238,52,92,52,206,53,58,53,134,53,212,54,38,54,114,54,230,55,118,55,216,56,58,56,166,57,18,57,116,57,174,58,46,58,154,59,6,59,124,59,232,60,58,60,150,61,34,61,134,61,236,62,86,62,198,
+    63,42,63,154,64,18,64,106,64,208,65,54,65,162,66,8,66,64,66,122,66,184,66,240,67,98,67,204,68,42,68,138,68,238,69,88,69,182,69,226,70,84,70,180,71,20,71,122,71,218,72,84,72,198,73,
+    64,212,5,3,22,6,255,63,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,0,119,0,123,
+    0,127,0,131,0,135,0,139,0,143,0,0,17,53,51,21,49,4,0,4,95,5,53,51,21,33,8,0,68,15,116,0,5,18,128,1,0,79,252,128,128,2,6,0,46,2,1,0,47,4,128,1,0,65,32,0,7,140,5,60,2,0,4,140,1,111,0,
+    1,53,51,21,7,4,0,0,90,3,53,51,21,1,69,0,30,3,88,0,112,255,0,128,128,0,6,1,245,7,57,128,4,128,92,0,1,90,0,19,51,64,1,8,8,0,116,1,0,128,128,128,254,128,5,0,43,4,0,171,0,34,0,24,248,7,
+    31,4,56,2,31,15,116,0,2,15,44,2,5,15,40,0,33,21,1,183,0,19,253,175,0,31,253,18,0,8,31,3,175,1,38,143,0,21,0,128,255,128,3,0,4,1,26,1,254,0,31,5,234,0,24,15,6,1,13,18,5,242,0,57,255,
+    0,128,215,0,1,16,0,57,255,0,128,248,0,47,255,0,239,0,34,0,235,1,31,20,240,1,30,39,0,19,156,3,27,51,198,0,8,12,0,31,7,28,0,8,23,51,228,3,118,128,128,1,128,128,253,0,192,1,52,128,128,
+    254,152,2,25,254,23,0,16,253,215,8,15,235,0,31,2,232,0,31,128,232,0,29,31,1,220,4,8,27,49,20,0,31,51,188,4,12,4,124,3,80,254,128,128,1,0,214,0,0,6,0,17,128,13,0,17,253,13,0,4,221,0,
+    17,253,14,1,3,247,0,15,234,0,32,48,3,1,128,5,12,5,16,4,9,100,4,3,84,4,6,246,3,110,0,0,11,1,0,255,64,4,6,24,1,5,216,2,23,7,8,0,7,4,0,39,29,1,8,0,39,2,0,160,2,6,1,0,12,102,4,15,184,0,
+    1,15,136,0,17,9,108,0,12,52,5,8,164,0,60,1,0,128,41,5,0,5,0,15,136,0,18,1,74,11,0,161,10,15,16,1,12,31,51,212,3,8,22,51,192,3,23,254,200,2,3,214,1,17,254,117,6,15,132,0,8,31,9,132,
+    0,8,5,208,1,31,5,50,5,4,25,7,42,5,3,7,0,31,2,108,0,6,16,4,179,1,1,82,13,4,108,0,43,0,37,86,1,3,78,1,11,213,1,1,215,13,18,128,110,2,7,168,0,1,30,4,15,170,7,3,8,210,6,33,0,2,217,14,4,
+    120,0,5,116,0,7,186,1,51,0,0,10,136,5,15,20,2,3,9,10,1,15,8,0,9,26,2,56,5,6,5,0,15,16,2,12,3,52,4,31,0,52,4,33,15,56,4,5,15,8,5,9,15,56,4,1,19,1,56,2,5,26,4,56,253,128,128,17,5,27,
+    128,52,4,15,28,5,34,31,14,232,0,18,9,226,6,8,228,5,12,134,3,12,254,1,3,198,6,24,254,119,0,63,254,128,128,225,4,22,47,0,15,136,1,20,15,126,1,2,4,150,0,8,4,0,31,7,166,0,1,6,106,1,1,176,
+    0,5,3,0,31,128,139,5,25,15,172,0,51,23,49,228,4,15,22,2,12,5,75,1,15,5,2,31,47,0,17,20,7,24,15,254,1,2,15,174,11,21,7,138,3,5,10,2,2,4,7,9,213,2,2,110,1,31,3,189,2,26,31,18,164,3,26,
+    15,158,4,2,8,214,6,7,24,0,15,130,1,10,9,134,3,15,129,1,37,4,197,0,31,17,196,0,24,9,150,8,15,204,2,1,15,74,13,17,18,1,55,2,4,221,2,11,96,4,15,198,0,32,2,112,21,15,196,0,11,15,124,1,
+    2,15,184,5,9,12,191,7,15,32,2,21,47,0,19,184,5,28,15,182,5,14,15,92,1,26,12,178,5,63,254,0,128,99,1,49,3,240,2,15,44,2,34,31,49,98,15,24,8,48,5,15,130,6,5,6,162,10,0,147,1,31,254,44,
+    2,29,18,4,16,15,7,224,8,5,204,7,26,3,170,10,5,186,8,20,254,60,0,18,6,176,8,11,28,9,13,64,0,15,10,10,0,43,255,0,77,0,5,84,1,0,244,22,15,244,9,7,9,114,3,27,49,162,5,7,8,0,0,254,10,1,
+    23,1,4,27,1,31,2,200,1,9,16,12,255,4,79,3,128,2,128,48,3,27,1,146,1,15,16,17,11,20,253,127,0,29,0,4,11,10,92,9,1,110,22,15,244,0,4,31,19,228,0,4,11,4,1,23,21,167,13,0,4,0,15,243,0,
+    10,1,116,0,15,188,2,7,15,190,7,14,5,26,17,14,170,7,15,162,7,10,1,40,17,31,26,216,16,38,0,16,19,15,74,3,10,31,49,212,9,0,15,16,0,5,26,33,72,0,63,29,1,53,134,8,6,4,24,14,6,159,18,8,9,
+    0,2,51,14,63,128,128,128,235,16,41,9,68,7,15,28,1,21,15,16,3,2,15,82,4,9,15,122,4,5,107,1,128,128,128,255,0,20,15,4,239,16,17,2,25,15,5,6,0,31,3,212,10,29,31,24,240,15,30,5,200,18,
+    31,19,192,0,16,31,49,118,7,32,9,168,3,15,212,11,3,11,246,0,63,253,0,128,203,18,44,3,220,11,31,128,220,11,17,15,204,0,1,12,234,15,15,74,8,1,6,176,2,21,128,233,13,15,222,6,23,15,156,
+    17,35,31,19,128,22,48,15,148,1,7,14,135,1,2,6,0,5,172,1,15,103,13,31,15,148,8,30,15,170,10,24,13,152,17,15,26,6,3,6,174,10,175,254,0,128,128,128,128,128,128,128,128,132,8,34,15,228,
+    12,22,15,196,0,41,15,180,0,6,31,3,216,4,77,15,4,3,5,31,33,20,4,20,14,20,3,4,224,19,63,2,0,128,38,12,39,15,40,3,38,31,33,170,13,28,15,56,3,9,15,163,4,5,15,48,3,3,63,2,0,128,145,16,33,
+    16,12,28,18,31,2,232,0,9,13,172,1,31,7,140,16,12,29,1,151,20,15,76,12,20,1,216,12,15,140,0,23,31,7,140,0,21,9,13,17,15,139,0,19,15,176,15,27,15,250,1,9,31,51,216,12,20,25,128,248,4,
+    4,159,7,4,63,26,3,181,7,4,50,5,15,184,15,27,15,48,14,20,31,7,4,0,8,15,0,11,4,15,55,27,13,14,88,3,15,28,10,44,23,17,16,24,27,49,32,24,31,49,24,10,24,31,33,12,0,4,9,40,25,1,5,10,31,1,
+    22,10,8,41,1,0,9,0,5,229,28,15,37,10,44,15,80,9,48,15,60,25,1,31,51,12,0,4,12,84,25,12,64,11,8,12,0,21,128,65,26,4,114,5,109,1,0,128,253,0,128,94,25,6,102,25,4,7,0,15,90,9,39,31,16,
+    16,1,22,15,72,26,10,15,164,8,17,21,1,111,3,15,155,8,6,63,128,128,1,136,15,28,31,0,76,16,29,31,19,242,10,36,28,5,212,7,14,76,16,24,253,225,7,15,71,4,27,0,228,7,47,255,128,188,12,35,
+    15,140,1,33,23,51,160,16,15,148,1,21,15,101,9,31,15,20,11,79,31,49,254,5,18,15,174,1,11,15,0,6,39,3,230,0,15,160,9,40,11,184,0,12,168,16,63,29,1,53,240,0,7,26,1,100,14,8,191,8,15,172,
+    1,31,2,64,25,15,64,6,17,15,64,35,14,15,232,6,5,15,181,11,1,15,93,13,22,15,100,1,28,31,19,168,35,52,15,68,13,7,14,39,3,15,115,1,30,15,112,1,24,15,180,0,13,12,130,33,1,112,1,5,52,7,13,
+    147,31,31,254,166,24,27,31,0,80,35,42,31,17,20,8,8,31,33,88,8,20,4,180,4,15,232,3,1,3,232,0,14,52,8,11,88,8,6,155,33,5,13,1,15,56,7,82,15,188,12,13,31,5,190,10,20,9,141,5,6,113,18,
+    8,185,5,15,55,7,23,31,12,208,1,14,15,120,2,10,31,51,234,14,1,11,112,2,25,254,172,12,31,3,228,3,66,31,49,140,25,8,15,46,29,17,9,112,11,8,46,29,6,100,13,15,212,3,27,31,15,0,34,12,15,
+    56,29,6,31,7,4,0,16,10,94,21,15,130,0,3,15,29,34,15,5,172,0,15,152,32,12,31,19,26,35,0,15,8,0,0,31,21,130,0,28,31,0,36,1,35,15,32,1,17,15,158,14,10,7,52,25,15,36,1,27,31,1,188,33,20,
+    31,51,82,30,8,56,1,128,128,239,38,8,142,8,15,141,0,8,32,0,0,84,34,18,255,18,47,11,116,41,31,21,82,42,15,12,78,0,17,2,170,25,4,204,0,5,138,36,0,42,1,3,133,0,19,0,216,4,15,56,36,7,15,
+    16,12,0,8,168,8,15,112,22,25,2,162,1,5,42,23,11,147,27,31,2,184,8,23,4,148,20,31,128,148,20,25,31,7,192,19,8,15,114,21,30,31,128,100,10,7,5,106,10,15,117,2,23,11,140,30,31,3,64,18,
+    24,15,236,19,1,15,214,29,7,8,229,22,31,2,104,1,64,31,1,82,35,8,15,104,1,29,63,2,128,128,47,2,3,14,59,2,15,106,1,31,15,248,2,37,15,76,25,14,15,132,1,19,31,253,137,1,24,13,20,25,15,144,
+    1,13,15,106,6,2,31,5,184,11,16,57,1,128,128,197,7,31,254,101,6,29,0,88,1,16,21,175,8,15,88,1,18,11,132,44,15,44,2,41,15,16,6,7,15,57,2,11,5,241,0,31,2,92,18,34,31,17,32,3,24,15,132,
+    4,46,31,33,124,4,22,31,1,18,3,27,49,0,0,8,184,22,15,200,0,1,1,154,1,31,1,146,7,8,28,1,162,31,111,4,0,128,128,254,128,60,21,6,15,8,8,12,15,112,0,14,12,230,1,110,2,0,128,255,0,128,150,
+    22,15,135,0,6,8,145,0,31,16,192,1,22,13,190,1,15,154,22,29,7,99,28,15,146,22,9,15,169,8,24,0,152,32,15,184,1,6,9,152,32,15,70,9,13,15,58,9,1,15,137,0,11,6,128,47,15,232,3,24,9,72,16,
+    12,220,13,31,33,12,0,32,6,92,47,13,10,14,15,9,0,5,31,2,136,30,36,15,208,4,13,15,216,29,38,15,204,3,16,31,2,168,0,57,31,1,102,5,36,15,78,37,4,31,253,199,6,26,3,84,8,15,32,6,26,15,90,
+    1,34,15,200,21,31,12,206,21,31,2,40,31,32,15,216,0,27,15,244,6,53,31,7,236,6,24,15,216,0,32,31,10,88,2,10,1,158,1,31,51,64,26,0,15,22,31,2,0,137,0,111,1,0,128,253,128,128,141,0,14,
+    47,0,13,208,2,16,15,68,1,1,8,74,21,15,166,12,2,57,1,0,128,136,46,15,21,1,17,127,0,0,0,13,1,0,0,116,24,13,9,0,11,15,110,9,8,9,62,37,63,1,0,128,41,21,0,31,3,78,3,17,15,156,4,24,15,12,
+    21,35,31,1,85,2,13,15,245,3,19,15,68,2,16,15,224,20,18,15,213,20,6,31,2,108,25,13,15,172,6,25,15,192,20,34,15,212,6,1,15,168,20,12,9,159,20,31,2,149,6,25,15,80,1,24,27,51,4,12,13,192,
+    54,26,254,165,44,2,29,5,31,2,196,5,64,31,33,216,11,52,15,150,2,16,15,215,11,38,15,240,7,39,15,136,20,5,15,170,17,5,12,120,20,31,2,240,3,20,31,255,0,14,24,31,5,56,11,3,12,134,54,10,
+    8,44,11,233,50,15,100,20,27,16,0,16,55,0,228,11,31,0,152,55,11,31,7,4,0,20,31,1,243,20,37,15,44,1,22,31,19,20,1,12,15,68,1,4,31,21,20,52,0,2,9,0,15,43,1,24,0,174,68,47,1,128,76,45,
+    2,9,96,2,31,33,132,43,0,3,158,37,4,81,43,63,2,0,128,97,0,0,2,192,17,0,78,20,15,80,48,44,12,204,6,15,220,17,9,15,78,38,6,23,254,88,16,5,75,38,31,0,184,17,29,17,4,76,22,31,0,248,55,10,
+    31,128,248,55,4,31,16,20,2,18,13,252,32,15,64,17,21,8,40,0,5,76,3,13,75,17,15,39,2,27,1,186,0,104,6,1,0,255,128,2,236,56,1,60,48,31,37,44,63,19,14,69,1,18,3,228,4,21,0,108,59,8,206,
+    6,12,248,8,15,36,15,16,15,220,57,18,15,110,18,3,15,109,4,36,15,124,17,28,15,160,0,13,15,184,0,17,11,176,0,12,186,0,15,114,17,27,1,132,58,28,3,192,0,9,164,59,7,74,24,7,154,7,63,4,0,
+    128,40,45,38,12,96,9,8,180,52,31,51,184,36,4,26,2,225,46,6,85,3,7,152,36,31,3,28,20,24,0,172,0,31,5,28,20,30,31,51,120,4,15,15,74,33,31,5,125,7,15,82,33,7,31,4,116,38,35,16,5,164,50,
+    26,2,68,8,5,130,1,23,5,156,12,22,1,134,0,31,2,12,48,2,31,0,188,38,45,31,51,98,14,16,15,120,35,21,31,51,196,68,2,8,3,49,7,178,38,8,20,0,15,77,36,35,10,13,1,15,60,2,62,15,62,30,37,4,
+    60,2,31,254,71,30,12,15,60,2,36,2,8,65,29,128,8,65,4,48,2,11,7,65,33,0,3,72,69,15,56,65,0,23,5,134,28,7,50,0,1,120,69,13,56,5,15,120,69,16,15,122,62,2,1,216,54,15,200,69,36,15,80,0,
+    3,31,13,200,64,12,5,112,6,12,110,21,15,192,5,1,15,148,68,1,4,205,64,25,0,91,55,15,172,5,13,15,48,64,38,19,7,228,9,13,208,29,31,17,208,29,15,31,1,0,9,1,3,112,1,11,132,56,14,100,1,11,
+    237,35,2,244,26,0,190,56,15,196,34,18,15,172,21,1,31,49,52,4,8,12,60,6,14,38,6,9,8,0,31,3,116,35,24,15,176,9,22,5,190,66,15,22,18,37,8,18,6,6,7,0,5,164,2,63,255,0,128,44,2,18,14,252,
+    5,27,19,122,0,19,5,34,1,2,113,0,13,251,5,31,21,92,23,30,30,83,242,5,15,190,16,1,15,112,20,9,15,234,5,1,15,98,23,2,11,247,5,21,1,59,7,31,2,196,65,33,15,200,9,30,15,230,1,5,15,130,15,
+    21,13,192,5,12,188,5,15,240,1,23,2,176,4,2,164,7,15,32,11,14,19,51,180,0,15,98,37,21,4,41,57,15,101,37,8,2,170,0,31,255,171,25,13,15,200,75,11,31,3,124,15,19,31,3,106,0,3,3,200,44,
+    63,0,3,128,12,43,23,15,122,70,9,15,8,0,1,31,51,206,5,15,6,104,74,8,184,70,0,95,74,31,0,24,32,35,15,32,47,29,15,36,14,9,15,186,67,6,30,128,36,14,15,184,67,29,9,140,27,31,128,140,27,
+    27,15,20,58,49,8,236,20,15,112,41,0,10,40,58,1,235,4,31,3,173,33,31,31,16,8,11,22,15,196,40,18,15,238,13,9,15,111,3,5,8,239,13,31,3,164,29,27,15,16,19,9,15,14,19,2,31,3,10,19,21,12,
+    62,9,63,255,0,128,104,48,1,15,196,35,24,15,2,18,5,9,16,19,27,51,76,20,31,5,244,34,16,6,98,22,7,169,21,31,4,254,17,28,70,2,1,0,4,108,10,6,86,5,6,76,0,0,138,85,15,20,53,41,0,64,82,15,
+    254,57,6,15,60,63,9,15,12,52,5,31,49,32,40,0,15,230,58,4,22,0,48,24,4,198,44,25,1,8,0,5,25,0,6,108,3,15,29,53,42,1,49,1,16,11,164,1,15,40,56,8,63,0,1,53,242,39,3,15,246,1,7,7,103,49,
+    15,164,0,13,4,208,65,15,196,66,10,15,28,6,9,10,100,81,60,0,128,128,209,24,15,218,65,9,18,7,36,57,14,156,11,31,19,108,29,8,7,66,0,15,149,3,0,47,0,30,128,2,46,0,192,84,15,132,2,14,31,
+    51,144,54,0,12,72,7,15,32,0,9,15,140,2,20,5,102,22,8,91,47,11,18,0,15,142,2,56,6,4,43,31,4,4,86,1,15,52,13,17,31,4,104,23,2,95,128,2,128,2,128,224,36,5,15,188,42,9,15,252,80,1,15,183,
+    4,2,7,144,76,31,3,160,25,16,15,10,79,14,15,48,8,4,9,137,6,4,141,76,31,0,64,68,7,8,200,31,31,2,124,37,7,8,112,2,9,166,12,15,254,42,2,8,47,11,15,196,5,7,31,0,116,0,33,15,106,4,1,7,241,
+    0,31,0,114,0,12,0,36,6,1,82,25,8,36,6,21,5,40,38,5,246,44,0,120,12,47,0,255,100,13,21,15,192,28,18,31,49,158,3,0,25,51,240,13,15,118,34,6,7,20,33,127,253,0,128,255,0,128,2,180,10,27,
+    31,26,76,56,26,15,36,70,10,15,62,17,1,31,51,16,0,8,15,156,5,17,9,152,16,15,50,85,3,31,254,5,0,5,31,3,76,4,45,16,9,220,93,31,2,176,72,3,13,238,8,15,12,0,1,11,78,25,31,2,126,2,2,1,28,
+    74,16,254,102,0,7,152,17,27,5,150,14,31,1,165,9,0,1,156,4,15,124,41,8,31,5,226,42,11,22,255,206,74,15,25,3,5,31,0,136,3,14,31,1,248,11,20,30,1,244,70,15,18,5,9,6,64,36,31,128,64,36,
+    15,15,60,2,13,28,128,166,32,15,226,31,14,79,0,0,0,22,52,22,32,30,87,44,25,31,33,60,25,8,12,242,3,27,5,48,19,8,88,1,24,2,250,3,14,88,25,8,70,72,5,120,17,15,220,91,38,31,0,0,1,79,15,
+    186,38,21,7,210,47,15,0,1,6,8,151,39,25,0,33,0,15,2,1,40,3,32,65,31,5,24,5,40,15,218,5,1,31,5,8,5,0,31,5,236,11,4,15,24,2,21,25,0,115,79,3,109,4,63,254,0,128,27,2,65,12,220,39,15,216,
+    76,9,31,3,204,76,0,15,234,31,2,6,62,21,8,39,70,15,156,18,6,4,252,55,31,5,68,61,23,24,29,28,46,15,188,75,81,31,4,7,20,22,10,208,56,15,212,0,24,1,152,0,31,3,212,0,44,5,4,47,15,213,0,
+    65,31,20,68,4,30,13,80,6,15,180,1,49,21,254,9,59,15,229,0,24,15,190,1,27,31,0,236,0,37,9,228,8,15,236,0,48,6,195,14,15,236,0,72,4,124,59,15,24,18,24,15,204,1,50,31,0,200,1,26,31,0,
+    215,0,26,15,240,6,40,31,49,176,61,12,15,184,2,44,31,0,190,2,36,15,240,6,27,31,23,124,16,36,15,140,46,2,15,222,58,1,31,49,254,0,24,10,30,6,57,253,128,128,26,18,3,202,6,14,16,13,15,243,
+    11,38,2,76,26,111,254,128,3,128,4,0,100,86,41,15,58,80,13,28,5,210,11,15,70,80,5,4,175,10,15,67,69,30,4,192,93,15,136,4,28,9,32,7,15,186,78,29,15,38,27,1,24,254,6,29,11,161,46,15,71,
+    6,28,2,218,0,15,216,0,35,15,238,27,6,15,216,0,33,2,44,7,15,218,0,62,4,160,34,63,0,5,0,124,101,33,31,51,186,1,57,15,26,27,0,15,228,0,4,15,192,1,36,63,4,128,0,32,7,30,15,152,2,57,15,
+    219,0,11,31,0,216,0,31,18,13,184,79,31,5,116,34,13,13,98,3,31,5,148,64,13,13,215,27,4,171,15,15,127,1,17,15,152,0,22,13,34,3,31,5,54,57,18,12,243,100,15,154,0,24,63,0,0,14,156,0,16,
+    31,55,226,2,7,15,58,1,16,63,255,0,128,62,1,11,15,64,1,21,15,156,31,23,15,158,0,22,15,155,0,7,15,147,31,17,31,21,176,29,30,31,83,222,87,31,15,62,86,34,5,225,23,15,59,86,0,31,0,146,7,
+    30,31,25,144,9,34,2,128,15,15,90,11,6,15,130,79,57,10,54,26,15,134,79,30,15,123,11,32,12,144,46,15,32,1,20,15,0,15,18,15,140,79,13,15,67,72,3,12,105,72,15,0,7,24,31,0,196,0,30,15,240,
+    14,14,15,196,0,9,11,232,14,15,197,0,55,15,184,15,32,15,224,14,21,15,32,81,19,31,254,213,0,25,15,217,0,23,15,216,0,32,15,204,14,21,15,216,0,13,12,196,14,15,216,0,58,31,16,188,14,22,
+    15,184,14,18,15,244,22,12,15,160,1,23,31,0,116,2,24,15,44,107,10,31,19,182,34,4,15,190,55,6,15,188,55,16,6,16,22,31,4,32,15,36,15,232,72,1,15,106,5,1,15,154,5,9,8,8,21,5,26,14,5,242,
+    21,9,105,5,10,137,5,7,38,27,31,3,16,23,37,15,116,20,40,15,84,80,41,18,1,156,1,15,83,80,20,31,4,204,17,38,15,120,20,29,15,216,0,45,5,76,13,15,218,0,69,15,124,20,52,15,188,1,46,15,48,
+    85,11,15,232,0,5,15,60,22,34,15,144,19,33,15,224,0,42,31,0,220,0,28,31,0,157,2,28,31,13,132,25,16,15,146,2,18,12,32,43,3,126,2,31,0,33,43,10,15,205,12,19,15,244,41,24,31,19,194,71,
+    24,15,96,40,2,15,192,71,4,31,128,92,95,29,0,87,1,18,25,44,78,63,4,128,0,96,11,36,31,49,226,20,44,15,26,42,13,15,6,112,4,15,176,98,8,3,221,26,63,4,0,128,216,26,40,15,244,40,31,12,218,
+    15,15,224,78,35,5,147,35,15,228,78,5,63,4,0,128,63,3,24,15,188,41,33,31,5,200,0,48,7,30,16,15,202,0,53,15,76,78,36,15,58,16,0,15,154,1,37,6,78,16,15,212,0,13,15,214,0,23,15,16,19,40,
+    15,218,0,56,8,14,67,15,220,0,15,15,180,1,25,15,164,112,28,31,1,212,0,53,15,207,0,15,31,3,168,1,33,15,120,22,33,31,51,84,3,52,22,1,16,24,15,89,3,12,31,128,62,8,30,47,0,22,48,52,32,31,
+    87,50,52,7,15,100,101,21,15,68,42,11,22,254,192,11,15,50,52,55,2,248,6,31,15,128,68,20,15,46,83,30,13,140,121,15,58,83,2,31,255,59,56,20,15,144,6,56,15,120,82,38,31,255,124,82,11,15,
+    199,5,30,15,148,6,37,31,3,204,0,45,5,165,0,15,205,0,56,15,148,6,53,15,210,0,42,31,254,213,0,18,15,164,1,34,15,184,5,39,15,232,84,40,15,207,0,11,31,3,204,0,29,31,9,228,80,8,13,42,3,
+    15,222,80,5,14,163,82,15,133,0,5,15,112,0,14,9,206,2,15,18,83,18,15,113,0,12,5,200,81,15,160,41,10,12,118,2,15,122,0,9,31,254,37,52,3,15,240,0,9,31,128,240,0,7,31,51,96,1,16,15,115,
+    0,2,31,254,52,9,57,31,49,10,19,0,15,102,88,29,10,114,77,6,241,57,15,99,88,5,15,164,52,32,8,204,15,15,36,5,26,31,51,10,30,8,15,220,15,21,6,28,29,63,254,128,128,35,86,25,15,233,58,17,
+    15,140,61,27,15,192,6,10,15,160,1,17,31,255,112,82,14,15,238,5,23,15,72,62,29,31,5,188,0,40,7,60,13,15,190,0,53,15,36,61,32,15,164,6,13,15,104,123,16,15,188,94,3,15,31,3,7,15,202,0,
+    17,15,24,3,56,15,206,0,28,8,24,3,15,208,0,19,15,156,1,21,15,48,60,28,31,51,24,3,44,15,195,0,16,15,99,7,22,1,0,55,15,72,11,1,31,0,74,36,5,26,1,28,132,2,193,11,8,106,0,1,179,120,0,228,
+    5,15,20,62,24,9,112,13,15,104,66,1,15,128,130,9,31,49,198,11,4,23,2,192,124,31,0,126,130,0,6,131,89,31,0,218,30,31,8,40,62,15,16,5,28,15,164,21,36,3,52,77,15,7,95,18,15,184,2,27,15,
+    20,5,28,15,68,23,36,2,20,5,15,194,0,57,15,20,5,42,15,198,0,39,15,86,7,13,15,74,18,31,15,68,4,39,15,76,2,37,15,195,0,18,31,3,192,0,24,3,244,95,15,136,22,26,15,86,2,46,15,216,36,7,31,
+    254,35,84,25,15,53,14,27,9,200,10,31,255,100,135,28,31,19,130,100,52,15,76,24,13,15,88,24,42,8,217,1,4,216,1,15,116,75,34,15,216,1,57,15,182,2,22,11,240,0,31,255,25,100,32,69,0,21,
+    1,2,159,148,53,36,0,72,152,152,53,26,0,130,130,152,51,14,0,108,12,0,23,3,24,0,23,4,12,0,18,5,150,67,1,1,0,17,6,24,0,4,252,149,51,18,0,20,12,0,83,1,0,13,0,49,12,0,83,2,0,7,0,38,12,0,
+    83,3,0,17,0,45,12,0,23,4,36,0,83,5,0,10,0,62,12,0,17,6,24,0,49,3,0,1,204,152,0,168,0,2,12,0,2,168,0,2,12,0,2,168,0,2,12,0,83,3,0,34,0,122,12,0,23,4,36,0,2,168,0,2,12,0,2,168,0,147,
+    50,0,48,0,48,0,52,0,47,6,0,241,64,49,0,53,98,121,32,84,114,105,115,116,97,110,32,71,114,105,109,109,101,114,82,101,103,117,108,97,114,84,84,88,32,80,114,111,103,103,121,67,108,101,
+    97,110,84,84,50,48,48,52,47,48,52,47,49,53,0,98,0,121,0,32,0,84,0,114,0,105,0,115,0,116,0,97,0,110,0,32,0,71,16,0,241,32,109,0,109,0,101,0,114,0,82,0,101,0,103,0,117,0,108,0,97,0,114,
+    0,84,0,84,0,88,0,32,0,80,0,114,0,111,0,103,0,103,0,121,0,67,0,108,0,101,60,0,0,30,0,21,0,40,154,2,246,68,12,28,154,0,24,154,0,5,0,241,46,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,
+    1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,215,3,241,68,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,
+    0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,82,1,250,255,100,49,0,50,0,51,0,52,0,53,0,54,
+    0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,
+    0,91,0,92,0,93,0,94,0,95,0,96,0,97,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,
+    1,62,1,63,1,64,1,65,0,172,0,163,0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,0,239,0,138,0,218,0,131,0,147,0,242,0,243,0,141,0,151,0,136,0,195,0,222,0,241,0,158,
+    0,170,0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,
+    214,0,212,0,213,0,104,0,235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,
+    184,0,161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,14,117,110,105,99,111,100,101,35,48,120,48,48,48,49,15,0,26,50,15,0,26,51,15,0,26,52,15,0,26,53,15,0,26,54,15,0,26,55,15,0,26,56,
+    15,0,26,57,15,0,26,97,15,0,26,98,15,0,26,99,15,0,26,100,15,0,26,101,15,0,25,102,15,0,42,49,48,15,0,10,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,
+    26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,233,49,102,6,100,101,108,101,116,101,4,69,117,114,111,27,0,26,56,237,0,26,56,237,0,26,56,237,0,26,
+    56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,221,1,26,57,221,1,26,57,240,0,26,57,240,0,26,
+    57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,25,57,240,0,80,48,57,102,0,0,
 };
 
 static const char* GetDefaultCompressedFontDataTTF(int* out_size)
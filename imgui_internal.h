@@ -142,6 +142,7 @@ struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImFontAtlasBuilder;          // Internal storage for incrementally packing and building a ImFontAtlas
+struct ImFontAtlasGlyphBitmap;      // Glyph pixels rasterized by a font loader, not yet packed
 struct ImFontAtlasPostProcessData;  // Data available to potential texture post-processing functions
 struct ImFontAtlasRectEntry;        // Packed rectangle lookup entry
 
@@ -177,6 +178,7 @@ struct ImGuiTable;                  // Storage for a table
 struct ImGuiTableHeaderData;        // Storage for TableAngledHeadersRow()
 struct ImGuiTableColumn;            // Storage for one column of a table
 struct ImGuiTableInstanceData;      // Storage for one instance of a same table
+struct ImGuiTableRowCache;          // Storage for ImGuiTableFlags_CacheRows
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
@@ -830,6 +832,43 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: AddConcavePolyFilled() switches from ear-clipping to monotone decomposition above this number of points (default for ImDrawListSharedData::ConcaveMonotoneMinPoints).
+#ifndef IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS
+#define IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS                 64
+#endif
+
+// ImDrawList: With ImDrawListFlags_AllowInstances, a run of fewer instances than this is converted back to triangles when followed by a triangle primitive or a clip rect/texture change,
+// so it may be merged with neighbor triangle commands instead of costing an extra draw call. Set to 0 to always keep instances.
+#ifndef IM_DRAWLIST_INSTANCES_MIN_RUN
+#define IM_DRAWLIST_INSTANCES_MIN_RUN                           16
+#endif
+
+// ImDrawList: Cache of auto-tessellated bezier curves, opt-in with ImDrawListFlags_CacheCurves.
+// Points are stored relative to first control point.
+// Entries not used during previous frame are discarded when they represent more than half of stored points.
+// Translated curves hit the cache when differences between control points are exactly the same.
+struct ImDrawListCurveCacheEntry
+{
+    float           Key[7];                     // Control points relative to first control point, then tessellation tolerance
+    int             LastUsedFrame;
+    int             PointsOffset;               // Offset in ImDrawListCurveCache::Points[]
+    int             PointsCount;
+};
+
+struct IMGUI_API ImDrawListCurveCache
+{
+    ImGuiStorage                        Map;                // Key hash -> Index in Entries[]
+    ImVector<ImDrawListCurveCacheEntry> Entries;
+    ImVector<ImVec2>                    Points;
+    int                                 Frame;
+    int                                 FrameUsedPointsCount;
+    int                                 LastEntryIdx;       // Index of last used entry. Next lookup tries following entry first.
+
+    ImDrawListCurveCache()              { Frame = FrameUsedPointsCount = 0; LastEntryIdx = -1; }
+    void    Clear()                     { Map.Clear(); Entries.clear(); Points.clear(); FrameUsedPointsCount = 0; LastEntryIdx = -1; }
+    void    NewFrame();                 // Called by ImGui::NewFrame(). Call manually if you use ImDrawList without a Dear ImGui context.
+};
+
 // Data shared between all ImDrawList instances
 // Conceptually this could have been called e.g. ImDrawListSharedContext
 // Typically one ImGui context would create and maintain one of this.
@@ -844,12 +883,14 @@ struct IMGUI_API ImDrawListSharedData
     float           FontScale;                  // Current font scale (== FontSize / Font->FontSize)
     float           CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo()
     float           CircleSegmentMaxError;      // Number of circle segments to use per pixel of radius for AddCircle() etc
+    int             ConcaveMonotoneMinPoints;   // AddConcavePolyFilled() uses monotone decomposition instead of ear-clipping for polygons with this number of points or more. Default to IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS.
     float           InitialFringeScale;         // Initial scale to apply to AA fringe
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
     ImVector<ImVec2> TempBuffer;                // Temporary write buffer
     ImVector<ImDrawList*> DrawLists;            // All draw lists associated to this ImDrawListSharedData
     ImGuiContext*   Context;                    // [OPTIONAL] Link to Dear ImGui context. 99% of ImDrawList/ImFontAtlas can function without an ImGui context, but this facilitate handling one legacy edge case.
+    ImDrawListCurveCache CurveCache;            // Cache for PathBezierXXXCurveTo() when using ImDrawListFlags_CacheCurves
 
     // Lookup tables
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
@@ -1196,11 +1237,63 @@ struct IMGUI_API ImGuiInputTextDeactivatedState
 #define IMSTB_TEXTEDIT_STRING             ImGuiInputTextState
 #define IMSTB_TEXTEDIT_CHARTYPE           char
 #define IMSTB_TEXTEDIT_GETWIDTH_NEWLINE   (-1.0f)
-#define IMSTB_TEXTEDIT_UNDOSTATECOUNT     99
-#define IMSTB_TEXTEDIT_UNDOCHARCOUNT      999
+#define IMSTB_TEXTEDIT_CUSTOM_UNDO                      // Undo/redo records are stored in ImGuiInputTextState::UndoStack/RedoStack
 namespace ImStb { struct STB_TexteditState; }
 typedef ImStb::STB_TexteditState ImStbTexteditState;
 
+// Memory budget of InputText() undo/redo history (records + stored text).
+// Oldest records are dropped when exceeding it, but the most recent one is always kept, however large.
+#ifndef IMGUI_INPUTTEXT_UNDO_MAX_BYTES
+#define IMGUI_INPUTTEXT_UNDO_MAX_BYTES    (4 * 1024 * 1024)
+#endif
+
+// Size of chunks allocated by InputText() when using ImGuiInputTextFlags_ChunkedText. Chunks are filled up to half of it, leaving room to insert text.
+// An edit moves at most one chunk worth of text, but a single line is never split: a line longer than this is edited as a whole.
+#ifndef IMGUI_INPUTTEXT_CHUNK_SIZE
+#define IMGUI_INPUTTEXT_CHUNK_SIZE        (16 * 1024)
+#endif
+
+// Chunk of text owned by ImGuiInputTextState when using ImGuiInputTextFlags_ChunkedText.
+// Chunks are only split after a '\n', so every line is contiguous in memory. Only the last chunk may not end with a '\n', or be empty.
+struct ImGuiInputTextChunk
+{
+    char*                   Data;
+    int                     Offset;                 // offset of Data[0] in text
+    int                     Size;
+    int                     Capacity;
+};
+
+// Undo or redo record of InputText(). Applying it deletes DeleteLen bytes at Where, then inserts the InsertLen bytes it stores.
+// Records only store the text they need to put back (diff), not copies of the buffer.
+struct ImGuiInputTextUndoRecord
+{
+    int                     Where;
+    int                     DeleteLen;
+    int                     InsertLen;
+    int                     CharsOffset;            // offset of the InsertLen stored bytes in ImGuiInputTextUndoStack::Chars[]
+    int                     CoalesceKind;           // 0: none, 1: typed characters, 2: characters deleted with Backspace/Delete. Consecutive records of same kind are merged.
+    bool                    GroupWithPrevious;      // applied together with the record below it (e.g. paste over a selection, or multiple edits by a callback)
+};
+
+// Stack of undo (or redo) records for InputText(), growable. Most recent record is last.
+// Oldest records are dropped by advancing RecordsHead/CharsHead, arrays are compacted once half of them is dead.
+struct IMGUI_API ImGuiInputTextUndoStack
+{
+    ImVector<ImGuiInputTextUndoRecord>  Records;    // Records[RecordsHead..] are alive
+    ImVector<char>                      Chars;      // Chars[CharsHead..] are alive
+    int                                 RecordsHead;
+    int                                 CharsHead;
+
+    ImGuiInputTextUndoStack()           { RecordsHead = CharsHead = 0; }
+    int         GetRecordsCount() const { return Records.Size - RecordsHead; }
+    size_t      GetMemoryBytes() const  { return (size_t)GetRecordsCount() * sizeof(ImGuiInputTextUndoRecord) + (size_t)(Chars.Size - CharsHead); }
+    void        Clear()                 { Records.resize(0); Chars.resize(0); RecordsHead = CharsHead = 0; }
+    void        ClearFreeMemory()       { Records.clear(); Chars.clear(); RecordsHead = CharsHead = 0; }
+    char*       PushRecord(int where, int delete_len, int insert_len, int coalesce_kind); // Return storage for insert_len bytes
+    void        PopRecord();
+    void        DropOldestRecord();
+};
+
 // Internal state of the currently focused/edited text input box
 // For a given item ID, access with ImGui::GetInputTextState()
 struct IMGUI_API ImGuiInputTextState
@@ -1210,24 +1303,37 @@ struct IMGUI_API ImGuiInputTextState
     ImGuiInputTextFlags     Flags;                  // copy of InputText() flags. may be used to check if e.g. ImGuiInputTextFlags_Password is set.
     ImGuiID                 ID;                     // widget id owning the text state
     int                     TextLen;                // UTF-8 length of the string in TextA (in bytes)
-    const char*             TextSrc;                // == TextA.Data unless read-only, in which case == buf passed to InputText(). Field only set and valid _inside_ the call InputText() call.
-    ImVector<char>          TextA;                  // main UTF8 buffer. TextA.Size is a buffer size! Should always be >= buf_size passed by user (and of course >= CurLenA + 1).
+    const char*             TextSrc;                // == TextA.Data unless read-only, in which case == buf passed to InputText(). NULL when using TextChunks[]. Field only set and valid _inside_ the call InputText() call.
+    ImVector<char>          TextA;                  // main UTF8 buffer. TextA.Size is a buffer size! Should always be >= buf_size passed by user (and of course >= CurLenA + 1). Contiguous: inserting/deleting moves the tail, so an edit is O(text length after it). Scratch buffer when using TextChunks[].
+    ImVector<ImGuiInputTextChunk> TextChunks;       // main UTF8 storage instead of TextA when TextChunked is set: an edit is O(chunk size).
+    bool                    TextChunked;            // set on activation with ImGuiInputTextFlags_ChunkedText
     ImVector<char>          TextToRevertTo;         // value to revert to when pressing Escape = backup of end-user buffer at the time of focus (in UTF-8, unaltered)
-    ImVector<char>          CallbackTextBackup;     // temporary storage for callback to support automatic reconcile of undo-stack
+    ImVector<char>          CallbackTextBackup;     // temporary storage for callback to support automatic reconcile of undo-stack. Not used for text larger than IMGUI_INPUTTEXT_UNDO_MAX_BYTES.
+    bool                    CallbackRecordEdits;    // set during callback when there is no backup: ImGuiInputTextCallbackData::InsertChars()/DeleteChars() record their edits directly
+    int                     CallbackRecordedEdits;  // number of edits recorded by InsertChars()/DeleteChars() during current callback
+    ImGuiInputTextUndoStack UndoStack;
+    ImGuiInputTextUndoStack RedoStack;
+    int                     UndoCoalesceKind;       // kind of edit being performed by stb_textedit (see ImGuiInputTextUndoRecord::CoalesceKind)
+    int                     UndoGroupSize;          // number of records created since UndoGroupBegin(), -1 when not grouping
+    ImVector<int>           LineOffsets;            // offset of each line in TextSrc (LineOffsets[0] == 0). Updated incrementally by edits, or rebuilt on demand when LineOffsetsDirty is set.
+    bool                    LineOffsetsDirty;       // text was replaced or may have changed (e.g. read-only): rebuild LineOffsets[] before use
     int                     BufCapacity;            // end-user buffer capacity (include zero terminator)
     ImVec2                  Scroll;                 // horizontal offset (managed manually) + vertical scrolling (pulled from child window's own Scroll.y)
     float                   CursorAnim;             // timer for cursor blink, reset on every user action so the cursor reappears immediately
     bool                    CursorFollow;           // set when we want scrolling to follow the current cursor position (not always!)
     bool                    SelectedAllMouseLock;   // after a double-click to select all, we ignore further mouse drags to update selection
     bool                    Edited;                 // edited this frame
+    int                     EditRangeStart;         // text modified since last ImGuiInputTextFlags_CallbackEdit event is [EditRangeStart, EditRangeEnd) in current text. -1 if none.
+    int                     EditRangeEnd;
+    int                     EditRangeDelta;         // difference of text length over this range (new - old)
     bool                    WantReloadUserBuf;      // force a reload of user buf so it may be modified externally. may be automatic in future version.
     int                     ReloadSelectionStart;
     int                     ReloadSelectionEnd;
 
     ImGuiInputTextState();
     ~ImGuiInputTextState();
-    void        ClearText()                 { TextLen = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); }
+    void        ClearText()                 { if (TextChunked) ChunksReplace(0, TextChunks.Size, "", 0); else TextA[0] = 0; TextLen = 0; LineOffsetsDirty = true; CursorClamp(); }
+    void        ClearFreeMemory()           { TextA.clear(); ChunksClear(); TextChunked = false; TextToRevertTo.clear(); LineOffsets.clear(); LineOffsetsDirty = true; UndoStack.ClearFreeMemory(); RedoStack.ClearFreeMemory(); }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
     void        OnCharPressed(unsigned int c);
 
@@ -1241,6 +1347,36 @@ struct IMGUI_API ImGuiInputTextState
     int         GetSelectionEnd() const;
     void        SelectAll();
 
+    // Undo/redo
+    char*       UndoCreateRecord(int pos, int deleted_len, int inserted_len);   // Call before deleting text, and fill returned storage with the deleted_len bytes at 'pos'. Clears redo.
+    void        UndoTrim(size_t max_bytes, int keep_count);                     // Drop oldest records until memory fits, keeping at least 'keep_count' records in each stack.
+    void        UndoClear()                 { UndoStack.Clear(); RedoStack.Clear(); }
+    void        UndoGroupBegin()            { UndoGroupSize = 0; }      // Records created until UndoGroupEnd() are undone/redone in a single step
+    void        UndoGroupEnd()              { UndoGroupSize = -1; }
+
+    // Edit range, so that ImGuiInputTextFlags_CallbackEdit can report edits without the user comparing/copying the whole text
+    void        EditRangeAdd(int pos, int deleted_len, int inserted_len);
+    void        EditRangeClear()            { EditRangeStart = EditRangeEnd = -1; EditRangeDelta = 0; }
+
+    // Text access, for either storage (TextSrc or TextChunks[]).
+    // A span is contiguous up to the end of its chunk, which is never inside a line: a range within a line can be read from a single span.
+    const char* TextGetSpan(int pos, const char** out_span_end) const;      // Return text at 'pos' and end of contiguous text from there.
+    char        TextGetChar(int pos) const;                                 // Return 0 at TextLen
+    void        TextCopy(char* dst, int pos, int len) const;
+    bool        TextEquals(const char* text, int text_len) const;
+    const char* TextFlatten();                                              // Return contiguous zero-terminated text (with TextChunks[], copied into TextA)
+
+    // Chunked storage (ImGuiInputTextFlags_ChunkedText)
+    int         ChunksFind(int pos) const;                                  // Return index of chunk containing 'pos'. 'pos' at the boundary between two chunks is in the second one.
+    void        ChunksInsert(int pos, const char* text, int text_len);
+    void        ChunksDelete(int pos, int len);
+    void        ChunksReplace(int chunk_n, int chunk_count, const char* text, int text_len); // Replace chunks by new ones holding 'text'
+    void        ChunksClear();
+
+    // Line index, so that multi-line layout/render doesn't need to scan the text from the beginning
+    void        LineIndexUpdate();                  // Rebuild LineOffsets[] if dirty. Requires TextSrc to be set.
+    int         LineIndexFindLine(int offset) const;// Return number of the line containing given offset.
+
     // Reload user buf (WIP #2890)
     // If you modify underlying user-passed const char* while active you need to call this (InputText V2 may lift this)
     //   strcpy(my_buf, "hello");
@@ -1632,10 +1768,13 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    int                             CursorItem;             // Variable height mode: index of item at cursor position
+    int                             MeasureItem;            // Variable height mode: item displayed by last step, to be measured on next step (-1 if none)
+    float                           MeasurePosY;            // Variable height mode: cursor position before submitting MeasureItem
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = CursorItem = 0; MeasureItem = -1; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -2062,6 +2201,7 @@ struct ImGuiDebugAllocInfo
 {
     int         TotalAllocCount;            // Number of call to MemAlloc().
     int         TotalFreeCount;
+    bool        SkipHook;                   // Set while ImFontAtlas::BuildParallelForFunc() is running: our tracking isn't thread-safe.
     ImS16       LastEntriesIdx;             // Current index in buffer
     ImGuiDebugAllocEntry LastEntriesBuf[6]; // Track last 6 frames that had allocations
 
@@ -2441,6 +2581,8 @@ struct ImGuiContext
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiStorage                        SettingsWindowsMap;     // Map ID -> offset into SettingsWindows[], for FindWindowSettingsByID()
+    ImGuiStorage                        SettingsTablesMap;      // Map ID -> offset into SettingsTables[], for TableSettingsFindByID()
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -2491,6 +2633,10 @@ struct ImGuiContext
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+    int                     DebugDrawCallsCount;                // Draw calls in last Render(), before ImDrawData::BatchDrawCmds()
+    int                     DebugDrawCallsBatchedCount;         // Draw calls in last Render(), after ImDrawData::BatchDrawCmds(), or -1 if not batched
+    int                     DebugCulledPrimsCount;              // Sum of ImDrawList::_CulledPrimsCount for last frame
+    int                     DebugCulledTextCount;               // Sum of ImDrawList::_CulledTextCount for last frame
 
     // Misc
     float                   FramerateSecPerFrame[60];           // Calculate estimate of framerate for user over the last 60 frames..
@@ -2783,7 +2929,7 @@ struct IMGUI_API ImGuiTabBar
 //-----------------------------------------------------------------------------
 
 #define IM_COL32_DISABLE                IM_COL32(0,0,0,1)   // Special sentinel code which cannot be used as a regular color.
-#define IMGUI_TABLE_MAX_COLUMNS         512                 // Arbitrary "safety" maximum, may be lifted in the future if needed. Must fit in ImGuiTableColumnIdx/ImGuiTableDrawChannelIdx.
+#define IMGUI_TABLE_MAX_COLUMNS         16384               // Arbitrary "safety" maximum. Must fit in ImGuiTableColumnIdx, and (4 + 2 * columns) must fit in ImGuiTableDrawChannelIdx.
 
 // [Internal] sizeof() ~ 112
 // We use the terminology "Enabled" to refer to a column that is not Hidden by user/api.
@@ -2809,11 +2955,12 @@ struct ImGuiTableColumn
     float                   ContentMaxXUnfrozen;
     float                   ContentMaxXHeadersUsed;         // Contents maximum position for headers rows (regardless of freezing). TableHeader() automatically softclip itself + report ideal desired size, to avoid creating extraneous draw calls
     float                   ContentMaxXHeadersIdeal;
-    ImS16                   NameOffset;                     // Offset into parent ColumnsNames[]
+    ImS32                   NameOffset;                     // Offset into parent ColumnsNames[]
     ImGuiTableColumnIdx     DisplayOrder;                   // Index within Table's IndexToDisplayOrder[] (column may be reordered by users)
     ImGuiTableColumnIdx     IndexWithinEnabledSet;          // Index within enabled/visible set (<= IndexToDisplayOrder)
     ImGuiTableColumnIdx     PrevEnabledColumn;              // Index of prev enabled/visible column within Columns[], -1 if first enabled/visible column
     ImGuiTableColumnIdx     NextEnabledColumn;              // Index of next enabled/visible column within Columns[], -1 if last enabled/visible column
+    ImGuiTableColumnIdx     NextRequestOutputColumn;        // Index of next column with IsRequestOutput within Columns[] (in index order, not display order), -1 if none. Used by TableNextVisibleColumn().
     ImGuiTableColumnIdx     SortOrder;                      // Index of this column within sort specs, -1 if not sorting on this column, 0 for single-sort, may be >0 on multi-sort
     ImGuiTableDrawChannelIdx DrawChannelCurrent;            // Index within DrawSplitter.Channels[]
     ImGuiTableDrawChannelIdx DrawChannelFrozen;             // Draw channels for frozen rows (often headers)
@@ -2840,10 +2987,10 @@ struct ImGuiTableColumn
         StretchWeight = WidthRequest = -1.0f;
         NameOffset = -1;
         DisplayOrder = IndexWithinEnabledSet = -1;
-        PrevEnabledColumn = NextEnabledColumn = -1;
+        PrevEnabledColumn = NextEnabledColumn = NextRequestOutputColumn = -1;
         SortOrder = -1;
         SortDirection = ImGuiSortDirection_None;
-        DrawChannelCurrent = DrawChannelFrozen = DrawChannelUnfrozen = (ImU8)-1;
+        DrawChannelCurrent = DrawChannelFrozen = DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)-1;
     }
 };
 
@@ -2855,6 +3002,68 @@ struct ImGuiTableCellData
     ImGuiTableColumnIdx         Column;     // Column number
 };
 
+// Cached contents of a cell, for ImGuiTableFlags_CacheRows.
+// Positions are relative to the cell origin (cursor position at the start of the cell, RowPosY1).
+struct ImGuiTableCachedCell
+{
+    ImGuiTableColumnIdx         Column;
+    float                       Width;          // column->WorkMaxX - column->WorkMinX when recorded
+    ImVec2                      ContentMax;     // window->DC.CursorMaxPos at the end of the cell
+    ImVec4                      ClipRect;       // Clipping rectangle when recorded, with sides which didn't cut into contents set to +/-FLT_MAX. Vertices are only valid while the current clipping rectangle is contained in this one.
+    int                         VtxOffset;      // Offset in ImGuiTableRowCache::VtxBuffer[]
+    int                         VtxCount;
+    int                         IdxOffset;      // Offset in ImGuiTableRowCache::IdxBuffer[]. Indices are relative to the cell first vertex.
+    int                         IdxCount;
+};
+
+// Cached row, for ImGuiTableFlags_CacheRows. See TableNextRowCached().
+struct ImGuiTableCachedRow
+{
+    ImGuiID                     RowID;
+    int                         Version;        // User version passed to TableNextRowCached()
+    int                         LastFrameUsed;
+    int                         CellsOffset;    // Offset in ImGuiTableRowCache::Cells[], sorted by column index
+    int                         CellsCount;
+    int                         CellsBgOffset;  // Offset in ImGuiTableRowCache::CellsBg[]
+    int                         CellsBgCount;
+    int                         VtxCount;       // Sum of Cells[].VtxCount
+    float                       Height;
+    float                       TextBaseline;
+    float                       CellPaddingY;
+    float                       IndentOffsetX;
+    float                       FontSize;
+    ImFont*                     Font;
+    ImTextureRef                TexRef;
+    ImU32                       RowBgColor[2];
+    ImGuiTableRowFlags          RowFlags;
+    bool                        IsValid;        // Set once recording is completed successfully
+
+    ImGuiTableCachedRow()       { memset(this, 0, sizeof(*this)); }
+};
+
+// Storage for ImGuiTableFlags_CacheRows, allocated on demand.
+// All rows share the same buffers. Re-recording a row leaves garbage behind, which is reclaimed by TableRowCacheGc().
+struct ImGuiTableRowCache
+{
+    ImVector<ImGuiTableCachedRow>   Rows;
+    ImGuiStorage                    RowsMap;    // RowID -> index in Rows[]
+    ImVector<ImGuiTableCachedCell>  Cells;
+    ImVector<ImGuiTableCellData>    CellsBg;
+    ImVector<ImDrawVert>            VtxBuffer;
+    ImVector<ImDrawIdx>             IdxBuffer;
+    int                             LiveVtxCount;       // Sum of Rows[].VtxCount for valid rows
+    int                             UsedFrame;
+    int                             UsedCount;          // Number of rows replayed or recorded during UsedFrame
+    int                             RecordRow;          // Index of row being recorded, or -1
+    int                             RecordVtxStart;     // Draw list state at the beginning of the current cell
+    int                             RecordIdxStart;
+    int                             RecordCmdCount;
+    ImDrawCmdHeader                 RecordCmdHeader;
+    ImVec2                          RecordOrigin;
+
+    ImGuiTableRowCache()            { LiveVtxCount = 0; UsedFrame = -1; UsedCount = 0; RecordRow = -1; RecordVtxStart = RecordIdxStart = RecordCmdCount = 0; }
+};
+
 // Parameters for TableAngledHeadersRowEx()
 // This may end up being refactored for more general purpose.
 // sizeof() ~ 12 bytes
@@ -2887,6 +3096,7 @@ struct IMGUI_API ImGuiTable
     ImGuiTableFlags             Flags;
     void*                       RawData;                    // Single allocation to hold Columns[], DisplayOrderToIndex[], and RowCellData[]
     ImGuiTableTempData*         TempData;                   // Transient data while table is active. Point within g.CurrentTableStack[]
+    ImGuiTableRowCache*         RowCache;                   // Cached rows, only allocated with ImGuiTableFlags_CacheRows
     ImSpan<ImGuiTableColumn>    Columns;                    // Point within RawData[]
     ImSpan<ImGuiTableColumnIdx> DisplayOrderToIndex;        // Point within RawData[]. Store display order of columns (when not reordered, the values are 0...Count-1)
     ImSpan<ImGuiTableCellData>  RowCellData;                // Point within RawData[]. Store cells background requests for current row.
@@ -2951,6 +3161,7 @@ struct IMGUI_API ImGuiTable
     ImGuiTableColumnIdx         SortSpecsCount;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         ColumnsEnabledFixedCount;   // Number of enabled columns using fixed width (<= ColumnsCount)
+    ImGuiTableColumnIdx         ColumnsVisibleCount;        // Number of enabled columns which are not clipped (<= ColumnsEnabledCount). We only allocate draw channels for those.
     ImGuiTableColumnIdx         DeclColumnsCount;           // Count calls to TableSetupColumn()
     ImGuiTableColumnIdx         AngledHeadersCount;         // Count columns with angled headers
     ImGuiTableColumnIdx         HoveredColumnBody;          // Index of column whose visible region is being hovered. Important: == ColumnsCount when hovering empty region after the right-most column!
@@ -2964,6 +3175,7 @@ struct IMGUI_API ImGuiTable
     ImGuiTableColumnIdx         ReorderColumnDir;           // -1 or +1
     ImGuiTableColumnIdx         LeftMostEnabledColumn;      // Index of left-most non-hidden column.
     ImGuiTableColumnIdx         RightMostEnabledColumn;     // Index of right-most non-hidden column.
+    ImGuiTableColumnIdx         FirstRequestOutputColumn;   // Index of first column with IsRequestOutput (in index order), start of the NextRequestOutputColumn chain.
     ImGuiTableColumnIdx         LeftMostStretchedColumn;    // Index of left-most stretched column.
     ImGuiTableColumnIdx         RightMostStretchedColumn;   // Index of right-most stretched column.
     ImGuiTableColumnIdx         ContextPopupColumn;         // Column right-clicked on, of -1 if opening context menu from a neutral/empty spot
@@ -2998,7 +3210,7 @@ struct IMGUI_API ImGuiTable
     bool                        HostSkipItems;              // Backup of InnerWindow->SkipItem at the end of BeginTable(), because we will overwrite InnerWindow->SkipItem on a per-column basis
 
     ImGuiTable()                { memset(this, 0, sizeof(*this)); LastFrameActive = -1; }
-    ~ImGuiTable()               { IM_FREE(RawData); }
+    ~ImGuiTable()               { IM_FREE(RawData); if (RowCache) IM_DELETE(RowCache); }
 };
 
 // Transient data that are only needed between BeginTable() and EndTable(), those buffers are shared (1 per level of stacked table).
@@ -3457,6 +3669,7 @@ namespace ImGui
     IMGUI_API void          TableEndRow(ImGuiTable* table);
     IMGUI_API void          TableBeginCell(ImGuiTable* table, int column_n);
     IMGUI_API void          TableEndCell(ImGuiTable* table);
+    IMGUI_API void          TableRowCacheGc(ImGuiTable* table);
     IMGUI_API ImRect        TableGetCellBgRect(const ImGuiTable* table, int column_n);
     IMGUI_API const char*   TableGetColumnName(const ImGuiTable* table, int column_n);
     IMGUI_API ImGuiID       TableGetColumnResizeID(ImGuiTable* table, int column_n, int instance_no = 0);
@@ -3678,6 +3891,14 @@ namespace ImGui
 // [SECTION] ImFontLoader
 //-----------------------------------------------------------------------------
 
+// Glyph pixels rasterized by ImFontLoader::FontBakedRasterizeGlyph(), not yet packed into the atlas.
+struct ImFontAtlasGlyphBitmap
+{
+    ImTextureFormat     Format;             // ImTextureFormat_Alpha8 or ImTextureFormat_RGBA32
+    int                 Width, Height;      // 0 when glyph is not visible
+    int                 PixelsOffset;       // Offset in bytes into the 'out_pixels' buffer. Pitch is always Width * BytesPerPixel.
+};
+
 // Hooks and storage for a given font backend.
 // This structure is likely to evolve as we add support for incremental atlas updates.
 // Conceptually this could be public, but API is still going to be evolve.
@@ -3693,6 +3914,10 @@ struct ImFontLoader
     void            (*FontBakedDestroy)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     bool            (*FontBakedLoadGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x);
 
+    // [Optional] Rasterize a glyph without packing it: pixels are appended to 'out_pixels' and described by 'out_bitmap'. Used by parallel builds (see ImFontAtlas::BuildParallelForFunc).
+    // Providing this declares the loader thread-safe across sources: it may be called from worker threads, but never concurrently for a same ImFontConfig.
+    bool            (*FontBakedRasterizeGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, ImFontAtlasGlyphBitmap* out_bitmap, ImVector<unsigned char>* out_pixels);
+
     // Size of backend data, Per Baked * Per Source. Buffers are managed by core to avoid excessive allocations.
     // FIXME: At this point the two other types of buffers may be managed by core to be consistent?
     size_t          FontBakedSrcLoaderDataSize;
@@ -3814,6 +4039,7 @@ IMGUI_API ImVec2i           ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas
 
 IMGUI_API void              ImFontAtlasBuildSetupFontSpecialGlyphs(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src);
 IMGUI_API void              ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas); // Legacy
+IMGUI_API void              ImFontAtlasBuildParallelPreloadGlyphRanges(ImFontAtlas* atlas, ImFontBaked* baked);
 IMGUI_API void              ImFontAtlasBuildGetOversampleFactors(ImFontConfig* src, ImFontBaked* baked, int* out_oversample_h, int* out_oversample_v);
 IMGUI_API void              ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames);
 
@@ -3833,6 +4059,7 @@ IMGUI_API ImFontGlyph*      ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImF
 IMGUI_API void              ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImWchar codepoint, float advance_x);
 IMGUI_API void              ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImFontGlyph* glyph);
 IMGUI_API void              ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch);
+IMGUI_API void              ImFontAtlasBakedCommitFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r); // Post-process and queue upload, when pixels were written directly into TexData
 
 IMGUI_API void              ImFontAtlasPackInit(ImFontAtlas* atlas);
 IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry = NULL);
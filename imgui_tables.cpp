@@ -10,6 +10,7 @@ Index of this file:
 // [SECTION] Tables: Main code
 // [SECTION] Tables: Simple accessors
 // [SECTION] Tables: Row changes
+// [SECTION] Tables: Row cache
 // [SECTION] Tables: Columns changes
 // [SECTION] Tables: Columns width management
 // [SECTION] Tables: Drawing
@@ -59,6 +60,9 @@ Index of this file:
 // - TableNextRow()                             user begin into a new row (also automatically called by TableHeadersRow())
 //    | TableEndRow()                           - finish existing row
 //    | TableBeginRow()                         - add a new row
+// - TableNextRowCached()                       user begin into a new row, with ImGuiTableFlags_CacheRows (optional)
+//    | TableNextRow()                          - begin row as above
+//    | TableBeginCell() + TableEndCell()       - on cache hit: replay vertices of each visible cell, user doesn't submit contents
 // - TableSetColumnIndex() / TableNextColumn()  user begin into a cell
 //    | TableEndCell()                          - close existing column/cell
 //    | TableBeginCell()                        - enter into current column/cell
@@ -155,7 +159,7 @@ Index of this file:
 //-----------------------------------------------------------------------------
 // About clipping/culling of Rows in Tables:
 // - For large numbers of rows, it is recommended you use ImGuiListClipper to submit only visible rows.
-//   ImGuiListClipper is reliant on the fact that rows are of equal height.
+//   ImGuiListClipper is reliant on the fact that rows are of equal height, unless using ImGuiListClipper::BeginVariableHeight().
 //   See 'Demo->Tables->Vertical Scrolling' or 'Demo->Tables->Advanced' for a demo of using the clipper.
 // - Note that auto-resizing columns don't play well with using the clipper.
 //   By default a table with _ScrollX but without _Resizable will have column auto-resize.
@@ -267,6 +271,11 @@ static const float TABLE_BORDER_SIZE                     = 1.0f;    // FIXME-TAB
 static const float TABLE_RESIZE_SEPARATOR_HALF_THICKNESS = 4.0f;    // Extend outside inner borders.
 static const float TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER = 0.06f;   // Delay/timer before making the hover feedback (color+cursor) visible because tables/columns tends to be more cramped.
 
+// Row cache (see TableNextRowCached())
+static void TableRowCacheBeginCell(ImGuiTable* table);
+static void TableRowCacheEndCell(ImGuiTable* table, ImGuiTableColumn* column);
+static void TableRowCacheEndRow(ImGuiTable* table);
+
 // Helper
 inline ImGuiTableFlags TableFixFlags(ImGuiTableFlags flags, ImGuiWindow* outer_window)
 {
@@ -567,6 +576,11 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         old_columns_to_preserve = table->Columns.Data;
         old_columns_raw_data = table->RawData;
         table->RawData = NULL;
+        if (table->RowCache != NULL)
+        {
+            IM_DELETE(table->RowCache);
+            table->RowCache = NULL;
+        }
     }
     if (table->RawData == NULL)
     {
@@ -1054,6 +1068,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     ImRect host_clip_rect = table->InnerClipRect;
     //host_clip_rect.Max.x += table->CellPaddingX + table->CellSpacingX2;
     ImBitArrayClearAllBits(table->VisibleMaskByIndex, table->ColumnsCount);
+    table->ColumnsVisibleCount = 0;
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
         const int column_n = table->DisplayOrderToIndex[order_n];
@@ -1121,7 +1136,10 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         column->IsVisibleY = true; // (column->ClipRect.Max.y > column->ClipRect.Min.y);
         const bool is_visible = column->IsVisibleX; //&& column->IsVisibleY;
         if (is_visible)
+        {
             ImBitArraySetBit(table->VisibleMaskByIndex, column_n);
+            table->ColumnsVisibleCount++;
+        }
 
         // Mark column as requesting output from user. Note that fixed + non-resizable sets are auto-fitting at all times and therefore always request output.
         column->IsRequestOutput = is_visible || column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0;
@@ -1197,6 +1215,16 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         table->Columns[table->LeftMostEnabledColumn].IsSkipItems = false;
     }
 
+    // Chain columns requesting output in index order, so TableNextVisibleColumn() can skip clipped columns of very wide tables.
+    table->FirstRequestOutputColumn = -1;
+    for (int column_n = table->ColumnsCount - 1; column_n >= 0; column_n--)
+    {
+        ImGuiTableColumn* column = &table->Columns[column_n];
+        column->NextRequestOutputColumn = table->FirstRequestOutputColumn;
+        if (column->IsRequestOutput)
+            table->FirstRequestOutputColumn = (ImGuiTableColumnIdx)column_n;
+    }
+
     // [Part 7] Detect/store when we are hovering the unused space after the right-most column (so e.g. context menus can react on it)
     // Clear Resizable flag if none of our column are actually resizable (either via an explicit _NoResize flag, either
     // because of using _WidthAuto/_WidthStretch). This will hide the resizing option from the context menu.
@@ -1371,6 +1399,8 @@ void    ImGui::EndTable()
 
     if (table->IsInsideRow)
         TableEndRow(table);
+    if (table->RowCache != NULL)
+        TableRowCacheGc(table);
 
     // Context menu in columns body
     if (flags & ImGuiTableFlags_ContextMenuInBody)
@@ -1424,6 +1454,7 @@ void    ImGui::EndTable()
         ImDrawChannel* dummy_channel = &table->DrawSplitter._Channels[table->DummyDrawChannel];
         dummy_channel->_CmdBuffer.resize(0);
         dummy_channel->_IdxBuffer.resize(0);
+        dummy_channel->_InstBuffer.resize(0);
     }
 #endif
 
@@ -1651,7 +1682,7 @@ void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, flo
     column->NameOffset = -1;
     if (label != NULL && label[0] != 0)
     {
-        column->NameOffset = (ImS16)table->ColumnsNames.size();
+        column->NameOffset = (ImS32)table->ColumnsNames.size();
         table->ColumnsNames.append(label, label + ImStrlen(label) + 1);
     }
 }
@@ -1957,6 +1988,8 @@ void ImGui::TableEndRow(ImGuiTable* table)
         TableEndCell(table);
         table->CurrentColumn = -1;
     }
+    if (table->RowCache != NULL && table->RowCache->RecordRow != -1)
+        TableRowCacheEndRow(table);
 
     // Logging
     if (g.LogEnabled)
@@ -2090,12 +2123,350 @@ void ImGui::TableEndRow(ImGuiTable* table)
     table->IsInsideRow = false;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Tables: Row cache
+//-------------------------------------------------------------------------
+// - TableNextRowCached()
+// - TableRowCacheBeginCell() [Internal]
+// - TableRowCacheEndCell() [Internal]
+// - TableRowCacheEndRow() [Internal]
+// - TableRowCacheGc() [Internal]
+//-------------------------------------------------------------------------
+// With ImGuiTableFlags_CacheRows, TableNextRowCached() records the vertices output by each visible cell of a row.
+// When called again with the same row id and version, it replays them offset to the new row position, and reports
+// the same row height and contents width, so user doesn't need to submit contents again.
+// - A cell is only replayed when its column width didn't change, and when its current clipping rectangle (relative
+//   to the cell) is contained in the one used during recording, as items culled during recording have no vertices.
+//   Sides of the clipping rectangle which didn't cut into cell contents are ignored. Otherwise the row is recorded
+//   again. A row crossing the vertical clipping rectangle (e.g. partially scrolled into view) is never replayed nor
+//   kept: replayed vertices could cover a few more pixels than the items submitted and clipped by the current frame.
+// - A cell is not recorded if it changes draw command (e.g. different texture, PushClipRect() or channel).
+//   The row is then submitted every frame, as with TableNextRow().
+// - Rows are keyed on font, font size and texture, as a texture change (e.g. atlas growth) invalidates UV.
+//   Other style changes (colors, alpha) need to be reflected in the user-provided version.
+// - Not supported with ImGuiTableFlags_NoClip, header rows, ImDrawListFlags_AllowInstances, or while logging.
+//-------------------------------------------------------------------------
+
+// [Public] Begin a new row. Return false when row contents were replayed from cache, in which case user shouldn't submit them.
+bool ImGui::TableNextRowCached(ImGuiID row_id, int row_version, ImGuiTableRowFlags row_flags, float min_row_height)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableNextRowCached() after BeginTable()!");
+
+    TableNextRow(row_flags, min_row_height);
+    ImGuiWindow* window = table->InnerWindow;
+    ImDrawList* draw_list = window->DrawList;
+    if (!(table->Flags & ImGuiTableFlags_CacheRows) || (table->Flags & ImGuiTableFlags_NoClip) || (row_flags & ImGuiTableRowFlags_Headers) || (draw_list->Flags & ImDrawListFlags_AllowInstances) || g.LogEnabled || table->HostSkipItems)
+        return true;
+
+    if (table->RowCache == NULL)
+        table->RowCache = IM_NEW(ImGuiTableRowCache)();
+    ImGuiTableRowCache* cache = table->RowCache;
+    if (cache->UsedFrame != g.FrameCount)
+    {
+        cache->UsedFrame = g.FrameCount;
+        cache->UsedCount = 0;
+    }
+    cache->UsedCount++;
+
+    // Lookup
+    int row_idx = cache->RowsMap.GetInt(row_id, -1);
+    ImGuiTableCachedRow* row = (row_idx != -1) ? &cache->Rows[row_idx] : NULL;
+    bool hit = (row != NULL && row->IsValid && row->Version == row_version);
+    hit = hit && (row->RowFlags == row_flags && row->CellPaddingY == table->RowCellPaddingY && row->IndentOffsetX == table->RowIndentOffsetX);
+    hit = hit && (row->Font == g.Font && row->FontSize == g.FontSize && row->TexRef._TexData == draw_list->_CmdHeader.TexRef._TexData && row->TexRef._TexID == draw_list->_CmdHeader.TexRef._TexID);
+    if (hit)
+    {
+        // Every visible column needs a valid cell. Cells are sorted by column index, same as the chain of columns requesting output.
+        const ImGuiTableCachedCell* cell = cache->Cells.Data + row->CellsOffset;
+        const ImGuiTableCachedCell* cell_end = cell + row->CellsCount;
+        for (int column_n = table->FirstRequestOutputColumn; column_n != -1 && hit; column_n = table->Columns[column_n].NextRequestOutputColumn)
+        {
+            ImGuiTableColumn* column = &table->Columns[column_n];
+            while (cell < cell_end && cell->Column < column_n)
+                cell++;
+            if (cell == cell_end || cell->Column != column_n)
+            {
+                hit = !column->IsVisibleX; // Missing cell only matters if it would be visible
+                continue;
+            }
+            if (column->IsVisibleX && (table->RowPosY1 < column->ClipRect.Min.y || table->RowPosY1 + row->Height > column->ClipRect.Max.y))
+            {
+                hit = false; // Row crosses clipping rectangle (e.g. partially scrolled): submit contents so they are clipped the same way
+                continue;
+            }
+            const float origin_x = column->WorkMinX + ((column->Flags & ImGuiTableColumnFlags_IndentEnable) ? table->RowIndentOffsetX : 0.0f);
+            const ImRect clip_rect(column->ClipRect.Min.x - origin_x, column->ClipRect.Min.y - table->RowPosY1, column->ClipRect.Max.x - origin_x, column->ClipRect.Max.y - table->RowPosY1);
+            if (cell->Width != column->WorkMaxX - column->WorkMinX)
+                hit = false;
+            else if (clip_rect.Min.x < clip_rect.Max.x && clip_rect.Min.y < clip_rect.Max.y)
+                hit = (clip_rect.Min.x >= cell->ClipRect.x && clip_rect.Min.y >= cell->ClipRect.y && clip_rect.Max.x <= cell->ClipRect.z && clip_rect.Max.y <= cell->ClipRect.w);
+        }
+    }
+
+    if (!hit)
+    {
+        // Record: user submits contents, and TableBeginCell()/TableEndCell()/TableEndRow() store them.
+        if (row == NULL)
+        {
+            row_idx = cache->Rows.Size;
+            cache->RowsMap.SetInt(row_id, row_idx);
+            cache->Rows.push_back(ImGuiTableCachedRow());
+            row = &cache->Rows.back();
+            row->RowID = row_id;
+        }
+        if (row->IsValid)
+            cache->LiveVtxCount -= row->VtxCount;
+        row->IsValid = false;
+        row->Version = row_version;
+        row->LastFrameUsed = g.FrameCount;
+        row->CellsOffset = cache->Cells.Size;
+        row->CellsCount = 0;
+        row->VtxCount = 0;
+        row->CellPaddingY = table->RowCellPaddingY;
+        row->IndentOffsetX = table->RowIndentOffsetX;
+        row->Font = g.Font;
+        row->FontSize = g.FontSize;
+        row->TexRef = draw_list->_CmdHeader.TexRef;
+        row->RowFlags = row_flags;
+        cache->RecordRow = row_idx;
+        return true;
+    }
+
+    // Replay
+    row->LastFrameUsed = g.FrameCount;
+    const ImGuiTableCachedCell* cell_end = cache->Cells.Data + row->CellsOffset + row->CellsCount;
+    for (const ImGuiTableCachedCell* cell = cache->Cells.Data + row->CellsOffset; cell < cell_end; cell++)
+    {
+        if (!table->Columns[cell->Column].IsRequestOutput)
+            continue;
+        TableBeginCell(table, cell->Column);
+        const ImVec2 origin(window->DC.CursorPos.x, table->RowPosY1);
+        if (cell->VtxCount > 0 && table->Columns[cell->Column].IsVisibleX)
+        {
+            draw_list->PrimReserve(cell->IdxCount, cell->VtxCount);
+            const ImDrawIdx idx_base = (ImDrawIdx)draw_list->_VtxCurrentIdx;
+            const ImDrawIdx* src_idx = cache->IdxBuffer.Data + cell->IdxOffset;
+            for (int n = 0; n < cell->IdxCount; n++)
+                draw_list->_IdxWritePtr[n] = (ImDrawIdx)(idx_base + src_idx[n]);
+            const ImDrawVert* src_vtx = cache->VtxBuffer.Data + cell->VtxOffset;
+            ImDrawVert* dst_vtx = draw_list->_VtxWritePtr;
+            for (int n = 0; n < cell->VtxCount; n++)
+            {
+                dst_vtx[n] = src_vtx[n];
+                dst_vtx[n].pos.x += origin.x;
+                dst_vtx[n].pos.y += origin.y;
+            }
+            draw_list->_IdxWritePtr += cell->IdxCount;
+            draw_list->_VtxWritePtr += cell->VtxCount;
+            draw_list->_VtxCurrentIdx += cell->VtxCount;
+        }
+        window->DC.CursorMaxPos = ImVec2(origin.x + cell->ContentMax.x, origin.y + cell->ContentMax.y);
+        TableEndCell(table);
+    }
+    table->CurrentColumn = -1;
+    table->RowTextBaseline = row->TextBaseline;
+    table->RowPosY2 = ImMax(table->RowPosY2, table->RowPosY1 + row->Height);
+    if (row->RowBgColor[0] != IM_COL32_DISABLE)
+        table->RowBgColor[0] = row->RowBgColor[0];
+    if (row->RowBgColor[1] != IM_COL32_DISABLE)
+        table->RowBgColor[1] = row->RowBgColor[1];
+    for (int n = 0; n < row->CellsBgCount; n++)
+    {
+        const ImGuiTableCellData* cell_data = &cache->CellsBg[row->CellsBgOffset + n];
+        if (table->RowPosY1 <= table->InnerClipRect.Max.y && IM_BITARRAY_TESTBIT(table->VisibleMaskByIndex, cell_data->Column)) // Same as TableSetBgColor()
+            table->RowCellData[++table->RowCellDataCurrent] = *cell_data;
+    }
+
+    // Disable output until next row
+    window->SkipItems = true;
+    return false;
+}
+
+// [Internal] Called by TableBeginCell() while recording
+static void TableRowCacheBeginCell(ImGuiTable* table)
+{
+    ImGuiTableRowCache* cache = table->RowCache;
+    ImGuiWindow* window = table->InnerWindow;
+    ImDrawList* draw_list = window->DrawList;
+    cache->RecordVtxStart = draw_list->VtxBuffer.Size;
+    cache->RecordIdxStart = draw_list->IdxBuffer.Size;
+    cache->RecordCmdCount = draw_list->CmdBuffer.Size;
+    cache->RecordCmdHeader = draw_list->_CmdHeader;
+    cache->RecordOrigin = ImVec2(window->DC.CursorPos.x, table->RowPosY1);
+}
+
+// [Internal] Called by TableEndCell() while recording
+static void TableRowCacheEndCell(ImGuiTable* table, ImGuiTableColumn* column)
+{
+    ImGuiTableRowCache* cache = table->RowCache;
+    if (!column->IsRequestOutput)
+        return;
+
+    ImGuiWindow* window = table->InnerWindow;
+    ImDrawList* draw_list = window->DrawList;
+    ImGuiTableCachedRow* row = &cache->Rows[cache->RecordRow];
+    const ImVec2 origin = cache->RecordOrigin;
+    ImGuiTableCachedCell cell;
+    cell.Column = (ImGuiTableColumnIdx)table->CurrentColumn;
+    cell.Width = column->WorkMaxX - column->WorkMinX;
+    cell.ContentMax = ImVec2(window->DC.CursorMaxPos.x - origin.x, window->DC.CursorMaxPos.y - origin.y);
+    cell.ClipRect = ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
+    cell.VtxOffset = cache->VtxBuffer.Size;
+    cell.IdxOffset = cache->IdxBuffer.Size;
+    cell.VtxCount = cell.IdxCount = 0;
+    if (column->IsVisibleX)
+    {
+        // Sides of the clipping rectangle which didn't cut into cell contents didn't cull anything: ignore them.
+        cell.ClipRect = ImVec4(column->ClipRect.Min.x - origin.x, column->ClipRect.Min.y - origin.y, column->ClipRect.Max.x - origin.x, column->ClipRect.Max.y - origin.y);
+        if (column->ClipRect.Min.x <= origin.x)
+            cell.ClipRect.x = -FLT_MAX;
+        if (column->ClipRect.Min.y <= origin.y)
+            cell.ClipRect.y = -FLT_MAX;
+        if (column->ClipRect.Max.x >= window->DC.CursorMaxPos.x)
+            cell.ClipRect.z = FLT_MAX;
+        if (column->ClipRect.Max.y >= window->DC.CursorMaxPos.y)
+            cell.ClipRect.w = FLT_MAX;
+
+        // Cannot record if contents are not all in the same draw command.
+        const ImDrawCmdHeader& header = draw_list->_CmdHeader;
+        const ImDrawCmdHeader& record_header = cache->RecordCmdHeader;
+        bool same_cmd = (draw_list->CmdBuffer.Size == cache->RecordCmdCount && table->DrawSplitter->_Current == column->DrawChannelCurrent);
+        same_cmd = same_cmd && (memcmp(&header.ClipRect, &record_header.ClipRect, sizeof(ImVec4)) == 0 && header.VtxOffset == record_header.VtxOffset);
+        same_cmd = same_cmd && (header.TexRef._TexData == record_header.TexRef._TexData && header.TexRef._TexID == record_header.TexRef._TexID);
+        if (!same_cmd)
+        {
+            cache->RecordRow = -1;
+            return;
+        }
+        cell.VtxCount = draw_list->VtxBuffer.Size - cache->RecordVtxStart;
+        cell.IdxCount = draw_list->IdxBuffer.Size - cache->RecordIdxStart;
+        cache->VtxBuffer.resize(cell.VtxOffset + cell.VtxCount);
+        cache->IdxBuffer.resize(cell.IdxOffset + cell.IdxCount);
+        const ImDrawVert* src_vtx = draw_list->VtxBuffer.Data + cache->RecordVtxStart;
+        ImDrawVert* dst_vtx = cache->VtxBuffer.Data + cell.VtxOffset;
+        for (int n = 0; n < cell.VtxCount; n++)
+        {
+            dst_vtx[n] = src_vtx[n];
+            dst_vtx[n].pos.x -= origin.x;
+            dst_vtx[n].pos.y -= origin.y;
+        }
+        const ImDrawIdx idx_base = (ImDrawIdx)(cache->RecordVtxStart - (int)cache->RecordCmdHeader.VtxOffset);
+        const ImDrawIdx* src_idx = draw_list->IdxBuffer.Data + cache->RecordIdxStart;
+        ImDrawIdx* dst_idx = cache->IdxBuffer.Data + cell.IdxOffset;
+        for (int n = 0; n < cell.IdxCount; n++)
+            dst_idx[n] = (ImDrawIdx)(src_idx[n] - idx_base);
+    }
+    cache->Cells.push_back(cell);
+    row->CellsCount++;
+    row->VtxCount += cell.VtxCount;
+}
+
+static int IMGUI_CDECL TableRowCacheCompareCellsByColumn(const void* lhs, const void* rhs)
+{
+    return ((const ImGuiTableCachedCell*)lhs)->Column - ((const ImGuiTableCachedCell*)rhs)->Column;
+}
+
+// [Internal] Called by TableEndRow() while recording
+static void TableRowCacheEndRow(ImGuiTable* table)
+{
+    ImGuiTableRowCache* cache = table->RowCache;
+    ImGuiTableCachedRow* row = &cache->Rows[cache->RecordRow];
+    cache->RecordRow = -1;
+
+    // Sort cells by column index. A column submitted twice in the same row cannot be replayed.
+    ImGuiTableCachedCell* cells = cache->Cells.Data + row->CellsOffset;
+    ImQsort(cells, (size_t)row->CellsCount, sizeof(ImGuiTableCachedCell), TableRowCacheCompareCellsByColumn);
+    for (int n = 1; n < row->CellsCount; n++)
+        if (cells[n - 1].Column == cells[n].Column)
+            return;
+
+    // Don't keep a row which crossed the clipping rectangle of a visible column: its culled items have no vertices.
+    for (int n = 0; n < row->CellsCount; n++)
+    {
+        const ImGuiTableColumn* column = &table->Columns[cells[n].Column];
+        if (column->IsVisibleX && (table->RowPosY1 < column->ClipRect.Min.y || table->RowPosY2 > column->ClipRect.Max.y))
+        {
+            int vtx_offset = cache->VtxBuffer.Size, idx_offset = cache->IdxBuffer.Size;
+            for (int cell_n = 0; cell_n < row->CellsCount; cell_n++)
+            {
+                vtx_offset = ImMin(vtx_offset, cells[cell_n].VtxOffset);
+                idx_offset = ImMin(idx_offset, cells[cell_n].IdxOffset);
+            }
+            cache->VtxBuffer.shrink(vtx_offset);
+            cache->IdxBuffer.shrink(idx_offset);
+            cache->Cells.shrink(row->CellsOffset);
+            row->CellsCount = 0;
+            row->VtxCount = 0;
+            return;
+        }
+    }
+
+    row->CellsBgOffset = cache->CellsBg.Size;
+    row->CellsBgCount = table->RowCellDataCurrent + 1;
+    for (int n = 0; n < row->CellsBgCount; n++)
+        cache->CellsBg.push_back(table->RowCellData[n]);
+    row->Height = table->RowPosY2 - table->RowPosY1;
+    row->TextBaseline = table->RowTextBaseline;
+    row->RowBgColor[0] = table->RowBgColor[0];
+    row->RowBgColor[1] = table->RowBgColor[1];
+    row->IsValid = true;
+    cache->LiveVtxCount += row->VtxCount;
+}
+
+// [Internal] Called by EndTable(): discard rows not used during this frame when the cache grows too much.
+void ImGui::TableRowCacheGc(ImGuiTable* table)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTableRowCache* cache = table->RowCache;
+    IM_ASSERT(cache->RecordRow == -1);
+    const int used_count = (cache->UsedFrame == g.FrameCount) ? cache->UsedCount : 0;
+    if (cache->Rows.Size <= used_count * 2 + 64 && cache->VtxBuffer.Size <= cache->LiveVtxCount * 2 + 4096)
+        return;
+
+    ImGuiTableRowCache new_cache;
+    for (const ImGuiTableCachedRow& src_row : cache->Rows)
+    {
+        if (!src_row.IsValid || src_row.LastFrameUsed != g.FrameCount)
+            continue;
+        new_cache.RowsMap.Data.push_back(ImGuiStoragePair(src_row.RowID, new_cache.Rows.Size));
+        new_cache.Rows.push_back(src_row);
+        ImGuiTableCachedRow* dst_row = &new_cache.Rows.back();
+        dst_row->CellsOffset = new_cache.Cells.Size;
+        dst_row->CellsBgOffset = new_cache.CellsBg.Size;
+        for (int n = 0; n < src_row.CellsCount; n++)
+        {
+            ImGuiTableCachedCell cell = cache->Cells[src_row.CellsOffset + n];
+            new_cache.VtxBuffer.resize(new_cache.VtxBuffer.Size + cell.VtxCount);
+            new_cache.IdxBuffer.resize(new_cache.IdxBuffer.Size + cell.IdxCount);
+            memcpy(new_cache.VtxBuffer.Data + new_cache.VtxBuffer.Size - cell.VtxCount, cache->VtxBuffer.Data + cell.VtxOffset, (size_t)cell.VtxCount * sizeof(ImDrawVert));
+            memcpy(new_cache.IdxBuffer.Data + new_cache.IdxBuffer.Size - cell.IdxCount, cache->IdxBuffer.Data + cell.IdxOffset, (size_t)cell.IdxCount * sizeof(ImDrawIdx));
+            cell.VtxOffset = new_cache.VtxBuffer.Size - cell.VtxCount;
+            cell.IdxOffset = new_cache.IdxBuffer.Size - cell.IdxCount;
+            new_cache.Cells.push_back(cell);
+        }
+        for (int n = 0; n < src_row.CellsBgCount; n++)
+            new_cache.CellsBg.push_back(cache->CellsBg[src_row.CellsBgOffset + n]);
+        new_cache.LiveVtxCount += src_row.VtxCount;
+    }
+    new_cache.RowsMap.BuildSortByKey();
+    new_cache.RowsMap.Data.swap(cache->RowsMap.Data);
+    new_cache.Rows.swap(cache->Rows);
+    new_cache.Cells.swap(cache->Cells);
+    new_cache.CellsBg.swap(cache->CellsBg);
+    new_cache.VtxBuffer.swap(cache->VtxBuffer);
+    new_cache.IdxBuffer.swap(cache->IdxBuffer);
+    cache->LiveVtxCount = new_cache.LiveVtxCount;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Columns changes
 //-------------------------------------------------------------------------
 // - TableGetColumnIndex()
 // - TableSetColumnIndex()
 // - TableNextColumn()
+// - TableNextVisibleColumn()
 // - TableBeginCell() [Internal]
 // - TableEndCell() [Internal]
 //-------------------------------------------------------------------------
@@ -2159,10 +2530,30 @@ bool ImGui::TableNextColumn()
     return table->Columns[table->CurrentColumn].IsRequestOutput;
 }
 
+// [Public] Append into the next column for which TableNextColumn() would return true, skipping the others.
+// Unlike TableNextColumn(), this doesn't wrap-around into a new row: use 'TableNextRow(); while (TableNextVisibleColumn()) { ... }'.
+// As columns are chained during layout, cost doesn't depend on the number of clipped columns.
+bool ImGui::TableNextVisibleColumn()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    if (!table)
+        return false;
+
+    if (!table->IsInsideRow)
+        TableNextRow();
+    const int column_n = (table->CurrentColumn == -1) ? table->FirstRequestOutputColumn : table->Columns[table->CurrentColumn].NextRequestOutputColumn;
+    if (column_n == -1)
+        return false;
+    if (table->CurrentColumn != -1)
+        TableEndCell(table);
+    TableBeginCell(table, column_n);
+    return true;
+}
 
 // [Internal] Called by TableSetColumnIndex()/TableNextColumn()
 // This is called very frequently, so we need to be mindful of unnecessary overhead.
-// FIXME-TABLE FIXME-OPT: Could probably shortcut some things for non-active or clipped columns.
+// FIXME-TABLE FIXME-OPT: Could probably shortcut some things for non-active or clipped columns. Wide tables can avoid calling this for clipped columns with TableNextVisibleColumn().
 void ImGui::TableBeginCell(ImGuiTable* table, int column_n)
 {
     ImGuiContext& g = *GImGui;
@@ -2209,6 +2600,8 @@ void ImGui::TableBeginCell(ImGuiTable* table, int column_n)
         SetWindowClipRectBeforeSetChannel(window, column->ClipRect);
         table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
     }
+    if (table->RowCache != NULL && table->RowCache->RecordRow != -1)
+        TableRowCacheBeginCell(table);
 
     // Logging
     if (g.LogEnabled && !column->IsSkipItems)
@@ -2241,6 +2634,9 @@ void ImGui::TableEndCell(ImGuiTable* table)
     // Propagate text baseline for the entire row
     // FIXME-TABLE: Here we propagate text baseline from the last line of the cell.. instead of the first one.
     table->RowTextBaseline = ImMax(table->RowTextBaseline, window->DC.PrevLineTextBaseOffset);
+
+    if (table->RowCache != NULL && table->RowCache->RecordRow != -1)
+        TableRowCacheEndCell(table, column);
 }
 
 //-------------------------------------------------------------------------
@@ -2515,18 +2911,19 @@ void ImGui::TablePopColumnChannel()
 //   channels, while simplifying per-row/per-cell overhead. It will be empty and discarded when merged.
 // - We allocate 1 or 2 background draw channels. This is because we know TablePushBackgroundChannel() is only used for
 //   horizontal spanning. If we allowed vertical spanning we'd need one background draw channel per merge group (1-4).
+// - We only allocate channels for visible columns, so very wide tables don't pay for columns scrolled out of view.
 // Draw channel allocation (before merging):
 // - NoClip                       --> 2+D+1 channels: bg0/1 + bg2 + foreground (same clip rect == always 1 draw call)
 // - Clip                         --> 2+D+N channels
 // - FreezeRows                   --> 2+D+N*2 (unless scrolling value is zero)
 // - FreezeRows || FreezeColunns  --> 3+D+N*2 (unless scrolling value is zero)
-// Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
+// Where N is the number of visible columns, and D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsVisibleCount;
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
-    const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
+    const int channels_for_dummy = (table->ColumnsVisibleCount < table->ColumnsCount) ? +1 : 0;
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
     table->DrawSplitter->Split(table->InnerWindow->DrawList, channels_total);
     table->DummyDrawChannel = (ImGuiTableDrawChannelIdx)((channels_for_dummy > 0) ? channels_total - 1 : -1);
@@ -2608,7 +3005,7 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     MergeGroup merge_groups[4];
 
     // Use a reusable temp buffer for the merge masks as they are dynamically sized.
-    const int max_draw_channels = (4 + table->ColumnsCount * 2);
+    const int max_draw_channels = splitter->_Count;
     const int size_for_masks_bitarrays_one = (int)ImBitArrayGetStorageSizeInBytes(max_draw_channels);
     g.TempBuffer.reserve(size_for_masks_bitarrays_one * 5);
     memset(g.TempBuffer.Data, 0, size_for_masks_bitarrays_one * 5);
@@ -2630,7 +3027,7 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
 
             // Don't attempt to merge if there are multiple draw calls within the column
             ImDrawChannel* src_channel = &splitter->_Channels[channel_no];
-            if (src_channel->_CmdBuffer.Size > 0 && src_channel->_CmdBuffer.back().ElemCount == 0 && src_channel->_CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+            if (src_channel->_CmdBuffer.Size > 0 && src_channel->_CmdBuffer.back().ElemCount == 0 && src_channel->_CmdBuffer.back().InstCount == 0 && src_channel->_CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
                 src_channel->_CmdBuffer.pop_back();
             if (src_channel->_CmdBuffer.Size != 1)
                 continue;
@@ -3121,11 +3518,11 @@ void ImGui::TableHeadersRow()
     if (table->HostSkipItems) // Merely an optimization, you may skip in your own code.
         return;
 
+    // Only visit columns for which TableSetColumnIndex() would return true, so wide tables don't pay for clipped columns.
     const int columns_count = TableGetColumnCount();
-    for (int column_n = 0; column_n < columns_count; column_n++)
+    while (TableNextVisibleColumn())
     {
-        if (!TableSetColumnIndex(column_n))
-            continue;
+        const int column_n = TableGetColumnIndex();
 
         // Push an id to allow empty/unnamed headers. This is also idiomatic as it ensure there is a consistent ID path to access columns (for e.g. automation)
         const char* name = (TableGetColumnFlags(column_n) & ImGuiTableColumnFlags_NoHeaderLabel) ? "" : TableGetColumnName(column_n);
@@ -3428,11 +3825,15 @@ void ImGui::TableAngledHeadersRowEx(ImGuiID row_id, float angle, float max_label
                     float clip_width = max_label_width - padding.y; // Using padding.y*2.0f would be symmetrical but hide more text.
                     float clip_height = ImMin(label_size.y, column->ClipRect.Max.x - column->WorkMinX - line_off_curr_x);
                     ImRect clip_r(window->ClipRect.Min, window->ClipRect.Min + ImVec2(clip_width, clip_height));
+                    ImDrawListFlags backup_flags = draw_list->Flags;
+                    draw_list->Flags &= ~(ImDrawListFlags_AllowInstances | ImDrawListFlags_CpuClipRects); // Need vertices to rotate, and clipping to be done after rotation
+                    draw_list->_OnChangedClipRect();
                     int vtx_idx_begin = draw_list->_VtxCurrentIdx;
                     PushStyleColor(ImGuiCol_Text, request->TextColor);
                     RenderTextEllipsis(draw_list, clip_r.Min, clip_r.Max, clip_r.Max.x, label_name, label_name_eol, &label_size);
                     PopStyleColor();
                     int vtx_idx_end = draw_list->_VtxCurrentIdx;
+                    draw_list->Flags = backup_flags;
 
                     // Up<>Down alignment
                     const float available_space = ImMax(clip_width - label_size.x + ImAbs(padding.x * cos_a) * 2.0f - ImAbs(padding.y * sin_a) * 2.0f, 0.0f);
@@ -3648,18 +4049,20 @@ ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
     ImGuiContext& g = *GImGui;
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
+    g.SettingsTablesMap.SetInt(id, g.SettingsTables.offset_from_ptr(settings));
     return settings;
 }
 
 // Find existing settings
+// The map holds the most recently created entry for an ID. Invalidated entries (ID set to 0) are not returned.
 ImGuiTableSettings* ImGui::TableSettingsFindByID(ImGuiID id)
 {
-    // FIXME-OPT: Might want to store a lookup map for this?
     ImGuiContext& g = *GImGui;
-    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsTablesMap.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiTableSettings* settings = g.SettingsTables.ptr_from_offset(offset);
+    return (settings->ID == id) ? settings : NULL;
 }
 
 // Get settings for a given table, NULL if none
@@ -3819,6 +4222,7 @@ static void TableSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandle
         if (ImGuiTable* table = g.Tables.TryGetMapData(i))
             table->SettingsOffset = -1;
     g.SettingsTables.clear();
+    g.SettingsTablesMap.Clear();
 }
 
 // Apply to existing windows (if any)
@@ -3961,6 +4365,11 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTable* table)
     table->SortSpecsMulti.clear();
     table->IsSortSpecsDirty = true; // FIXME: In theory shouldn't have to leak into user performing a sort on resume.
     table->ColumnsNames.clear();
+    if (table->RowCache != NULL)
+    {
+        IM_DELETE(table->RowCache);
+        table->RowCache = NULL;
+    }
     table->MemoryCompacted = true;
     for (int n = 0; n < table->ColumnsCount; n++)
         table->Columns[n].NameOffset = -1;
@@ -3989,6 +4398,19 @@ void ImGui::TableGcCompactSettings()
         if (settings->ID != 0)
             memcpy(new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount)), settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
     g.SettingsTables.swap(new_chunk_stream);
+
+    // Rebuild lookup map and rebind tables, as all offsets have changed
+    g.SettingsTablesMap.Clear();
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+        g.SettingsTablesMap.Data.push_back(ImGuiStoragePair(settings->ID, g.SettingsTables.offset_from_ptr(settings)));
+    g.SettingsTablesMap.BuildSortByKey();
+    for (int i = 0; i != g.Tables.GetMapSize(); i++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(i))
+            if (table->SettingsOffset != -1)
+            {
+                ImGuiTableSettings* settings = TableSettingsFindByID(table->ID);
+                table->SettingsOffset = settings ? g.SettingsTables.offset_from_ptr(settings) : -1;
+            }
 }
 
 
@@ -4043,6 +4465,8 @@ void ImGui::DebugNodeTable(ImGuiTable* table)
         ImGuiTableInstanceData* table_instance = TableGetInstanceData(table, n);
         BulletText("Instance %d: HoveredRow: %d, LastOuterHeight: %.2f", n, table_instance->HoveredRowLast, table_instance->LastOuterHeight);
     }
+    if (ImGuiTableRowCache* cache = table->RowCache)
+        BulletText("RowCache: %d rows (%d used), %d/%d vertices", cache->Rows.Size, cache->UsedCount, cache->LiveVtxCount, cache->VtxBuffer.Size);
     //BulletText("BgDrawChannels: %d/%d", 0, table->BgDrawChannelUnfrozen);
     float sum_weights = 0.0f;
     for (int n = 0; n < table->ColumnsCount; n++)
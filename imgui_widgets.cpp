@@ -4005,6 +4005,13 @@ static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, c
     return text_size;
 }
 
+// Measure text from 'line_start' to 'pos' on the same line. A line is always contiguous, even with ImGuiInputTextFlags_ChunkedText.
+static float InputTextCalcLineOffsetX(ImGuiInputTextState* state, int line_start, int pos)
+{
+    const char* line = state->TextGetSpan(line_start, NULL);
+    return InputTextCalcTextSize(state->Ctx, line, line + (pos - line_start)).x;
+}
+
 // Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
 // With our UTF-8 use of stb_textedit:
 // - STB_TEXTEDIT_GETCHAR is nothing more than a a "GETBYTE". It's only used to compare to ascii or to copy blocks of text so we are fine.
@@ -4013,20 +4020,23 @@ static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, c
 namespace ImStb
 {
 static int     STB_TEXTEDIT_STRINGLEN(const ImGuiInputTextState* obj)                             { return obj->TextLen; }
-static char    STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { IM_ASSERT(idx <= obj->TextLen); return obj->TextSrc[idx]; }
-static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { unsigned int c; ImTextCharFromUtf8(&c, obj->TextSrc + line_start_idx + char_idx, obj->TextSrc + obj->TextLen); if ((ImWchar)c == '\n') return IMSTB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; return g.FontBaked->GetCharAdvance((ImWchar)c) * g.FontBakedScale; }
+static unsigned int InputTextGetCodepoint(const ImGuiInputTextState* obj, int idx)              { const char* text_end; const char* text = obj->TextGetSpan(idx, &text_end); unsigned int c; ImTextCharFromUtf8(&c, text, text_end); return c; }
+static char    STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { IM_ASSERT(idx <= obj->TextLen); return obj->TextGetChar(idx); }
+static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { unsigned int c = InputTextGetCodepoint(obj, line_start_idx + char_idx); if ((ImWchar)c == '\n') return IMSTB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; return g.FontBaked->GetCharAdvance((ImWchar)c) * g.FontBakedScale; }
 static char    STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* obj, int line_start_idx)
 {
-    const char* text = obj->TextSrc;
+    // A line is always contiguous, even with ImGuiInputTextFlags_ChunkedText
+    const char* text_end;
+    const char* text = obj->TextGetSpan(line_start_idx, &text_end);
     const char* text_remaining = NULL;
-    const ImVec2 size = InputTextCalcTextSize(obj->Ctx, text + line_start_idx, text + obj->TextLen, &text_remaining, NULL, true);
+    const ImVec2 size = InputTextCalcTextSize(obj->Ctx, text, text_end, &text_remaining, NULL, true);
     r->x0 = 0.0f;
     r->x1 = size.x;
     r->baseline_y_delta = size.y;
     r->ymin = 0.0f;
     r->ymax = size.y;
-    r->num_chars = (int)(text_remaining - (text + line_start_idx));
+    r->num_chars = (int)(text_remaining - text);
 }
 
 #define IMSTB_TEXTEDIT_GETNEXTCHARINDEX  IMSTB_TEXTEDIT_GETNEXTCHARINDEX_IMPL
@@ -4036,16 +4046,43 @@ static int IMSTB_TEXTEDIT_GETNEXTCHARINDEX_IMPL(ImGuiInputTextState* obj, int id
 {
     if (idx >= obj->TextLen)
         return obj->TextLen + 1;
+    const char* text_end;
+    const char* text = obj->TextGetSpan(idx, &text_end);
     unsigned int c;
-    return idx + ImTextCharFromUtf8(&c, obj->TextSrc + idx, obj->TextSrc + obj->TextLen);
+    return idx + ImTextCharFromUtf8(&c, text, text_end);
 }
 
 static int IMSTB_TEXTEDIT_GETPREVCHARINDEX_IMPL(ImGuiInputTextState* obj, int idx)
 {
     if (idx <= 0)
         return -1;
-    const char* p = ImTextFindPreviousUtf8Codepoint(obj->TextSrc, obj->TextSrc + idx);
-    return (int)(p - obj->TextSrc);
+    idx--;
+    while (idx > 0 && (obj->TextGetChar(idx) & 0xC0) == 0x80)
+        idx--;
+    return idx;
+}
+
+// Skip rows before the one straddling 'y' (or character 'n') using our line index, as rows are lines (no word-wrapping).
+// We stop one row early, so stb_textedit.h own loop still finds the exact row and the previous row.
+#define IMSTB_TEXTEDIT_FINDROW_Y    IMSTB_TEXTEDIT_FINDROW_Y_IMPL
+#define IMSTB_TEXTEDIT_FINDROW_CHAR IMSTB_TEXTEDIT_FINDROW_CHAR_IMPL
+
+static void IMSTB_TEXTEDIT_FINDROW_Y_IMPL(ImGuiInputTextState* obj, float y, int* p_row_start, float* p_row_y)
+{
+    obj->LineIndexUpdate();
+    const float line_height = obj->Ctx->FontSize;
+    const int line_n = (y > line_height) ? ImMin((int)(y / line_height) - 1, obj->LineOffsets.Size - 1) : 0;
+    *p_row_start = obj->LineOffsets[line_n];
+    *p_row_y = line_n * line_height;
+}
+
+static void IMSTB_TEXTEDIT_FINDROW_CHAR_IMPL(ImGuiInputTextState* obj, int n, int* p_row_start, int* p_prev_row_start, float* p_row_y)
+{
+    obj->LineIndexUpdate();
+    const int line_n = ImMax(obj->LineIndexFindLine(n) - 1, 0);
+    *p_row_start = obj->LineOffsets[line_n];
+    *p_prev_row_start = obj->LineOffsets[ImMax(line_n - 1, 0)];
+    *p_row_y = line_n * obj->Ctx->FontSize;
 }
 
 static bool ImCharIsSeparatorW(unsigned int c)
@@ -4068,10 +4105,8 @@ static int is_word_boundary_from_right(ImGuiInputTextState* obj, int idx)
     if ((obj->Flags & ImGuiInputTextFlags_Password) || idx <= 0)
         return 0;
 
-    const char* curr_p = obj->TextSrc + idx;
-    const char* prev_p = ImTextFindPreviousUtf8Codepoint(obj->TextSrc, curr_p);
-    unsigned int curr_c; ImTextCharFromUtf8(&curr_c, curr_p, obj->TextSrc + obj->TextLen);
-    unsigned int prev_c; ImTextCharFromUtf8(&prev_c, prev_p, obj->TextSrc + obj->TextLen);
+    unsigned int curr_c = InputTextGetCodepoint(obj, idx);
+    unsigned int prev_c = InputTextGetCodepoint(obj, IMSTB_TEXTEDIT_GETPREVCHARINDEX(obj, idx));
 
     bool prev_white = ImCharIsBlankW(prev_c);
     bool prev_separ = ImCharIsSeparatorW(prev_c);
@@ -4084,10 +4119,8 @@ static int is_word_boundary_from_left(ImGuiInputTextState* obj, int idx)
     if ((obj->Flags & ImGuiInputTextFlags_Password) || idx <= 0)
         return 0;
 
-    const char* curr_p = obj->TextSrc + idx;
-    const char* prev_p = ImTextFindPreviousUtf8Codepoint(obj->TextSrc, curr_p);
-    unsigned int prev_c; ImTextCharFromUtf8(&prev_c, curr_p, obj->TextSrc + obj->TextLen);
-    unsigned int curr_c; ImTextCharFromUtf8(&curr_c, prev_p, obj->TextSrc + obj->TextLen);
+    unsigned int prev_c = InputTextGetCodepoint(obj, idx);
+    unsigned int curr_c = InputTextGetCodepoint(obj, IMSTB_TEXTEDIT_GETPREVCHARINDEX(obj, idx));
 
     bool prev_white = ImCharIsBlankW(prev_c);
     bool prev_separ = ImCharIsSeparatorW(prev_c);
@@ -4122,13 +4155,33 @@ static int  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL(ImGuiInputTextState* obj, int idx)
 #define STB_TEXTEDIT_MOVEWORDLEFT       STB_TEXTEDIT_MOVEWORDLEFT_IMPL  // They need to be #define for stb_textedit.h
 #define STB_TEXTEDIT_MOVEWORDRIGHT      STB_TEXTEDIT_MOVEWORDRIGHT_IMPL
 
+// Both functions below move the whole tail of TextA, or only text within a chunk when using ImGuiInputTextFlags_ChunkedText.
+// FIXME-OPT: LineOffsets[] after the edit are still offset one by one.
 static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 {
-    // Offset remaining text (+ copy zero terminator)
-    IM_ASSERT(obj->TextSrc == obj->TextA.Data);
-    char* dst = obj->TextA.Data + pos;
-    char* src = obj->TextA.Data + pos + n;
-    memmove(dst, src, obj->TextLen - n - pos + 1);
+    IM_ASSERT(obj->TextSrc == (obj->TextChunked ? NULL : obj->TextA.Data));
+    if (!obj->LineOffsetsDirty)
+    {
+        // Remove lines starting in (pos, pos+n], offset following ones
+        const int line_first = obj->LineIndexFindLine(pos) + 1;
+        const int line_last = obj->LineIndexFindLine(pos + n) + 1;
+        if (line_first < line_last)
+            obj->LineOffsets.erase(obj->LineOffsets.Data + line_first, obj->LineOffsets.Data + line_last);
+        for (int line_n = line_first; line_n < obj->LineOffsets.Size; line_n++)
+            obj->LineOffsets[line_n] -= n;
+    }
+    if (obj->TextChunked)
+    {
+        obj->ChunksDelete(pos, n);
+    }
+    else
+    {
+        // Offset remaining text (+ copy zero terminator)
+        char* dst = obj->TextA.Data + pos;
+        char* src = obj->TextA.Data + pos + n;
+        memmove(dst, src, obj->TextLen - n - pos + 1);
+    }
+    obj->EditRangeAdd(pos, n, 0);
     obj->Edited = true;
     obj->TextLen -= n;
 }
@@ -4142,24 +4195,50 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ch
     if (!is_resizable && (new_text_len + obj->TextLen + 1 > obj->BufCapacity))
         return false;
 
-    // Grow internal buffer if needed
-    IM_ASSERT(obj->TextSrc == obj->TextA.Data);
-    if (new_text_len + text_len + 1 > obj->TextA.Size)
+    IM_ASSERT(obj->TextSrc == (obj->TextChunked ? NULL : obj->TextA.Data));
+    if (obj->TextChunked)
     {
-        if (!is_resizable)
-            return false;
-        obj->TextA.resize(text_len + ImClamp(new_text_len, 32, ImMax(256, new_text_len)) + 1);
-        obj->TextSrc = obj->TextA.Data;
+        obj->ChunksInsert(pos, new_text, new_text_len);
     }
+    else
+    {
+        // Grow internal buffer if needed
+        if (new_text_len + text_len + 1 > obj->TextA.Size)
+        {
+            if (!is_resizable)
+                return false;
+            obj->TextA.resize(text_len + ImClamp(new_text_len, 32, ImMax(256, new_text_len)) + 1);
+            obj->TextSrc = obj->TextA.Data;
+        }
 
-    char* text = obj->TextA.Data;
-    if (pos != text_len)
-        memmove(text + pos + new_text_len, text + pos, (size_t)(text_len - pos));
-    memcpy(text + pos, new_text, (size_t)new_text_len);
+        char* text = obj->TextA.Data;
+        if (pos != text_len)
+            memmove(text + pos + new_text_len, text + pos, (size_t)(text_len - pos));
+        memcpy(text + pos, new_text, (size_t)new_text_len);
+    }
 
+    if (!obj->LineOffsetsDirty)
+    {
+        // Offset lines starting after pos, add lines starting in inserted text
+        const int line_first = obj->LineIndexFindLine(pos) + 1;
+        int new_lines_count = 0;
+        for (int n = 0; n < new_text_len; n++)
+            if (new_text[n] == '\n')
+                new_lines_count++;
+        const int old_lines_count = obj->LineOffsets.Size;
+        obj->LineOffsets.resize(old_lines_count + new_lines_count);
+        for (int line_n = old_lines_count - 1; line_n >= line_first; line_n--)
+            obj->LineOffsets[line_n + new_lines_count] = obj->LineOffsets[line_n] + new_text_len;
+        for (int n = 0, line_n = line_first; n < new_text_len; n++)
+            if (new_text[n] == '\n')
+                obj->LineOffsets[line_n++] = pos + n + 1;
+    }
+
+    obj->EditRangeAdd(pos, 0, new_text_len);
     obj->Edited = true;
     obj->TextLen += new_text_len;
-    obj->TextA[obj->TextLen] = '\0';
+    if (!obj->TextChunked)
+        obj->TextA[obj->TextLen] = '\0';
 
     return true;
 }
@@ -4187,6 +4266,64 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ch
 #define IMSTB_TEXTEDIT_memmove memmove
 #include "imstb_textedit.h"
 
+// Undo/redo records are stored in ImGuiInputTextState::UndoStack/RedoStack instead of stb_textedit fixed-size buffer (see IMSTB_TEXTEDIT_CUSTOM_UNDO)
+static void stb_text_makeundo_insert(ImGuiInputTextState* str, STB_TexteditState* state, int where, int length)
+{
+    IM_UNUSED(state);
+    str->UndoCreateRecord(where, 0, length);
+}
+
+static void stb_text_makeundo_delete(ImGuiInputTextState* str, STB_TexteditState* state, int where, int length)
+{
+    IM_UNUSED(state);
+    if (char* p = str->UndoCreateRecord(where, length, 0))
+        str->TextCopy(p, where, length);
+}
+
+static void stb_text_makeundo_replace(ImGuiInputTextState* str, STB_TexteditState* state, int where, int old_length, int new_length)
+{
+    IM_UNUSED(state);
+    if (char* p = str->UndoCreateRecord(where, old_length, new_length))
+        str->TextCopy(p, where, old_length);
+}
+
+// Apply last record of 'src' (and the ones grouped with it), and push the opposite records to 'dst'
+static void stb_text_undo_apply(ImGuiInputTextState* str, STB_TexteditState* state, ImGuiInputTextUndoStack* src, ImGuiInputTextUndoStack* dst)
+{
+    for (bool first = true; src->GetRecordsCount() > 0; first = false)
+    {
+        const ImGuiInputTextUndoRecord rec = src->Records.back();
+        if (rec.Where + rec.DeleteLen > str->TextLen)
+        {
+            str->UndoClear(); // Text was modified without being recorded
+            return;
+        }
+
+        // The opposite record deletes what we insert, and inserts back what we delete.
+        // Records of a group are applied in reverse order, so the opposite group is linked from its top.
+        char* p = dst->PushRecord(rec.Where, rec.InsertLen, rec.DeleteLen, 0);
+        dst->Records.back().GroupWithPrevious = !first;
+        if (rec.DeleteLen > 0)
+        {
+            str->TextCopy(p, rec.Where, rec.DeleteLen);
+            STB_TEXTEDIT_DELETECHARS(str, rec.Where, rec.DeleteLen);
+        }
+        if (rec.InsertLen > 0 && !STB_TEXTEDIT_INSERTCHARS(str, rec.Where, src->Chars.Data + rec.CharsOffset, rec.InsertLen))
+        {
+            str->UndoClear(); // Buffer is full
+            return;
+        }
+        state->cursor = rec.Where + rec.InsertLen;
+        src->PopRecord();
+        if (!rec.GroupWithPrevious)
+            break;
+    }
+    str->UndoTrim(IMGUI_INPUTTEXT_UNDO_MAX_BYTES, 1);
+}
+
+static void stb_text_undo(ImGuiInputTextState* str, STB_TexteditState* state) { stb_text_undo_apply(str, state, &str->UndoStack, &str->RedoStack); }
+static void stb_text_redo(ImGuiInputTextState* str, STB_TexteditState* state) { stb_text_undo_apply(str, state, &str->RedoStack, &str->UndoStack); }
+
 // stb_textedit internally allows for a single undo record to do addition and deletion, but somehow, calling
 // the stb_textedit_paste() function creates two separate records, so we perform it manually. (FIXME: Report to nothings/stb?)
 static void stb_textedit_replace(ImGuiInputTextState* str, STB_TexteditState* state, const IMSTB_TEXTEDIT_CHARTYPE* text, int text_len)
@@ -4213,16 +4350,24 @@ ImGuiInputTextState::ImGuiInputTextState()
     memset(this, 0, sizeof(*this));
     Stb = IM_NEW(ImStbTexteditState);
     memset(Stb, 0, sizeof(*Stb));
+    LineOffsetsDirty = true;
+    EditRangeClear();
+    UndoGroupEnd();
 }
 
 ImGuiInputTextState::~ImGuiInputTextState()
 {
+    ChunksClear();
     IM_DELETE(Stb);
 }
 
 void ImGuiInputTextState::OnKeyPressed(int key)
 {
+    const int key_no_shift = key & ~STB_TEXTEDIT_K_SHIFT;
+    const bool is_delete_char = (key_no_shift == STB_TEXTEDIT_K_BACKSPACE || key_no_shift == STB_TEXTEDIT_K_DELETE) && !HasSelection();
+    UndoCoalesceKind = is_delete_char ? 2 : 0;
     stb_textedit_key(this, Stb, key);
+    UndoCoalesceKind = 0;
     CursorFollow = true;
     CursorAnimReset();
 }
@@ -4233,7 +4378,11 @@ void ImGuiInputTextState::OnCharPressed(unsigned int c)
     // The changes we had to make to stb_textedit_key made it very much UTF-8 specific which is not too great.
     char utf8[5];
     ImTextCharToUtf8(utf8, c);
+    UndoCoalesceKind = 1;
+    UndoGroupBegin(); // Typing over a selection is undone in one step
     stb_textedit_text(this, Stb, utf8, (int)ImStrlen(utf8));
+    UndoGroupEnd();
+    UndoCoalesceKind = 0;
     CursorFollow = true;
     CursorAnimReset();
 }
@@ -4247,6 +4396,364 @@ int  ImGuiInputTextState::GetCursorPos() const              { return Stb->cursor
 int  ImGuiInputTextState::GetSelectionStart() const         { return Stb->select_start; }
 int  ImGuiInputTextState::GetSelectionEnd() const           { return Stb->select_end; }
 void ImGuiInputTextState::SelectAll()                       { Stb->select_start = 0; Stb->cursor = Stb->select_end = TextLen; Stb->has_preferred_x = 0; }
+
+char* ImGuiInputTextUndoStack::PushRecord(int where, int delete_len, int insert_len, int coalesce_kind)
+{
+    ImGuiInputTextUndoRecord rec;
+    rec.Where = where;
+    rec.DeleteLen = delete_len;
+    rec.InsertLen = insert_len;
+    rec.CharsOffset = Chars.Size;
+    rec.CoalesceKind = coalesce_kind;
+    rec.GroupWithPrevious = false;
+    Records.push_back(rec);
+    Chars.resize(Chars.Size + insert_len);
+    return Chars.Data + rec.CharsOffset;
+}
+
+void ImGuiInputTextUndoStack::PopRecord()
+{
+    IM_ASSERT(GetRecordsCount() > 0);
+    Chars.resize(Records.back().CharsOffset);
+    Records.pop_back();
+    if (GetRecordsCount() == 0)
+        Clear();
+}
+
+void ImGuiInputTextUndoStack::DropOldestRecord()
+{
+    IM_ASSERT(GetRecordsCount() > 0);
+    RecordsHead++;
+    if (RecordsHead == Records.Size)
+    {
+        Clear();
+        return;
+    }
+    CharsHead = Records[RecordsHead].CharsOffset;
+    Records[RecordsHead].GroupWithPrevious = false;
+
+    // Compact once half of the arrays is dead
+    if (RecordsHead * 2 >= Records.Size || CharsHead * 2 >= Chars.Size)
+    {
+        Records.erase(Records.Data, Records.Data + RecordsHead);
+        if (CharsHead > 0)
+            Chars.erase(Chars.Data, Chars.Data + CharsHead);
+        for (ImGuiInputTextUndoRecord& rec : Records)
+            rec.CharsOffset -= CharsHead;
+        RecordsHead = CharsHead = 0;
+    }
+}
+
+// Record an edit replacing 'deleted_len' bytes at 'pos' with 'inserted_len' bytes.
+// Return storage to fill with the deleted bytes (so call before deleting them), or NULL.
+// Consecutive typing is merged into the last record, one word at a time: in this case the typed text is already in TextA.
+// Consecutive Backspace/Delete are merged into the last record.
+char* ImGuiInputTextState::UndoCreateRecord(int pos, int deleted_len, int inserted_len)
+{
+    if ((Flags & ImGuiInputTextFlags_NoUndoRedo) || (deleted_len == 0 && inserted_len == 0))
+        return NULL;
+    RedoStack.Clear();
+
+    const int coalesce_kind = (UndoCoalesceKind == 1 && deleted_len == 0) ? 1 : (UndoCoalesceKind == 2 && inserted_len == 0) ? 2 : 0;
+    bool merge = false;
+    if (coalesce_kind != 0 && UndoStack.GetRecordsCount() > 0 && UndoStack.Records.back().CoalesceKind == coalesce_kind)
+    {
+        const ImGuiInputTextUndoRecord& last = UndoStack.Records.back();
+        if (coalesce_kind == 1 && last.Where + last.DeleteLen == pos)
+        {
+            const char c = TextGetChar(pos);
+            const char c_prev = TextGetChar(pos - 1);
+            merge = (c != '\n') && !(!ImCharIsBlankA(c) && (ImCharIsBlankA(c_prev) || c_prev == '\n'));
+        }
+        if (coalesce_kind == 2)
+            merge = (pos + deleted_len == last.Where) || (pos == last.Where);
+    }
+
+    // Drop oldest records to make room (may reallocate/compact)
+    const size_t incoming_bytes = (size_t)deleted_len + (merge ? 0 : sizeof(ImGuiInputTextUndoRecord));
+    UndoTrim(IMGUI_INPUTTEXT_UNDO_MAX_BYTES > incoming_bytes ? IMGUI_INPUTTEXT_UNDO_MAX_BYTES - incoming_bytes : 0, merge ? 1 : 0);
+
+    if (!merge)
+    {
+        char* p = UndoStack.PushRecord(pos, inserted_len, deleted_len, coalesce_kind);
+        if (UndoGroupSize >= 0)
+            UndoStack.Records.back().GroupWithPrevious = (UndoGroupSize++ > 0);
+        return (deleted_len > 0) ? p : NULL;
+    }
+
+    ImGuiInputTextUndoRecord& last = UndoStack.Records.back();
+    if (coalesce_kind == 1)
+    {
+        last.DeleteLen += inserted_len;
+        return NULL;
+    }
+
+    // Last record's stored bytes are at the end of Chars[]
+    UndoStack.Chars.resize(UndoStack.Chars.Size + deleted_len);
+    char* chars = UndoStack.Chars.Data + last.CharsOffset;
+    last.InsertLen += deleted_len;
+    if (pos + deleted_len == last.Where)
+    {
+        // Backspace: prepend
+        memmove(chars + deleted_len, chars, (size_t)(last.InsertLen - deleted_len));
+        last.Where = pos;
+        return chars;
+    }
+    return chars + last.InsertLen - deleted_len; // Delete: append
+}
+
+void ImGuiInputTextState::UndoTrim(size_t max_bytes, int keep_count)
+{
+    while (UndoStack.GetMemoryBytes() + RedoStack.GetMemoryBytes() > max_bytes)
+    {
+        if (UndoStack.GetRecordsCount() > keep_count)
+            UndoStack.DropOldestRecord();
+        else if (RedoStack.GetRecordsCount() > keep_count)
+            RedoStack.DropOldestRecord();
+        else
+            break;
+    }
+}
+
+// Merge an edit (at 'pos' in current text) into the range of modified text.
+// Text before EditRangeStart and after EditRangeEnd is the same as when the range was cleared.
+void ImGuiInputTextState::EditRangeAdd(int pos, int deleted_len, int inserted_len)
+{
+    if (EditRangeStart < 0)
+    {
+        EditRangeStart = pos;
+        EditRangeEnd = pos + inserted_len;
+        EditRangeDelta = inserted_len - deleted_len;
+        return;
+    }
+    EditRangeStart = ImMin(EditRangeStart, pos);
+    EditRangeEnd = ImMax(EditRangeEnd, pos + deleted_len) + inserted_len - deleted_len;
+    EditRangeDelta += inserted_len - deleted_len;
+}
+
+void ImGuiInputTextState::LineIndexUpdate()
+{
+    if (!LineOffsetsDirty)
+        return;
+    IM_ASSERT(TextSrc != NULL || TextChunked);
+    LineOffsets.resize(0);
+    LineOffsets.push_back(0);
+    for (int pos = 0; pos < TextLen; )
+    {
+        const char* span_end;
+        const char* span = TextGetSpan(pos, &span_end);
+        for (const char* p = span; (p = (const char*)ImMemchr(p, '\n', (size_t)(span_end - p))) != NULL; )
+            LineOffsets.push_back(pos + (int)(++p - span));
+        pos += (int)(span_end - span);
+    }
+    LineOffsetsDirty = false;
+}
+
+int ImGuiInputTextState::LineIndexFindLine(int offset) const
+{
+    IM_ASSERT(!LineOffsetsDirty);
+    int lo = 0, hi = LineOffsets.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (LineOffsets[mid] <= offset)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// Text is read from TextSrc/TextA (contiguous), or from TextChunks[] when using ImGuiInputTextFlags_ChunkedText (TextSrc == NULL, unless read-only).
+const char* ImGuiInputTextState::TextGetSpan(int pos, const char** out_span_end) const
+{
+    IM_ASSERT(pos >= 0 && pos <= TextLen);
+    if (!TextChunked || TextSrc != NULL)
+    {
+        const char* text = TextSrc ? TextSrc : TextA.Data; // TextSrc is only set inside InputText() call
+        if (out_span_end)
+            *out_span_end = text + TextLen;
+        return text + pos;
+    }
+    const ImGuiInputTextChunk& chunk = TextChunks[ChunksFind(pos)];
+    if (out_span_end)
+        *out_span_end = chunk.Data + chunk.Size;
+    return chunk.Data + pos - chunk.Offset;
+}
+
+char ImGuiInputTextState::TextGetChar(int pos) const
+{
+    return (pos < TextLen) ? *TextGetSpan(pos, NULL) : 0;
+}
+
+void ImGuiInputTextState::TextCopy(char* dst, int pos, int len) const
+{
+    while (len > 0)
+    {
+        const char* span_end;
+        const char* span = TextGetSpan(pos, &span_end);
+        const int span_len = ImMin((int)(span_end - span), len);
+        memcpy(dst, span, (size_t)span_len);
+        dst += span_len;
+        pos += span_len;
+        len -= span_len;
+    }
+}
+
+bool ImGuiInputTextState::TextEquals(const char* text, int text_len) const
+{
+    if (text_len != TextLen)
+        return false;
+    for (int pos = 0; pos < text_len; )
+    {
+        const char* span_end;
+        const char* span = TextGetSpan(pos, &span_end);
+        if (memcmp(span, text + pos, (size_t)(span_end - span)) != 0)
+            return false;
+        pos += (int)(span_end - span);
+    }
+    return true;
+}
+
+const char* ImGuiInputTextState::TextFlatten()
+{
+    if (!TextChunked || TextSrc != NULL)
+        return TextSrc ? TextSrc : TextA.Data;
+    TextA.resize(TextLen + 1);
+    TextCopy(TextA.Data, 0, TextLen);
+    TextA[TextLen] = 0;
+    return TextA.Data;
+}
+
+int ImGuiInputTextState::ChunksFind(int pos) const
+{
+    int lo = 0, hi = TextChunks.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (TextChunks[mid].Offset <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// Return length of the first chunk to cut from 'text': up to the last '\n' within IMGUI_INPUTTEXT_CHUNK_SIZE / 2 bytes, or the whole first line if longer.
+static int InputTextChunkCutLen(const char* text, int text_len)
+{
+    const int fill_size = IMGUI_INPUTTEXT_CHUNK_SIZE / 2;
+    if (text_len <= fill_size)
+        return text_len;
+    for (const char* p = text + fill_size; p > text; p--)
+        if (p[-1] == '\n')
+            return (int)(p - text);
+    const char* line_end = (const char*)ImMemchr(text + fill_size, '\n', (size_t)(text_len - fill_size));
+    return line_end ? (int)(line_end + 1 - text) : text_len;
+}
+
+void ImGuiInputTextState::ChunksReplace(int chunk_n, int chunk_count, const char* text, int text_len)
+{
+    IM_ASSERT(chunk_n >= 0 && chunk_n + chunk_count <= TextChunks.Size);
+    for (int n = chunk_n; n < chunk_n + chunk_count; n++)
+        IM_FREE(TextChunks[n].Data);
+
+    // Make room for new chunks. We always keep at least one chunk, even if empty.
+    int new_count = 0;
+    for (int pos = 0; pos < text_len; new_count++)
+        pos += InputTextChunkCutLen(text + pos, text_len - pos);
+    if (new_count == 0 && chunk_count == TextChunks.Size)
+        new_count = 1;
+    const int old_size = TextChunks.Size;
+    if (new_count > chunk_count)
+        TextChunks.resize(old_size + new_count - chunk_count);
+    memmove(TextChunks.Data + chunk_n + new_count, TextChunks.Data + chunk_n + chunk_count, (size_t)(old_size - chunk_n - chunk_count) * sizeof(ImGuiInputTextChunk));
+    if (new_count < chunk_count)
+        TextChunks.resize(old_size + new_count - chunk_count);
+
+    // Fill them (zero-terminated, so decoding a character at the end of a chunk is safe)
+    for (int n = 0, pos = 0; n < new_count; n++)
+    {
+        ImGuiInputTextChunk& chunk = TextChunks[chunk_n + n];
+        chunk.Size = InputTextChunkCutLen(text + pos, text_len - pos);
+        chunk.Capacity = ImMax(IMGUI_INPUTTEXT_CHUNK_SIZE, chunk.Size + IMGUI_INPUTTEXT_CHUNK_SIZE / 2);
+        chunk.Data = (char*)IM_ALLOC((size_t)chunk.Capacity + 1);
+        if (chunk.Size > 0)
+            memcpy(chunk.Data, text + pos, (size_t)chunk.Size);
+        chunk.Data[chunk.Size] = 0;
+        pos += chunk.Size;
+    }
+
+    // Update offsets
+    int offset = (chunk_n > 0) ? TextChunks[chunk_n - 1].Offset + TextChunks[chunk_n - 1].Size : 0;
+    for (int n = chunk_n; n < TextChunks.Size; n++)
+    {
+        TextChunks[n].Offset = offset;
+        offset += TextChunks[n].Size;
+    }
+}
+
+void ImGuiInputTextState::ChunksInsert(int pos, const char* text, int text_len)
+{
+    const int chunk_n = ChunksFind(pos);
+    ImGuiInputTextChunk* chunk = &TextChunks[chunk_n];
+    const int chunk_pos = pos - chunk->Offset;
+    const bool text_in_chunk = (text >= chunk->Data && text <= chunk->Data + chunk->Size); // e.g. InsertChars() with text from GetTextSpan()
+    if (chunk->Size + text_len <= chunk->Capacity && !text_in_chunk)
+    {
+        memmove(chunk->Data + chunk_pos + text_len, chunk->Data + chunk_pos, (size_t)(chunk->Size - chunk_pos + 1)); // + zero terminator
+        memcpy(chunk->Data + chunk_pos, text, (size_t)text_len);
+        chunk->Size += text_len;
+        for (int n = chunk_n + 1; n < TextChunks.Size; n++)
+            TextChunks[n].Offset += text_len;
+        return;
+    }
+
+    // Chunk is full: split it along with inserted text
+    TextA.resize(chunk->Size + text_len + 1);
+    memcpy(TextA.Data, chunk->Data, (size_t)chunk_pos);
+    memcpy(TextA.Data + chunk_pos, text, (size_t)text_len);
+    memcpy(TextA.Data + chunk_pos + text_len, chunk->Data + chunk_pos, (size_t)(chunk->Size - chunk_pos));
+    ChunksReplace(chunk_n, 1, TextA.Data, TextA.Size - 1);
+}
+
+void ImGuiInputTextState::ChunksDelete(int pos, int len)
+{
+    if (len <= 0)
+        return;
+    const int chunk_first = ChunksFind(pos);
+    int chunk_last = ChunksFind(pos + len - 1);
+    const ImGuiInputTextChunk* chunk = &TextChunks[chunk_first];
+    const int chunk_end = chunk->Offset + chunk->Size;
+    if (chunk_first == chunk_last && (pos + len < chunk_end || chunk_first == TextChunks.Size - 1) && (len < chunk->Size || TextChunks.Size == 1))
+    {
+        // Chunk still ends with a '\n' (or is the last one) and isn't empty
+        char* chunk_data = TextChunks[chunk_first].Data;
+        memmove(chunk_data + pos - chunk->Offset, chunk_data + pos + len - chunk->Offset, (size_t)(chunk_end - pos - len + 1)); // + zero terminator
+        TextChunks[chunk_first].Size -= len;
+        for (int n = chunk_first + 1; n < TextChunks.Size; n++)
+            TextChunks[n].Offset -= len;
+        return;
+    }
+
+    // Join what remains of the chunks and rebuild them. If the last '\n' was deleted, the last line continues into next chunk: join it as well.
+    if (pos + len == TextChunks[chunk_last].Offset + TextChunks[chunk_last].Size && chunk_last + 1 < TextChunks.Size)
+        chunk_last++;
+    const int head_len = pos - chunk->Offset;
+    const int tail_len = TextChunks[chunk_last].Offset + TextChunks[chunk_last].Size - (pos + len);
+    TextA.resize(head_len + tail_len + 1);
+    TextCopy(TextA.Data, chunk->Offset, head_len);
+    TextCopy(TextA.Data + head_len, pos + len, tail_len);
+    ChunksReplace(chunk_first, chunk_last - chunk_first + 1, TextA.Data, TextA.Size - 1);
+}
+
+void ImGuiInputTextState::ChunksClear()
+{
+    for (ImGuiInputTextChunk& chunk : TextChunks)
+        IM_FREE(chunk.Data);
+    TextChunks.clear();
+}
+
 void ImGuiInputTextState::ReloadUserBufAndSelectAll()       { WantReloadUserBuf = true; ReloadSelectionStart = 0; ReloadSelectionEnd = INT_MAX; }
 void ImGuiInputTextState::ReloadUserBufAndKeepSelection()   { WantReloadUserBuf = true; ReloadSelectionStart = Stb->select_start; ReloadSelectionEnd = Stb->select_end; }
 void ImGuiInputTextState::ReloadUserBufAndMoveToEnd()       { WantReloadUserBuf = true; ReloadSelectionStart = ReloadSelectionEnd = INT_MAX; }
@@ -4263,9 +4770,27 @@ ImGuiInputTextCallbackData::ImGuiInputTextCallbackData()
 void ImGuiInputTextCallbackData::DeleteChars(int pos, int bytes_count)
 {
     IM_ASSERT(pos + bytes_count <= BufTextLen);
-    char* dst = Buf + pos;
-    const char* src = Buf + pos + bytes_count;
-    memmove(dst, src, BufTextLen - bytes_count - pos + 1);
+    ImGuiContext& g = *Ctx;
+    ImGuiInputTextState* obj = &g.InputTextState;
+    if (obj->CallbackRecordEdits)
+    {
+        IM_ASSERT(Buf == (obj->TextChunked ? NULL : obj->TextA.Data));
+        if (char* p = obj->UndoCreateRecord(pos, bytes_count, 0))
+            obj->TextCopy(p, pos, bytes_count);
+        obj->EditRangeAdd(pos, bytes_count, 0);
+        obj->CallbackRecordedEdits++;
+    }
+
+    if (Buf == NULL)
+    {
+        obj->ChunksDelete(pos, bytes_count); // ImGuiInputTextFlags_ChunkedText
+    }
+    else
+    {
+        char* dst = Buf + pos;
+        const char* src = Buf + pos + bytes_count;
+        memmove(dst, src, BufTextLen - bytes_count - pos + 1);
+    }
 
     if (CursorPos >= pos + bytes_count)
         CursorPos -= bytes_count;
@@ -4274,6 +4799,8 @@ void ImGuiInputTextCallbackData::DeleteChars(int pos, int bytes_count)
     SelectionStart = SelectionEnd = CursorPos;
     BufDirty = true;
     BufTextLen -= bytes_count;
+    if (obj->CallbackRecordEdits)
+        obj->TextLen = BufTextLen;
 }
 
 void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, const char* new_text_end)
@@ -4289,29 +4816,69 @@ void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, cons
     // Grow internal buffer if needed
     const bool is_resizable = (Flags & ImGuiInputTextFlags_CallbackResize) != 0;
     const int new_text_len = new_text_end ? (int)(new_text_end - new_text) : (int)ImStrlen(new_text);
-    if (new_text_len + BufTextLen + 1 > obj->TextA.Size && (Flags & ImGuiInputTextFlags_ReadOnly) == 0)
+    if (Buf == NULL)
     {
-        if (!is_resizable)
-            return;
-
-        IM_ASSERT(Buf == obj->TextA.Data);
-        int new_buf_size = BufTextLen + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1;
-        obj->TextA.resize(new_buf_size + 1);
-        obj->TextSrc = obj->TextA.Data;
-        Buf = obj->TextA.Data;
-        BufSize = obj->BufCapacity = new_buf_size;
+        // ImGuiInputTextFlags_ChunkedText: storage grows as needed, only honor capacity of user buffer
+        IM_ASSERT(obj->TextChunked);
+        if (new_text_len + BufTextLen + 1 > BufSize)
+        {
+            if (!is_resizable)
+                return;
+            BufSize = obj->BufCapacity = new_text_len + BufTextLen + 1;
+        }
+        obj->ChunksInsert(pos, new_text, new_text_len);
     }
+    else
+    {
+        if (new_text_len + BufTextLen + 1 > obj->TextA.Size && (Flags & ImGuiInputTextFlags_ReadOnly) == 0)
+        {
+            if (!is_resizable)
+                return;
 
-    if (BufTextLen != pos)
-        memmove(Buf + pos + new_text_len, Buf + pos, (size_t)(BufTextLen - pos));
-    memcpy(Buf + pos, new_text, (size_t)new_text_len * sizeof(char));
-    Buf[BufTextLen + new_text_len] = '\0';
+            IM_ASSERT(Buf == obj->TextA.Data);
+            int new_buf_size = BufTextLen + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1;
+            obj->TextA.resize(new_buf_size + 1);
+            obj->TextSrc = obj->TextA.Data;
+            Buf = obj->TextA.Data;
+            BufSize = obj->BufCapacity = new_buf_size;
+        }
+
+        if (BufTextLen != pos)
+            memmove(Buf + pos + new_text_len, Buf + pos, (size_t)(BufTextLen - pos));
+        memcpy(Buf + pos, new_text, (size_t)new_text_len * sizeof(char));
+        Buf[BufTextLen + new_text_len] = '\0';
+    }
 
     if (CursorPos >= pos)
         CursorPos += new_text_len;
     SelectionStart = SelectionEnd = CursorPos;
     BufDirty = true;
     BufTextLen += new_text_len;
+    if (obj->CallbackRecordEdits)
+    {
+        obj->UndoCreateRecord(pos, 0, new_text_len);
+        obj->EditRangeAdd(pos, 0, new_text_len);
+        obj->TextLen = BufTextLen;
+        obj->CallbackRecordedEdits++;
+    }
+}
+
+// Read text without copying it. With ImGuiInputTextFlags_ChunkedText, text is split in chunks (at line boundaries) and 'Buf' is NULL:
+//   for (int pos = 0, len; pos < data->BufTextLen; pos += len)
+//       my_rope.append(data->GetTextSpan(pos, &len), len);
+const char* ImGuiInputTextCallbackData::GetTextSpan(int pos, int* out_len) const
+{
+    IM_ASSERT(pos >= 0 && pos <= BufTextLen);
+    IM_ASSERT(EventFlag != ImGuiInputTextFlags_CallbackCharFilter); // No text provided with this event
+    if (Buf != NULL)
+    {
+        *out_len = BufTextLen - pos;
+        return Buf + pos;
+    }
+    const char* span_end;
+    const char* span = Ctx->InputTextState.TextGetSpan(pos, &span_end);
+    *out_len = (int)(span_end - span);
+    return span;
 }
 
 void ImGui::PushPasswordFont()
@@ -4470,16 +5037,16 @@ static void InputTextReconcileUndoState(ImGuiInputTextState* state, const char*
 
     const int insert_len = new_last_diff - first_diff + 1;
     const int delete_len = old_last_diff - first_diff + 1;
-    if (insert_len > 0 || delete_len > 0)
-        if (IMSTB_TEXTEDIT_CHARTYPE* p = stb_text_createundo(&state->Stb->undostate, first_diff, delete_len, insert_len))
-            for (int i = 0; i < delete_len; i++)
-                p[i] = old_buf[first_diff + i];
+    state->EditRangeAdd(first_diff, delete_len, insert_len);
+    if (char* p = state->UndoCreateRecord(first_diff, delete_len, insert_len))
+        memcpy(p, old_buf + first_diff, (size_t)delete_len);
 }
 
 // As InputText() retain textual data and we currently provide a path for user to not retain it (via local variables)
 // we need some form of hook to reapply data back to user buffer on deactivation frame. (#4714)
 // It would be more desirable that we discourage users from taking advantage of the "user not retaining data" trick,
 // but that more likely be attractive when we do have _NoLiveEdit flag available.
+// This is also how ImGuiInputTextFlags_NoLiveEdit writes to user buffer when deactivated by another item.
 void ImGui::InputTextDeactivateHook(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
@@ -4491,6 +5058,12 @@ void ImGui::InputTextDeactivateHook(ImGuiID id)
     {
         g.InputTextDeactivatedState.TextA.resize(0); // In theory this data won't be used, but clear to be neat.
     }
+    else if (state->TextChunked)
+    {
+        g.InputTextDeactivatedState.TextA.resize(state->TextLen + 1);
+        state->TextCopy(g.InputTextDeactivatedState.TextA.Data, 0, state->TextLen);
+        g.InputTextDeactivatedState.TextA[state->TextLen] = 0;
+    }
     else
     {
         IM_ASSERT(state->TextA.Data != 0);
@@ -4605,6 +5178,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     const bool is_password = (flags & ImGuiInputTextFlags_Password) != 0;
     const bool is_undoable = (flags & ImGuiInputTextFlags_NoUndoRedo) == 0;
     const bool is_resizable = (flags & ImGuiInputTextFlags_CallbackResize) != 0;
+    const bool is_chunked = (flags & ImGuiInputTextFlags_ChunkedText) != 0 && is_multiline && !is_readonly;
+    const bool is_no_live_edit = ((flags & ImGuiInputTextFlags_NoLiveEdit) != 0 || is_chunked) && !is_readonly; // 'buf' is not updated while active
     if (is_resizable)
         IM_ASSERT(callback != NULL); // Must provide a callback if you set the ImGuiInputTextFlags_CallbackResize flag!
 
@@ -4627,10 +5202,19 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         int new_len = (int)ImStrlen(buf);
         IM_ASSERT(new_len + 1 <= buf_size && "Is your input buffer properly zero-terminated?");
         state->WantReloadUserBuf = false;
-        InputTextReconcileUndoState(state, state->TextA.Data, state->TextLen, buf, new_len);
-        state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
+        InputTextReconcileUndoState(state, state->TextChunked ? state->TextFlatten() : state->TextA.Data, state->TextLen, buf, new_len);
+        if (state->TextChunked)
+        {
+            state->ChunksReplace(0, state->TextChunks.Size, buf, new_len);
+        }
+        else
+        {
+            state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
+            memcpy(state->TextA.Data, buf, new_len + 1);
+        }
         state->TextLen = new_len;
-        memcpy(state->TextA.Data, buf, state->TextLen + 1);
+        state->LineOffsetsDirty = true;
+        state->EditRangeClear();
         state->Stb->select_start = state->ReloadSelectionStart;
         state->Stb->cursor = state->Stb->select_end = state->ReloadSelectionEnd;
         state->CursorClamp();
@@ -4654,16 +5238,27 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // Preserve cursor position and undo/redo stack if we come back to same widget
         // FIXME: Since we reworked this on 2022/06, may want to differentiate recycle_cursor vs recycle_undostate?
         bool recycle_state = (state->ID == id && !init_changed_specs);
-        if (recycle_state && (state->TextLen != buf_len || (state->TextA.Data == NULL || strncmp(state->TextA.Data, buf, buf_len) != 0)))
+        if (recycle_state && (state->TextChunked ? !state->TextEquals(buf, buf_len) : (state->TextLen != buf_len || (state->TextA.Data == NULL || strncmp(state->TextA.Data, buf, buf_len) != 0))))
             recycle_state = false;
 
         // Start edition
         state->ID = id;
         state->TextLen = buf_len;
-        if (!is_readonly)
+        state->LineOffsetsDirty = true;
+        state->EditRangeClear();
+        state->TextChunked = is_chunked;
+        if (is_chunked)
         {
-            state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
-            memcpy(state->TextA.Data, buf, state->TextLen + 1);
+            state->ChunksReplace(0, state->TextChunks.Size, buf, buf_len);
+        }
+        else
+        {
+            state->ChunksClear();
+            if (!is_readonly)
+            {
+                state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
+                memcpy(state->TextA.Data, buf, state->TextLen + 1);
+            }
         }
 
         // Find initial scroll position for right alignment
@@ -4676,7 +5271,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         if (recycle_state)
             state->CursorClamp();
         else
+        {
             stb_textedit_initialize_state(state->Stb, !is_multiline);
+            state->UndoClear();
+        }
 
         if (!is_multiline)
         {
@@ -4731,12 +5329,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
         // Read-only mode always ever read from source buffer. Refresh TextLen when active.
         if (is_readonly && state != NULL)
+        {
             state->TextLen = (int)ImStrlen(buf);
+            state->LineOffsetsDirty = true;
+        }
         //if (is_readonly && state != NULL)
         //    state->TextA.clear(); // Uncomment to facilitate debugging, but we otherwise prefer to keep/amortize th allocation.
     }
     if (state != NULL)
-        state->TextSrc = is_readonly ? buf : state->TextA.Data;
+        state->TextSrc = is_readonly ? buf : state->TextChunked ? NULL : state->TextA.Data;
 
     // We have an edge case if ActiveId was set through another widget (e.g. widget being swapped), clear id immediately (don't wait until the end of the function)
     if (g.ActiveId == id && state == NULL)
@@ -4754,7 +5355,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
     // Select the buffer to render.
     const bool buf_display_from_state = (render_cursor || render_selection || g.ActiveId == id) && !is_readonly && state;
-    bool is_displaying_hint = (hint != NULL && (buf_display_from_state ? state->TextA.Data : buf)[0] == 0);
+    bool is_displaying_hint = (hint != NULL && (buf_display_from_state ? state->TextGetChar(0) : buf[0]) == 0);
 
     // Password pushes a temporary font with only a fallback glyph
     if (is_password && !is_displaying_hint)
@@ -4958,7 +5559,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             if (flags & ImGuiInputTextFlags_EscapeClearsAll)
             {
-                if (buf[0] != 0)
+                if (is_no_live_edit ? state->TextLen > 0 : buf[0] != 0)
                 {
                     revert_edit = true;
                 }
@@ -4993,7 +5594,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 const int ib = state->HasSelection() ? ImMin(state->Stb->select_start, state->Stb->select_end) : 0;
                 const int ie = state->HasSelection() ? ImMax(state->Stb->select_start, state->Stb->select_end) : state->TextLen;
                 g.TempBuffer.reserve(ie - ib + 1);
-                memcpy(g.TempBuffer.Data, state->TextSrc + ib, ie - ib);
+                state->TextCopy(g.TempBuffer.Data, ib, ie - ib);
                 g.TempBuffer.Data[ie - ib] = 0;
                 SetClipboardText(g.TempBuffer.Data);
             }
@@ -5029,7 +5630,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 if (clipboard_filtered.Size > 0) // If everything was filtered, ignore the pasting operation
                 {
                     clipboard_filtered.push_back(0);
+                    state->UndoGroupBegin(); // Pasting over a selection is undone in one step
                     stb_textedit_paste(state, state->Stb, clipboard_filtered.Data, clipboard_filtered.Size - 1);
+                    state->UndoGroupEnd();
                     state->CursorFollow = true;
                 }
             }
@@ -5050,14 +5653,14 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             if (flags & ImGuiInputTextFlags_EscapeClearsAll)
             {
                 // Clear input
-                IM_ASSERT(buf[0] != 0);
+                IM_ASSERT(is_no_live_edit || buf[0] != 0);
                 apply_new_text = "";
                 apply_new_text_length = 0;
                 value_changed = true;
                 IMSTB_TEXTEDIT_CHARTYPE empty_string;
                 stb_textedit_replace(state, state->Stb, &empty_string, 0);
             }
-            else if (strcmp(buf, state->TextToRevertTo.Data) != 0)
+            else if (is_no_live_edit ? !state->TextEquals(state->TextToRevertTo.Data, state->TextToRevertTo.Size - 1) : strcmp(buf, state->TextToRevertTo.Data) != 0)
             {
                 apply_new_text = state->TextToRevertTo.Data;
                 apply_new_text_length = state->TextToRevertTo.Size - 1;
@@ -5121,11 +5724,24 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     callback_data.Flags = flags;
                     callback_data.UserData = callback_user_data;
 
-                    // FIXME-OPT: Undo stack reconcile needs a backup of the data until we rework API, see #7925
-                    char* callback_buf = is_readonly ? buf : state->TextA.Data;
+                    // Undo stack reconcile needs a backup of the data in case user modifies Buf[] directly, see #7925.
+                    // We don't make one for large text or chunked text (Buf == NULL): InsertChars()/DeleteChars() record their edits instead.
+                    char* callback_buf = is_readonly ? buf : state->TextChunked ? NULL : state->TextA.Data;
                     IM_ASSERT(callback_buf == state->TextSrc);
-                    state->CallbackTextBackup.resize(state->TextLen + 1);
-                    memcpy(state->CallbackTextBackup.Data, callback_buf, state->TextLen + 1);
+                    const bool callback_has_backup = (callback_buf != NULL && state->TextLen <= IMGUI_INPUTTEXT_UNDO_MAX_BYTES);
+                    if (callback_has_backup)
+                    {
+                        state->CallbackTextBackup.resize(state->TextLen + 1);
+                        memcpy(state->CallbackTextBackup.Data, callback_buf, state->TextLen + 1);
+                    }
+                    else
+                    {
+                        state->CallbackTextBackup.clear();
+                    }
+                    state->CallbackRecordEdits = !callback_has_backup && !is_readonly;
+                    state->CallbackRecordedEdits = 0;
+                    if (state->CallbackRecordEdits)
+                        state->UndoGroupBegin(); // Edits made by InsertChars()/DeleteChars() are undone in one step
 
                     callback_data.EventKey = event_key;
                     callback_data.Buf = callback_buf;
@@ -5136,12 +5752,20 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     const int utf8_cursor_pos = callback_data.CursorPos = state->Stb->cursor;
                     const int utf8_selection_start = callback_data.SelectionStart = state->Stb->select_start;
                     const int utf8_selection_end = callback_data.SelectionEnd = state->Stb->select_end;
+                    if (event_flag == ImGuiInputTextFlags_CallbackEdit)
+                    {
+                        callback_data.EditPos = state->EditRangeStart;
+                        callback_data.EditNewLen = state->EditRangeEnd - state->EditRangeStart;
+                        callback_data.EditOldLen = callback_data.EditNewLen - state->EditRangeDelta;
+                    }
 
                     // Call user code
                     callback(&callback_data);
+                    state->CallbackRecordEdits = false;
+                    state->UndoGroupEnd();
 
                     // Read back what user may have modified
-                    callback_buf = is_readonly ? buf : state->TextA.Data; // Pointer may have been invalidated by a resize callback
+                    callback_buf = is_readonly ? buf : state->TextChunked ? NULL : state->TextA.Data; // Pointer may have been invalidated by a resize callback
                     IM_ASSERT(callback_data.Buf == callback_buf);         // Invalid to modify those fields
                     IM_ASSERT(callback_data.BufSize == state->BufCapacity);
                     IM_ASSERT(callback_data.Flags == flags);
@@ -5152,28 +5776,59 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     if (buf_dirty)
                     {
                         // Callback may update buffer and thus set buf_dirty even in read-only mode.
-                        IM_ASSERT(callback_data.BufTextLen == (int)ImStrlen(callback_data.Buf)); // You need to maintain BufTextLen if you change the text!
-                        InputTextReconcileUndoState(state, state->CallbackTextBackup.Data, state->CallbackTextBackup.Size - 1, callback_data.Buf, callback_data.BufTextLen);
+                        IM_ASSERT(callback_data.Buf == NULL || callback_data.BufTextLen == (int)ImStrlen(callback_data.Buf)); // You need to maintain BufTextLen if you change the text!
+                        if (callback_has_backup)
+                        {
+                            InputTextReconcileUndoState(state, state->CallbackTextBackup.Data, state->CallbackTextBackup.Size - 1, callback_data.Buf, callback_data.BufTextLen);
+                        }
+                        else
+                        {
+                            // Large text: edits made with InsertChars()/DeleteChars() are already recorded, and keep state->TextLen in sync.
+                            // If Buf[] was written directly (even keeping the same length), we can't reconcile undo stack.
+                            const bool all_edits_recorded = (state->CallbackRecordedEdits > 0 && callback_data.BufTextLen == state->TextLen);
+                            if (!all_edits_recorded)
+                            {
+                                state->UndoClear();
+                                state->EditRangeAdd(0, state->TextLen, callback_data.BufTextLen);
+                            }
+                        }
                         state->TextLen = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        state->LineOffsetsDirty = true;
                         state->CursorAnimReset();
                     }
+
+                    // Changes made by the Edit callback itself are not reported to it
+                    if (event_flag == ImGuiInputTextFlags_CallbackEdit)
+                        state->EditRangeClear();
                 }
             }
 
             // Will copy result string if modified
-            if (!is_readonly && strcmp(state->TextSrc, buf) != 0)
+            // With ImGuiInputTextFlags_NoLiveEdit, only report the edit: 'buf' is written when deactivating or validating (or on next frame, see InputTextDeactivateHook()).
+            if (is_no_live_edit && !clear_active_id && !validated)
             {
-                apply_new_text = state->TextSrc;
-                apply_new_text_length = state->TextLen;
-                value_changed = true;
+                if (state->Edited)
+                    value_changed = true;
+            }
+            else if (!is_readonly)
+            {
+                const char* text = state->TextFlatten(); // Copy chunks into TextA with ImGuiInputTextFlags_ChunkedText (implies NoLiveEdit: only when deactivating or validating)
+                if (strcmp(text, buf) != 0)
+                {
+                    apply_new_text = text;
+                    apply_new_text_length = state->TextLen;
+                    value_changed = true;
+                }
             }
         }
     }
 
     // Handle reapplying final data on deactivation (see InputTextDeactivateHook() for details)
+    // (not using IsItemDeactivatedAfterEdit() as in multi-line mode LastItemData is currently the child window's)
     if (g.InputTextDeactivatedState.ID == id)
     {
-        if (g.ActiveId != id && IsItemDeactivatedAfterEdit() && !is_readonly && strcmp(g.InputTextDeactivatedState.TextA.Data, buf) != 0)
+        const bool deactivated_after_edit = (g.DeactivatedItemData.ID == id && g.DeactivatedItemData.ElapseFrame >= g.FrameCount && g.DeactivatedItemData.HasBeenEditedBefore);
+        if (g.ActiveId != id && deactivated_after_edit && !is_readonly && strcmp(g.InputTextDeactivatedState.TextA.Data, buf) != 0)
         {
             apply_new_text = g.InputTextDeactivatedState.TextA.Data;
             apply_new_text_length = g.InputTextDeactivatedState.TextA.Size - 1;
@@ -5232,12 +5887,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     // without any carriage return, which would makes ImFont::RenderText() reserve too many vertices and probably crash. Avoid it altogether.
     // Note that we only use this limit on single-line InputText(), so a pathologically large line on a InputTextMultiline() would still crash.
     const int buf_display_max_length = 2 * 1024 * 1024;
-    const char* buf_display = buf_display_from_state ? state->TextA.Data : buf; //-V595
+    const char* buf_display = buf_display_from_state ? state->TextSrc : buf; //-V595 // NULL with ImGuiInputTextFlags_ChunkedText: read from state->TextGetSpan()
     const char* buf_display_end = NULL; // We have specialized paths below for setting the length
 
     // Display hint when contents is empty
     // At this point we need to handle the possibility that a callback could have modified the underlying buffer (#8368)
-    const bool new_is_displaying_hint = (hint != NULL && (buf_display_from_state ? state->TextA.Data : buf)[0] == 0);
+    const bool new_is_displaying_hint = (hint != NULL && (buf_display_from_state ? state->TextGetChar(0) : buf[0]) == 0);
     if (new_is_displaying_hint != is_displaying_hint)
     {
         if (is_password && !is_displaying_hint)
@@ -5257,7 +5912,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     if (render_cursor || render_selection)
     {
         IM_ASSERT(state != NULL);
-        if (!is_displaying_hint)
+        if (!is_displaying_hint && buf_display != NULL)
             buf_display_end = buf_display + state->TextLen;
 
         // Render text (with cursor and selection)
@@ -5268,26 +5923,26 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // We are attempting to do most of that in **one main pass** to minimize the computation cost (non-negligible for large amount of text) + 2nd pass for selection rendering (we could merge them by an extra refactoring effort)
         // FIXME: This should occur on buf_display but we'd need to maintain cursor/select_start/select_end for UTF-8.
         const char* text_begin = buf_display;
-        const char* text_end = text_begin + state->TextLen;
         ImVec2 cursor_offset, select_start_offset;
 
         {
             // Find lines numbers straddling cursor and selection min position
             int cursor_line_no = render_cursor ? -1 : -1000;
             int selmin_line_no = render_selection ? -1 : -1000;
-            const char* cursor_ptr = render_cursor ? text_begin + state->Stb->cursor : NULL;
-            const char* selmin_ptr = render_selection ? text_begin + ImMin(state->Stb->select_start, state->Stb->select_end) : NULL;
+            const int selmin_pos = ImMin(state->Stb->select_start, state->Stb->select_end);
+            const char* cursor_ptr = (render_cursor && !is_multiline) ? text_begin + state->Stb->cursor : NULL;
+            const char* selmin_ptr = (render_selection && !is_multiline) ? text_begin + selmin_pos : NULL;
 
-            // Count lines and find line number for cursor and selection ends
+            // Count lines and find line number for cursor and selection ends, using line index (maintained incrementally on edits)
             int line_count = 1;
             if (is_multiline)
             {
-                for (const char* s = text_begin; (s = (const char*)ImMemchr(s, '\n', (size_t)(text_end - s))) != NULL; s++)
-                {
-                    if (cursor_line_no == -1 && s >= cursor_ptr) { cursor_line_no = line_count; }
-                    if (selmin_line_no == -1 && s >= selmin_ptr) { selmin_line_no = line_count; }
-                    line_count++;
-                }
+                state->LineIndexUpdate();
+                line_count = state->LineOffsets.Size;
+                if (render_cursor)
+                    cursor_line_no = state->LineIndexFindLine(state->Stb->cursor) + 1;
+                if (render_selection)
+                    selmin_line_no = state->LineIndexFindLine(selmin_pos) + 1;
             }
             if (cursor_line_no == -1)
                 cursor_line_no = line_count;
@@ -5295,11 +5950,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 selmin_line_no = line_count;
 
             // Calculate 2d position by finding the beginning of the line and measuring distance
-            cursor_offset.x = InputTextCalcTextSize(&g, ImStrbol(cursor_ptr, text_begin), cursor_ptr).x;
+            if (render_cursor)
+                cursor_offset.x = is_multiline ? InputTextCalcLineOffsetX(state, state->LineOffsets[cursor_line_no - 1], state->Stb->cursor) : InputTextCalcTextSize(&g, ImStrbol(cursor_ptr, text_begin), cursor_ptr).x;
             cursor_offset.y = cursor_line_no * g.FontSize;
             if (selmin_line_no >= 0)
             {
-                select_start_offset.x = InputTextCalcTextSize(&g, ImStrbol(selmin_ptr, text_begin), selmin_ptr).x;
+                select_start_offset.x = is_multiline ? InputTextCalcLineOffsetX(state, state->LineOffsets[selmin_line_no - 1], selmin_pos) : InputTextCalcTextSize(&g, ImStrbol(selmin_ptr, text_begin), selmin_ptr).x;
                 select_start_offset.y = selmin_line_no * g.FontSize;
             }
 
@@ -5347,42 +6003,83 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         const ImVec2 draw_scroll = ImVec2(state->Scroll.x, 0.0f);
         if (render_selection)
         {
-            const char* text_selected_begin = text_begin + ImMin(state->Stb->select_start, state->Stb->select_end);
-            const char* text_selected_end = text_begin + ImMax(state->Stb->select_start, state->Stb->select_end);
+            const int text_selected_begin = ImMin(state->Stb->select_start, state->Stb->select_end);
+            const int text_selected_end = ImMax(state->Stb->select_start, state->Stb->select_end);
 
             ImU32 bg_color = GetColorU32(ImGuiCol_TextSelectedBg, render_cursor ? 1.0f : 0.6f); // FIXME: current code flow mandate that render_cursor is always true here, we are leaving the transparent one for tests.
             float bg_offy_up = is_multiline ? 0.0f : -1.0f;    // FIXME: those offsets should be part of the style? they don't play so well with multi-line selection.
             float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
             ImVec2 rect_pos = draw_pos + select_start_offset - draw_scroll;
-            for (const char* p = text_selected_begin; p < text_selected_end; )
+            int p_pos = text_selected_begin;
+            if (is_multiline)
             {
-                if (rect_pos.y > clip_rect.w + g.FontSize)
-                    break;
-                if (rect_pos.y < clip_rect.y)
+                // Skip selected lines above clipping rectangle using line index
+                const int line_first_visible = ImMin((int)((clip_rect.y - draw_pos.y) / g.FontSize) - 1, state->LineOffsets.Size - 1);
+                if (line_first_visible > state->LineIndexFindLine(text_selected_begin))
                 {
-                    p = (const char*)ImMemchr((void*)p, '\n', text_selected_end - p);
-                    p = p ? p + 1 : text_selected_end;
+                    p_pos = ImMin(state->LineOffsets[line_first_visible], text_selected_end);
+                    rect_pos = ImVec2(draw_pos.x - draw_scroll.x, draw_pos.y + (line_first_visible + 1) * g.FontSize);
                 }
-                else
+            }
+
+            // Iterate contiguous spans of text (a single one, unless using ImGuiInputTextFlags_ChunkedText which never splits a line)
+            while (p_pos < text_selected_end && rect_pos.y <= clip_rect.w + g.FontSize)
+            {
+                const char* span_end;
+                const char* span = state->TextGetSpan(p_pos, &span_end);
+                span_end = ImMin(span_end, span + (text_selected_end - p_pos));
+                const char* p = span;
+                while (p < span_end)
                 {
-                    ImVec2 rect_size = InputTextCalcTextSize(&g, p, text_selected_end, &p, NULL, true);
-                    if (rect_size.x <= 0.0f) rect_size.x = IM_TRUNC(g.FontBaked->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
-                    ImRect rect(rect_pos + ImVec2(0.0f, bg_offy_up - g.FontSize), rect_pos + ImVec2(rect_size.x, bg_offy_dn));
-                    rect.ClipWith(clip_rect);
-                    if (rect.Overlaps(clip_rect))
-                        draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
-                    rect_pos.x = draw_pos.x - draw_scroll.x;
+                    if (rect_pos.y > clip_rect.w + g.FontSize)
+                        break;
+                    if (rect_pos.y < clip_rect.y)
+                    {
+                        p = (const char*)ImMemchr((void*)p, '\n', span_end - p);
+                        p = p ? p + 1 : span_end;
+                    }
+                    else
+                    {
+                        ImVec2 rect_size = InputTextCalcTextSize(&g, p, span_end, &p, NULL, true);
+                        if (rect_size.x <= 0.0f) rect_size.x = IM_TRUNC(g.FontBaked->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
+                        ImRect rect(rect_pos + ImVec2(0.0f, bg_offy_up - g.FontSize), rect_pos + ImVec2(rect_size.x, bg_offy_dn));
+                        rect.ClipWith(clip_rect);
+                        if (rect.Overlaps(clip_rect))
+                            draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
+                        rect_pos.x = draw_pos.x - draw_scroll.x;
+                    }
+                    rect_pos.y += g.FontSize;
                 }
-                rect_pos.y += g.FontSize;
+                p_pos += (int)(p - span);
             }
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        // FIXME-OPT: Multiline could submit a smaller amount of contents to AddText() since we already iterated through it.
+        // Multiline only submits visible lines to AddText(), using line index.
         if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
-            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
+            const ImVec2 text_visible_pos = draw_pos - draw_scroll;
+            if (is_multiline && !is_displaying_hint)
+            {
+                // Submit visible lines, one contiguous span of text at a time (a single one, unless using ImGuiInputTextFlags_ChunkedText which never splits a line)
+                const int line_min = ImClamp((int)((clip_rect.y - draw_pos.y) / g.FontSize) - 1, 0, state->LineOffsets.Size - 1);
+                const int line_max = ImClamp((int)((clip_rect.w - draw_pos.y) / g.FontSize) + 1, line_min, state->LineOffsets.Size - 1);
+                const int text_visible_end = (line_max + 1 < state->LineOffsets.Size) ? state->LineOffsets[line_max + 1] : state->TextLen;
+                for (int pos = state->LineOffsets[line_min]; pos < text_visible_end; )
+                {
+                    const char* span_end;
+                    const char* span = state->TextGetSpan(pos, &span_end);
+                    span_end = ImMin(span_end, span + (text_visible_end - pos));
+                    const ImVec2 span_pos(text_visible_pos.x, text_visible_pos.y + state->LineIndexFindLine(pos) * g.FontSize);
+                    draw_window->DrawList->AddText(g.Font, g.FontSize, span_pos, col, span, span_end);
+                    pos += (int)(span_end - span);
+                }
+            }
+            else
+            {
+                draw_window->DrawList->AddText(g.Font, g.FontSize, text_visible_pos, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
+            }
         }
 
         // Draw blinking cursor
@@ -5412,6 +6109,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     else
     {
         // Render text only (no selection, no cursor)
+        if (buf_display == NULL) // ImGuiInputTextFlags_ChunkedText on the deactivating frame
+            buf_display = state->TextFlatten();
         if (is_multiline)
             text_size = ImVec2(inner_size.x, InputTextCalcTextLenAndLineCount(buf_display, &buf_display_end) * g.FontSize); // We don't need width
         else if (!is_displaying_hint && g.ActiveId == id)
@@ -5458,6 +6157,11 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     // Log as text
     if (g.LogEnabled && (!is_password || is_displaying_hint))
     {
+        if (buf_display == NULL) // ImGuiInputTextFlags_ChunkedText
+        {
+            buf_display = state->TextFlatten();
+            buf_display_end = buf_display + state->TextLen;
+        }
         LogSetNextTextDecoration("{", "}");
         LogRenderedText(&draw_pos, buf_display, buf_display_end);
     }
@@ -5480,30 +6184,30 @@ void ImGui::DebugNodeInputTextState(ImGuiInputTextState* state)
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     ImGuiContext& g = *GImGui;
     ImStb::STB_TexteditState* stb_state = state->Stb;
-    ImStb::StbUndoState* undo_state = &stb_state->undostate;
     Text("ID: 0x%08X, ActiveID: 0x%08X", state->ID, g.ActiveId);
     DebugLocateItemOnHover(state->ID);
     Text("CurLenA: %d, Cursor: %d, Selection: %d..%d", state->TextLen, stb_state->cursor, stb_state->select_start, stb_state->select_end);
     Text("BufCapacity: %d", state->BufCapacity);
     Text("(Internal Buffer: TextA Size: %d, Capacity: %d)", state->TextA.Size, state->TextA.Capacity);
+    if (state->TextChunked)
+        Text("(Chunked Text: %d chunks)", state->TextChunks.Size);
     Text("has_preferred_x: %d (%.2f)", stb_state->has_preferred_x, stb_state->preferred_x);
-    Text("undo_point: %d, redo_point: %d, undo_char_point: %d, redo_char_point: %d", undo_state->undo_point, undo_state->redo_point, undo_state->undo_char_point, undo_state->redo_char_point);
+    Text("UndoStack: %d records, RedoStack: %d records, %d bytes", state->UndoStack.GetRecordsCount(), state->RedoStack.GetRecordsCount(), (int)(state->UndoStack.GetMemoryBytes() + state->RedoStack.GetMemoryBytes()));
     if (BeginChild("undopoints", ImVec2(0.0f, GetTextLineHeight() * 10), ImGuiChildFlags_Borders | ImGuiChildFlags_ResizeY)) // Visualize undo state
     {
+        // Undo records oldest first, then redo records next first
         PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
-        for (int n = 0; n < IMSTB_TEXTEDIT_UNDOSTATECOUNT; n++)
-        {
-            ImStb::StbUndoRecord* undo_rec = &undo_state->undo_rec[n];
-            const char undo_rec_type = (n < undo_state->undo_point) ? 'u' : (n >= undo_state->redo_point) ? 'r' : ' ';
-            if (undo_rec_type == ' ')
-                BeginDisabled();
-            const int buf_preview_len = (undo_rec_type != ' ' && undo_rec->char_storage != -1) ? undo_rec->insert_length : 0;
-            const char* buf_preview_str = undo_state->undo_char + undo_rec->char_storage;
-            Text("%c [%02d] where %03d, insert %03d, delete %03d, char_storage %03d \"%.*s\"",
-                undo_rec_type, n, undo_rec->where, undo_rec->insert_length, undo_rec->delete_length, undo_rec->char_storage, buf_preview_len, buf_preview_str);
-            if (undo_rec_type == ' ')
-                EndDisabled();
-        }
+        const int undo_count = state->UndoStack.GetRecordsCount();
+        ImGuiListClipper clipper;
+        clipper.Begin(undo_count + state->RedoStack.GetRecordsCount());
+        while (clipper.Step())
+            for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+            {
+                const ImGuiInputTextUndoStack* stack = (n < undo_count) ? &state->UndoStack : &state->RedoStack;
+                const ImGuiInputTextUndoRecord* rec = (n < undo_count) ? &stack->Records[stack->RecordsHead + n] : &stack->Records[stack->Records.Size - 1 - (n - undo_count)];
+                Text("%c%c[%02d] where %03d, insert %03d, delete %03d, coalesce %d \"%.*s\"",
+                    (n < undo_count) ? 'u' : 'r', rec->GroupWithPrevious ? '+' : ' ', n, rec->Where, rec->InsertLen, rec->DeleteLen, rec->CoalesceKind, ImMin(rec->InsertLen, 64), stack->Chars.Data + rec->CharsOffset);
+            }
         PopStyleVar();
     }
     EndChild();
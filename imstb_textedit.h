@@ -5,6 +5,8 @@
 // - Fix in stb_textedit_find_charpos to handle last line (see https://github.com/ocornut/imgui/issues/6000 + #6783)
 // - Added name to struct or it may be forward declared in our code.
 // - Added UTF-8 support (see https://github.com/nothings/stb/issues/188 + https://github.com/ocornut/imgui/pull/7925)
+// - Added optional IMSTB_TEXTEDIT_FINDROW_Y/IMSTB_TEXTEDIT_FINDROW_CHAR to skip rows without laying them out (large multi-line text).
+// - Added optional IMSTB_TEXTEDIT_CUSTOM_UNDO to let the application store undo/redo records (no fixed-size buffer).
 // Grep for [DEAR IMGUI] to find the changes.
 // - Also renamed macros used or defined outside of IMSTB_TEXTEDIT_IMPLEMENTATION block from STB_TEXTEDIT_* to IMSTB_TEXTEDIT_*
 
@@ -318,6 +320,9 @@
 #define IMSTB_TEXTEDIT_POSITIONTYPE    int
 #endif
 
+// [DEAR IMGUI] Added IMSTB_TEXTEDIT_CUSTOM_UNDO: stb_text_undo(), stb_text_redo() and stb_text_makeundo_XXX() functions
+// are provided by the application, which stores its own undo state. StbUndoState is not used.
+#ifndef IMSTB_TEXTEDIT_CUSTOM_UNDO
 typedef struct
 {
    // private data
@@ -335,6 +340,7 @@ typedef struct
    short undo_point, redo_point;
    int undo_char_point, redo_char_point;
 } StbUndoState;
+#endif // [DEAR IMGUI]
 
 typedef struct STB_TexteditState
 {
@@ -371,7 +377,9 @@ typedef struct STB_TexteditState
    unsigned char single_line;
    unsigned char padding1, padding2, padding3;
    float preferred_x; // this determines where the cursor up/down tries to seek to along x
+#ifndef IMSTB_TEXTEDIT_CUSTOM_UNDO // [DEAR IMGUI]
    StbUndoState undostate;
+#endif
 } STB_TexteditState;
 
 
@@ -438,6 +446,11 @@ static int stb_text_locate_coord(IMSTB_TEXTEDIT_STRING *str, float x, float y)
    r.ymin = r.ymax = 0;
    r.num_chars = 0;
 
+   // [DEAR IMGUI] skip rows above 'y' when the application can locate rows directly
+#ifdef IMSTB_TEXTEDIT_FINDROW_Y
+   IMSTB_TEXTEDIT_FINDROW_Y(str, y, &i, &base_y);
+#endif
+
    // search rows to find one that straddles 'y'
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -534,7 +547,7 @@ static void stb_textedit_drag(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *sta
 static void stb_text_undo(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state);
 static void stb_text_redo(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state);
 static void stb_text_makeundo_delete(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state, int where, int length);
-static void stb_text_makeundo_insert(STB_TexteditState *state, int where, int length);
+static void stb_text_makeundo_insert(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state, int where, int length); // [DEAR IMGUI] Added 'str' parameter
 static void stb_text_makeundo_replace(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state, int where, int old_length, int new_length);
 
 typedef struct
@@ -568,6 +581,11 @@ static void stb_textedit_find_charpos(StbFindState *find, IMSTB_TEXTEDIT_STRING
    // search rows to find the one that straddles character n
    find->y = 0;
 
+   // [DEAR IMGUI] skip rows before the one preceding character n when the application can locate rows directly
+#ifdef IMSTB_TEXTEDIT_FINDROW_CHAR
+   IMSTB_TEXTEDIT_FINDROW_CHAR(str, n, &i, &prev_start, &find->y);
+#endif
+
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
       if (n < i + r.num_chars)
@@ -735,7 +753,7 @@ static int stb_textedit_paste_internal(IMSTB_TEXTEDIT_STRING *str, STB_TexteditS
    stb_textedit_delete_selection(str,state);
    // try to insert the characters
    if (STB_TEXTEDIT_INSERTCHARS(str, state->cursor, text, len)) {
-      stb_text_makeundo_insert(state, state->cursor, len);
+      stb_text_makeundo_insert(str, state, state->cursor, len);
       state->cursor += len;
       state->has_preferred_x = 0;
       return 1;
@@ -766,7 +784,7 @@ static void stb_textedit_text(IMSTB_TEXTEDIT_STRING* str, STB_TexteditState* sta
    } else {
       stb_textedit_delete_selection(str, state); // implicitly clamps
       if (STB_TEXTEDIT_INSERTCHARS(str, state->cursor, text, text_len)) {
-         stb_text_makeundo_insert(state, state->cursor, text_len);
+         stb_text_makeundo_insert(str, state, state->cursor, text_len);
          state->cursor += text_len;
          state->has_preferred_x = 0;
       }
@@ -1158,6 +1176,7 @@ retry:
 //
 // @OPTIMIZE: the undo/redo buffer should be circular
 
+#ifndef IMSTB_TEXTEDIT_CUSTOM_UNDO // [DEAR IMGUI]
 static void stb_textedit_flush_redo(StbUndoState *state)
 {
    state->redo_point = IMSTB_TEXTEDIT_UNDOSTATECOUNT;
@@ -1380,8 +1399,9 @@ static void stb_text_redo(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state)
    s->redo_point++;
 }
 
-static void stb_text_makeundo_insert(STB_TexteditState *state, int where, int length)
+static void stb_text_makeundo_insert(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state, int where, int length)
 {
+   (void)str;
    stb_text_createundo(&state->undostate, where, 0, length);
 }
 
@@ -1404,14 +1424,17 @@ static void stb_text_makeundo_replace(IMSTB_TEXTEDIT_STRING *str, STB_TexteditSt
          p[i] = STB_TEXTEDIT_GETCHAR(str, where+i);
    }
 }
+#endif // [DEAR IMGUI] IMSTB_TEXTEDIT_CUSTOM_UNDO
 
 // reset the state to default
 static void stb_textedit_clear_state(STB_TexteditState *state, int is_single_line)
 {
+#ifndef IMSTB_TEXTEDIT_CUSTOM_UNDO // [DEAR IMGUI]
    state->undostate.undo_point = 0;
    state->undostate.undo_char_point = 0;
    state->undostate.redo_point = IMSTB_TEXTEDIT_UNDOSTATECOUNT;
    state->undostate.redo_char_point = IMSTB_TEXTEDIT_UNDOCHARCOUNT;
+#endif
    state->select_end = state->select_start = 0;
    state->cursor = 0;
    state->has_preferred_x = 0;
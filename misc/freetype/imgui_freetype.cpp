@@ -260,9 +260,11 @@ static const FT_Glyph_Metrics* ImGui_ImplFreeType_LoadGlyph(ImGui_ImplFreeType_F
     return &slot->metrics;
 }
 
-static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, uint32_t* dst, uint32_t dst_pitch)
+// Blit into either an Alpha8 or RGBA32 destination, e.g. straight into the atlas texture. 'dst_pitch' is in bytes.
+static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, unsigned char* dst, int dst_pitch, ImTextureFormat dst_fmt)
 {
     IM_ASSERT(ft_bitmap != nullptr);
+    IM_ASSERT(dst_fmt == ImTextureFormat_Alpha8 || dst_fmt == ImTextureFormat_RGBA32);
     const uint32_t w = ft_bitmap->width;
     const uint32_t h = ft_bitmap->rows;
     const uint8_t* src = ft_bitmap->buffer;
@@ -272,9 +274,13 @@ static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, uint32_t* d
     {
     case FT_PIXEL_MODE_GRAY: // Grayscale image, 1 byte per pixel.
         {
-            for (uint32_t y = 0; y < h; y++, src += src_pitch, dst += dst_pitch)
-                for (uint32_t x = 0; x < w; x++)
-                    dst[x] = IM_COL32(255, 255, 255, src[x]);
+            if (dst_fmt == ImTextureFormat_Alpha8)
+                for (uint32_t y = 0; y < h; y++, src += src_pitch, dst += dst_pitch)
+                    memcpy(dst, src, w);
+            else
+                for (uint32_t y = 0; y < h; y++, src += src_pitch, dst += dst_pitch)
+                    for (uint32_t x = 0; x < w; x++)
+                        ((uint32_t*)(void*)dst)[x] = IM_COL32(255, 255, 255, src[x]);
             break;
         }
     case FT_PIXEL_MODE_MONO: // Monochrome image, 1 bit per pixel. The bits in each byte are ordered from MSB to LSB.
@@ -287,7 +293,10 @@ static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, uint32_t* d
                 {
                     if ((x & 7) == 0)
                         bits = *bits_ptr++;
-                    dst[x] = IM_COL32(255, 255, 255, (bits & 0x80) ? 255 : 0);
+                    if (dst_fmt == ImTextureFormat_Alpha8)
+                        dst[x] = (bits & 0x80) ? 255 : 0;
+                    else
+                        ((uint32_t*)(void*)dst)[x] = IM_COL32(255, 255, 255, (bits & 0x80) ? 255 : 0);
                 }
             }
             break;
@@ -300,7 +309,10 @@ static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, uint32_t* d
                 for (uint32_t x = 0; x < w; x++)
                 {
                     uint8_t r = src[x * 4 + 2], g = src[x * 4 + 1], b = src[x * 4], a = src[x * 4 + 3];
-                    dst[x] = IM_COL32(DE_MULTIPLY(r, a), DE_MULTIPLY(g, a), DE_MULTIPLY(b, a), a);
+                    if (dst_fmt == ImTextureFormat_Alpha8)
+                        dst[x] = a;
+                    else
+                        ((uint32_t*)(void*)dst)[x] = IM_COL32(DE_MULTIPLY(r, a), DE_MULTIPLY(g, a), DE_MULTIPLY(b, a), a);
                 }
             #undef DE_MULTIPLY
             break;
@@ -475,12 +487,13 @@ void ImGui_ImplFreeType_FontBakedDestroy(ImFontAtlas* atlas, ImFontConfig* src,
     bd_baked_data->~ImGui_ImplFreeType_FontSrcBakedData(); // ~IM_PLACEMENT_DELETE()
 }
 
-bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+// Load and render glyph, fill glyph metrics. Returned bitmap is owned by FreeType and valid until next glyph is loaded from same source.
+static const FT_Bitmap* ImGui_ImplFreeType_RenderGlyph(ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph)
 {
     ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
     uint32_t glyph_index = FT_Get_Char_Index(bd_font_data->FtFace, codepoint);
     if (glyph_index == 0)
-        return false;
+        return nullptr;
 
     if (bd_font_data->BakedLastActivated != baked) // <-- could use id
     {
@@ -492,27 +505,18 @@ bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src
 
     const FT_Glyph_Metrics* metrics = ImGui_ImplFreeType_LoadGlyph(bd_font_data, codepoint);
     if (metrics == nullptr)
-        return false;
+        return nullptr;
 
     FT_Face face = bd_font_data->FtFace;
     FT_GlyphSlot slot = face->glyph;
     const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
 
-    // Load metrics only mode
-    const float advance_x = (slot->advance.x / FT_SCALEFACTOR) / rasterizer_density;
-    if (out_advance_x != NULL)
-    {
-        IM_ASSERT(out_glyph == NULL);
-        *out_advance_x = advance_x;
-        return true;
-    }
-
     // Render glyph into a bitmap (currently held by FreeType)
     FT_Render_Mode render_mode = (bd_font_data->UserFlags & ImGuiFreeTypeLoaderFlags_Monochrome) ? FT_RENDER_MODE_MONO : FT_RENDER_MODE_NORMAL;
     FT_Error error = FT_Render_Glyph(slot, render_mode);
     const FT_Bitmap* ft_bitmap = &slot->bitmap;
     if (error != 0 || ft_bitmap == nullptr)
-        return false;
+        return nullptr;
 
     const int w = (int)ft_bitmap->width;
     const int h = (int)ft_bitmap->rows;
@@ -520,25 +524,10 @@ bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src
 
     // Prepare glyph
     out_glyph->Codepoint = codepoint;
-    out_glyph->AdvanceX = advance_x;
+    out_glyph->AdvanceX = (slot->advance.x / FT_SCALEFACTOR) / rasterizer_density;
 
-    // Pack and retrieve position inside texture atlas
     if (is_visible)
     {
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
-        if (pack_id == ImFontAtlasRectId_Invalid)
-        {
-            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
-            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
-            return false;
-        }
-        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
-
-        // Render pixels to our temporary buffer
-        atlas->Builder->TempBuffer.resize(w * h * 4);
-        uint32_t* temp_buffer = (uint32_t*)atlas->Builder->TempBuffer.Data;
-        ImGui_ImplFreeType_BlitGlyph(ft_bitmap, temp_buffer, w);
-
         const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
         const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
         float font_off_x = (src->GlyphOffset.x * offsets_scale);
@@ -559,8 +548,81 @@ bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src
         out_glyph->Y1 = (glyph_off_y + h) * recip_v + font_off_y;
         out_glyph->Visible = true;
         out_glyph->Colored = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_BGRA);
+    }
+
+    return ft_bitmap;
+}
+
+bool ImGui_ImplFreeType_FontBakedRasterizeGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, ImFontAtlasGlyphBitmap* out_bitmap, ImVector<unsigned char>* out_pixels)
+{
+    IM_UNUSED(atlas);
+    const FT_Bitmap* ft_bitmap = ImGui_ImplFreeType_RenderGlyph(src, baked, loader_data_for_baked_src, codepoint, out_glyph);
+    if (ft_bitmap == nullptr)
+        return false;
+
+    out_bitmap->Format = out_glyph->Colored ? ImTextureFormat_RGBA32 : ImTextureFormat_Alpha8;
+    out_bitmap->Width = out_bitmap->Height = 0;
+    out_bitmap->PixelsOffset = out_pixels->Size;
+    if (out_glyph->Visible)
+    {
+        const int w = (int)ft_bitmap->width;
+        const int h = (int)ft_bitmap->rows;
+        const int bpp = ImTextureDataGetFormatBytesPerPixel(out_bitmap->Format);
+        out_pixels->resize(out_pixels->Size + w * h * bpp);
+        ImGui_ImplFreeType_BlitGlyph(ft_bitmap, out_pixels->Data + out_bitmap->PixelsOffset, w * bpp, out_bitmap->Format);
+        out_bitmap->Width = w;
+        out_bitmap->Height = h;
+    }
+    return true;
+}
+
+bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+{
+    // Load metrics only mode
+    if (out_advance_x != NULL)
+    {
+        IM_ASSERT(out_glyph == NULL);
+        ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+        uint32_t glyph_index = FT_Get_Char_Index(bd_font_data->FtFace, codepoint);
+        if (glyph_index == 0)
+            return false;
+        if (bd_font_data->BakedLastActivated != baked)
+        {
+            ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
+            FT_Activate_Size(bd_baked_data->FtSize);
+            bd_font_data->BakedLastActivated = baked;
+        }
+        if (ImGui_ImplFreeType_LoadGlyph(bd_font_data, codepoint) == nullptr)
+            return false;
+        const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+        *out_advance_x = (bd_font_data->FtFace->glyph->advance.x / FT_SCALEFACTOR) / rasterizer_density;
+        return true;
+    }
+
+    const FT_Bitmap* ft_bitmap = ImGui_ImplFreeType_RenderGlyph(src, baked, loader_data_for_baked_src, codepoint, out_glyph);
+    if (ft_bitmap == nullptr)
+        return false;
+
+    // Pack and retrieve position inside texture atlas
+    if (out_glyph->Visible)
+    {
+        const int w = (int)ft_bitmap->width;
+        const int h = (int)ft_bitmap->rows;
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+        if (pack_id == ImFontAtlasRectId_Invalid)
+        {
+            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            return false;
+        }
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
         out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, (const unsigned char*)temp_buffer, ImTextureFormat_RGBA32, w * 4);
+
+        // Blit straight into texture, without intermediary buffer
+        ImTextureData* tex = atlas->TexData;
+        IM_ASSERT(r->x + r->w <= tex->Width && r->y + r->h <= tex->Height);
+        ImGui_ImplFreeType_BlitGlyph(ft_bitmap, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->GetPitch(), tex->Format);
+        ImFontAtlasBakedCommitFontGlyphBitmap(atlas, baked, src, out_glyph, r);
     }
 
     return true;
@@ -586,6 +648,7 @@ const ImFontLoader* ImGuiFreeType::GetFontLoader()
     loader.FontBakedInit = ImGui_ImplFreeType_FontBakedInit;
     loader.FontBakedDestroy = ImGui_ImplFreeType_FontBakedDestroy;
     loader.FontBakedLoadGlyph = ImGui_ImplFreeType_FontBakedLoadGlyph;
+    loader.FontBakedRasterizeGlyph = ImGui_ImplFreeType_FontBakedRasterizeGlyph;
     loader.FontBakedSrcLoaderDataSize = sizeof(ImGui_ImplFreeType_FontSrcBakedData);
     return &loader;
 }
@@ -0,0 +1,278 @@
+// dear imgui: streaming log viewer
+// (code)
+
+// See imgui_log_view.h for usage.
+
+// Implementation:
+// - Lines are appended to the last page. When a page is full, a new one is allocated and the incomplete last line (if any)
+//   is copied to it, so a line is always contiguous and can be displayed with a single TextUnformatted() call.
+// - Dropping a page drops the lines starting in it, which are always the oldest ones. We advance LinesHead/FilteredHead
+//   instead of erasing, and compact the arrays once half of them is dead, which keeps dropping O(1) amortized.
+// - The filter result is a list of indices into Lines[], which gives random access for ImGuiListClipper.
+//   The incomplete last line is tested every frame and not stored, as it may still change.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_log_view.h"
+#include "imgui_internal.h"     // ImMax, ImMin
+#include <stdarg.h>             // va_list
+#include <string.h>             // memcpy, memchr, strcmp, strlen
+
+//-----------------------------------------------------------------------------
+// ImGuiLogView
+//-----------------------------------------------------------------------------
+
+ImGuiLogView::ImGuiLogView()
+{
+    MaxBytes = 0;
+    PageSize = IMGUI_LOG_VIEW_PAGE_SIZE;
+    FilterMaxLinesPerFrame = 1024 * 1024;
+    AutoScroll = true;
+    LineColorCallback = NULL;
+    LineColorUserData = NULL;
+    LinesHead = 0;
+    LastLineOpen = false;
+    MemoryBytes = 0;
+    LinesDroppedTotal = 0;
+    FilteredHead = 0;
+    FilterScanned = 0;
+    FilteredDroppedTotal = 0;
+    FilterPrevBuf[0] = 0;
+    DrawDroppedPrev = 0;
+    DrawScrollYPrev = 0.0f;
+    DrawFilteredPrev = false;
+}
+
+ImGuiLogView::~ImGuiLogView()
+{
+    Clear();
+}
+
+void ImGuiLogView::Clear()
+{
+    for (ImGuiLogViewPage& page : Pages)
+        IM_FREE(page.Data);
+    Pages.clear();
+    Lines.clear();
+    LinesHead = 0;
+    LastLineOpen = false;
+    MemoryBytes = 0;
+    FilteredLines.clear();
+    FilteredHead = 0;
+    FilterScanned = 0;
+    TempBuffer.clear();
+}
+
+void ImGuiLogView::AppendToLastLine(const char* text, const char* text_end, ImU32 col)
+{
+    const int len = (int)(text_end - text);
+    if (Pages.Size == 0 || Pages.back().Size + len > Pages.back().Capacity)
+    {
+        // Allocate a new page, moving the incomplete last line to it.
+        // Lines longer than PageSize get a larger page, with some slack as they may keep growing.
+        const int line_len = LastLineOpen ? Lines.back().Len : 0;
+        const int required = line_len + len;
+        ImGuiLogViewPage new_page;
+        new_page.Capacity = (required > PageSize) ? required + required / 2 : PageSize;
+        new_page.Data = (char*)IM_ALLOC((size_t)new_page.Capacity);
+        new_page.Size = 0;
+        new_page.LinesCount = 0;
+        if (LastLineOpen)
+        {
+            ImGuiLogViewLine& line = Lines.back();
+            ImGuiLogViewPage& old_page = Pages.back();
+            memcpy(new_page.Data, line.Begin, (size_t)line_len);
+            line.Begin = new_page.Data;
+            new_page.Size = line_len;
+            new_page.LinesCount = 1;
+            old_page.Size -= line_len;  // Last line is always at the end of the last page
+            old_page.LinesCount--;
+            if (old_page.LinesCount == 0)
+            {
+                MemoryBytes -= (size_t)old_page.Capacity;
+                IM_FREE(old_page.Data);
+                Pages.pop_back();
+            }
+        }
+        Pages.push_back(new_page);
+        MemoryBytes += (size_t)new_page.Capacity;
+    }
+
+    ImGuiLogViewPage& page = Pages.back();
+    if (!LastLineOpen)
+    {
+        ImGuiLogViewLine line;
+        line.Begin = page.Data + page.Size;
+        line.Len = 0;
+        line.Color = col;
+        Lines.push_back(line);
+        page.LinesCount++;
+        LastLineOpen = true;
+    }
+    memcpy(page.Data + page.Size, text, (size_t)len);
+    page.Size += len;
+    Lines.back().Len += len;
+}
+
+void ImGuiLogView::CloseLastLine()
+{
+    ImGuiLogViewLine& line = Lines.back();
+    if (line.Color == 0 && LineColorCallback != NULL)
+        line.Color = LineColorCallback(line.Begin, line.Begin + line.Len, LineColorUserData);
+    LastLineOpen = false;
+}
+
+void ImGuiLogView::Append(const char* text, const char* text_end, ImU32 col)
+{
+    if (text_end == NULL)
+        text_end = text + strlen(text);
+    while (text < text_end)
+    {
+        const char* line_end = (const char*)memchr(text, '\n', (size_t)(text_end - text));
+        AppendToLastLine(text, line_end ? line_end : text_end, col);
+        if (line_end == NULL)
+            break;
+        CloseLastLine();
+        text = line_end + 1;
+    }
+    if (MaxBytes > 0 && MemoryBytes > MaxBytes)
+        DropOldPages();
+}
+
+void ImGuiLogView::AppendF(const char* fmt, ...)
+{
+    TempBuffer.Buf.resize(0);
+    va_list args;
+    va_start(args, fmt);
+    TempBuffer.appendfv(fmt, args);
+    va_end(args);
+    Append(TempBuffer.begin(), TempBuffer.end());
+}
+
+void ImGuiLogView::DropOldPages()
+{
+    // Never drop the last page, which we are appending to
+    while (MemoryBytes > MaxBytes && Pages.Size > 1)
+    {
+        ImGuiLogViewPage& page = Pages[0];
+        LinesHead += page.LinesCount;
+        LinesDroppedTotal += (ImU64)page.LinesCount;
+        MemoryBytes -= (size_t)page.Capacity;
+        IM_FREE(page.Data);
+        Pages.erase(Pages.begin());
+    }
+    while (FilteredHead < FilteredLines.Size && FilteredLines[FilteredHead] < LinesHead)
+    {
+        FilteredHead++;
+        FilteredDroppedTotal++;
+    }
+    FilterScanned = ImMax(FilterScanned, LinesHead);
+
+    // Compact once half of the index is dead
+    if (LinesHead >= 1024 && LinesHead * 2 >= Lines.Size)
+    {
+        Lines.erase(Lines.Data, Lines.Data + LinesHead);
+        if (FilteredHead > 0)
+            FilteredLines.erase(FilteredLines.Data, FilteredLines.Data + FilteredHead);
+        for (int& line_idx : FilteredLines)
+            line_idx -= LinesHead;
+        FilterScanned -= LinesHead;
+        LinesHead = FilteredHead = 0;
+    }
+}
+
+void ImGuiLogView::UpdateFilter()
+{
+    // Scan again when the filter changed
+    if (strcmp(Filter.InputBuf, FilterPrevBuf) != 0)
+    {
+        ImStrncpy(FilterPrevBuf, Filter.InputBuf, IM_ARRAYSIZE(FilterPrevBuf));
+        FilteredLines.resize(0);
+        FilteredHead = 0;
+        FilterScanned = LinesHead;
+    }
+    if (!Filter.IsActive())
+    {
+        FilteredLines.resize(0);
+        FilteredHead = 0;
+        FilterScanned = LinesHead;
+        return;
+    }
+
+    // Test completed lines appended since last call
+    const int lines_completed = Lines.Size - (LastLineOpen ? 1 : 0);
+    const int scan_end = (FilterMaxLinesPerFrame > 0) ? ImMin(lines_completed, FilterScanned + FilterMaxLinesPerFrame) : lines_completed;
+    for (int line_idx = FilterScanned; line_idx < scan_end; line_idx++)
+    {
+        const ImGuiLogViewLine& line = Lines[line_idx];
+        if (Filter.PassFilter(line.Begin, line.Begin + line.Len))
+            FilteredLines.push_back(line_idx);
+    }
+    FilterScanned = ImMax(FilterScanned, scan_end);
+}
+
+void ImGuiLogView::Draw(const char* str_id, const ImVec2& size)
+{
+    UpdateFilter();
+    const bool filtered = Filter.IsActive();
+    const float line_height = ImGui::GetTextLineHeight();
+
+    // Keep displayed lines in place when older lines have been dropped since last frame
+    const ImU64 dropped = filtered ? FilteredDroppedTotal : LinesDroppedTotal;
+    if (filtered == DrawFilteredPrev && dropped != DrawDroppedPrev && DrawScrollYPrev > 0.0f)
+        ImGui::SetNextWindowScroll(ImVec2(-1.0f, ImMax(DrawScrollYPrev - (float)(dropped - DrawDroppedPrev) * line_height, 0.0f)));
+    DrawDroppedPrev = dropped;
+    DrawFilteredPrev = filtered;
+
+    if (ImGui::BeginChild(str_id, size, ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        // The incomplete last line is tested every frame, once the scan is complete
+        const bool open_line_visible = LastLineOpen && (!filtered || (!IsFiltering() && Filter.PassFilter(Lines.back().Begin, Lines.back().Begin + Lines.back().Len)));
+        const int filtered_count = FilteredLines.Size - FilteredHead;
+        const int items_count = filtered ? filtered_count + (open_line_visible ? 1 : 0) : GetLinesCount();
+
+        ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+        ImGuiListClipper clipper;
+        clipper.Begin(items_count, line_height);
+        while (clipper.Step())
+            for (int item_n = clipper.DisplayStart; item_n < clipper.DisplayEnd; item_n++)
+            {
+                const int line_idx = !filtered ? LinesHead + item_n : (item_n < filtered_count) ? FilteredLines[FilteredHead + item_n] : Lines.Size - 1;
+                const ImGuiLogViewLine& line = Lines[line_idx];
+                if (line.Color != 0)
+                    ImGui::PushStyleColor(ImGuiCol_Text, line.Color);
+                ImGui::TextUnformatted(line.Begin, line.Begin + line.Len);
+                if (line.Color != 0)
+                    ImGui::PopStyleColor();
+            }
+        clipper.End();
+        ImGui::PopStyleVar();
+
+        // Keep up at the bottom of the scroll region if we were already at the bottom at the beginning of the frame.
+        if (AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+            ImGui::SetScrollHereY(1.0f);
+        DrawScrollYPrev = ImGui::GetScrollY();
+    }
+    ImGui::EndChild();
+}
+
+void ImGuiLogView::CopyToClipboard()
+{
+    UpdateFilter();
+    const bool filtered = Filter.IsActive();
+    ImGuiTextBuffer buf;
+    const int lines_count = filtered ? FilteredLines.Size - FilteredHead : GetLinesCount();
+    for (int item_n = 0; item_n < lines_count; item_n++)
+    {
+        const int line_idx = filtered ? FilteredLines[FilteredHead + item_n] : LinesHead + item_n;
+        const ImGuiLogViewLine& line = Lines[line_idx];
+        buf.append(line.Begin, line.Begin + line.Len);
+        if (!LastLineOpen || line_idx + 1 < Lines.Size)
+            buf.append("\n");
+    }
+    if (filtered && LastLineOpen && !IsFiltering() && Filter.PassFilter(Lines.back().Begin, Lines.back().Begin + Lines.back().Len))
+        buf.append(Lines.back().Begin, Lines.back().Begin + Lines.back().Len);
+    ImGui::SetClipboardText(buf.c_str());
+}
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,100 @@
+// dear imgui: streaming log viewer
+// (headers)
+
+// Append-only text log with a scrolling view, designed to hold hundreds of MB of text.
+// - Text is stored in fixed-size pages which are never moved or reallocated. Appending never copies existing text.
+//   (The only exception is the last line while it is still incomplete, which may move to a new page so each line stays contiguous.)
+// - A line index is maintained incrementally while appending. Displaying uses ImGuiListClipper, so only visible lines are processed.
+// - Filtering (ImGuiTextFilter) is evaluated incrementally: only lines appended since the previous frame are tested.
+//   The whole log is only scanned again when the filter changes, optionally spread over several frames (see FilterMaxLinesPerFrame).
+// - Optional bounded memory: when MaxBytes is set, oldest pages are dropped. Scrolling position is preserved.
+// - Optional per-line colors, given when appending or computed by a callback when a line is completed.
+// Compared to the ExampleAppLog in imgui_demo.cpp (single ImGuiTextBuffer + ImGuiTextIndex, full rescan when filtering),
+// the cost of appending and displaying doesn't depend on the log size.
+
+// Usage:
+//   static ImGuiLogView log;
+//   log.MaxBytes = 256 * 1024 * 1024;                       // Optional: keep about 256 MB of text
+//   log.Append("Hello\n");
+//   log.AppendF("[%05d] frame %d\n", ImGui::GetFrameCount(), n);
+//   log.Append("Something went wrong\n", NULL, IM_COL32(255, 100, 100, 255));
+//   [...]
+//   log.Filter.Draw("Filter");
+//   log.Draw("##log");                                      // Scrolling child window filling the remaining space
+// Lines are separated by '\n'. A line without a terminating '\n' is displayed, and continued by the next Append() call.
+// Not thread-safe: call Append() from the same thread as Draw(), or buffer and lock on your side.
+// Not copyable: ImGuiLogView owns its pages.
+
+#pragma once
+#include "imgui.h"      // IMGUI_API, ImGuiTextFilter, ImVector
+#ifndef IMGUI_DISABLE
+
+// Default size of a page. Lines longer than this are stored in their own page.
+#ifndef IMGUI_LOG_VIEW_PAGE_SIZE
+#define IMGUI_LOG_VIEW_PAGE_SIZE        (256 * 1024)
+#endif
+
+// [Internal] A page of text. Lines never span multiple pages.
+struct ImGuiLogViewPage
+{
+    char*               Data;
+    int                 Size;           // Bytes used
+    int                 Capacity;       // Bytes allocated
+    int                 LinesCount;     // Number of lines starting in this page
+};
+
+// [Internal] A line, pointing into a page. Doesn't include the '\n'.
+struct ImGuiLogViewLine
+{
+    const char*         Begin;
+    int                 Len;
+    ImU32               Color;          // 0 = use ImGuiCol_Text
+};
+
+struct ImGuiLogView
+{
+    ImGuiTextFilter     Filter;                     // Draw it with Filter.Draw(). Changes are detected by Draw()/UpdateFilter().
+    size_t              MaxBytes;                   // Drop oldest pages when memory used by text exceeds this. 0 = unbounded (default).
+    int                 PageSize;                   // Size of new pages. Default to IMGUI_LOG_VIEW_PAGE_SIZE.
+    int                 FilterMaxLinesPerFrame;     // Maximum number of lines tested per frame when scanning again after the filter changed. 0 = unlimited. Default to 1M.
+    bool                AutoScroll;                 // Keep scrolling if already at the bottom. Default to true.
+    ImU32               (*LineColorCallback)(const char* line_begin, const char* line_end, void* user_data); // Optional: color of a completed line appended without explicit color.
+    void*               LineColorUserData;
+
+    // [Internal]
+    ImVector<ImGuiLogViewPage>  Pages;
+    ImVector<ImGuiLogViewLine>  Lines;              // Lines[LinesHead..] are alive, previous ones were dropped with their page
+    int                         LinesHead;
+    bool                        LastLineOpen;       // Last line isn't terminated by a '\n' yet
+    size_t                      MemoryBytes;        // Sum of pages capacity
+    ImU64                       LinesDroppedTotal;
+    ImVector<int>               FilteredLines;      // Indices into Lines[] of completed lines passing the filter, FilteredLines[FilteredHead..] are alive
+    int                         FilteredHead;
+    int                         FilterScanned;      // Lines[LinesHead..FilterScanned] have been tested
+    ImU64                       FilteredDroppedTotal;
+    char                        FilterPrevBuf[IM_ARRAYSIZE(Filter.InputBuf)];
+    ImU64                       DrawDroppedPrev;    // Value of LinesDroppedTotal/FilteredDroppedTotal during last Draw()
+    float                       DrawScrollYPrev;
+    bool                        DrawFilteredPrev;
+    ImGuiTextBuffer             TempBuffer;
+
+    IMGUI_API ImGuiLogView();
+    IMGUI_API ~ImGuiLogView();
+    IMGUI_API void  Append(const char* text, const char* text_end = NULL, ImU32 col = 0); // 'col' applies to lines started by this call.
+    IMGUI_API void  AppendF(const char* fmt, ...) IM_FMTARGS(2);
+    IMGUI_API void  Clear();                        // Free all memory
+    IMGUI_API void  Draw(const char* str_id, const ImVec2& size = ImVec2(0, 0)); // Display in a scrolling child window.
+    IMGUI_API void  UpdateFilter();                 // Called by Draw(). Test new lines, or scan again if the filter changed.
+    IMGUI_API void  CopyToClipboard();              // Copy all lines passing the filter.
+    int             GetLinesCount() const           { return Lines.Size - LinesHead; }  // Including the last line if not terminated.
+    const char*     GetLineBegin(int n) const       { return Lines[LinesHead + n].Begin; }
+    const char*     GetLineEnd(int n) const         { return Lines[LinesHead + n].Begin + Lines[LinesHead + n].Len; }
+    bool            IsFiltering() const             { return Filter.IsActive() && FilterScanned < Lines.Size - (LastLineOpen ? 1 : 0); } // Still scanning after a filter change
+
+    // [Internal]
+    void            AppendToLastLine(const char* text, const char* text_end, ImU32 col);
+    void            CloseLastLine();
+    void            DropOldPages();
+};
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,681 @@
+// dear imgui: draw data serializer for remote rendering
+// (code)
+
+// See imgui_remote_drawdata.h for usage and protocol description.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_remote_drawdata.h"
+#include "imgui_internal.h"     // ImHashData, ImMin, ImMax, IM_STATIC_ASSERT
+#include <string.h>             // memcpy, memset
+
+// Message header
+#define IMGUI_REMOTE_DRAWDATA_MAGIC     0x44444D49  // "IMDD"
+#define IMGUI_REMOTE_DRAWDATA_VERSION   2
+
+enum ImDrawDataWireFlags_
+{
+    ImDrawDataWireFlags_FullFrame       = 1 << 0,
+    ImDrawDataWireFlags_CompactVtx      = 1 << 1,   // Vertices are ImDrawVertCompact, header is followed by CompactVtxOrigin and IM_DRAWVERT_COMPACT_POS_SCALE
+};
+
+enum ImDrawDataWireTexOp_
+{
+    ImDrawDataWireTexOp_Create          = 1,        // Full texture contents
+    ImDrawDataWireTexOp_Update          = 2,        // A rectangle of texture contents
+    ImDrawDataWireTexOp_Destroy         = 3,
+};
+
+enum ImDrawDataWireCmdFlags_
+{
+    ImDrawDataWireCmdFlags_TexData      = 1 << 0,   // TexID is the wire identifier of an ImTextureData
+    ImDrawDataWireCmdFlags_ResetRenderState = 1 << 1, // ImDrawCallback_ResetRenderState
+};
+
+IM_STATIC_ASSERT(sizeof(ImTextureID) <= sizeof(ImU64));
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
+
+static ImU64 ImTextureIDToWire(ImTextureID tex_id)
+{
+    ImU64 v = 0;
+    memcpy(&v, &tex_id, sizeof(tex_id));
+    return v;
+}
+
+static ImTextureID ImTextureIDFromWire(ImU64 v)
+{
+    ImTextureID tex_id;
+    memcpy(&tex_id, &v, sizeof(tex_id));
+    return tex_id;
+}
+
+// 64-bit content hash. Not cryptographic: we only need collisions between two successive versions of a block to be very unlikely.
+static ImU64 ImHashBlock64(const void* data, size_t size)
+{
+    const ImU64 k1 = 0x9E3779B185EBCA87ULL;
+    const ImU64 k2 = 0xC2B2AE3D27D4EB4FULL;
+    const unsigned char* p = (const unsigned char*)data;
+    ImU64 h = k1 ^ (ImU64)size;
+    for (; size >= 8; p += 8, size -= 8)
+    {
+        ImU64 w;
+        memcpy(&w, p, 8);
+        h ^= w * k2;
+        h = ((h << 31) | (h >> 33)) * k1;
+    }
+    if (size > 0)
+    {
+        ImU64 w = 0;
+        memcpy(&w, p, size);
+        h ^= w * k2;
+        h = ((h << 31) | (h >> 33)) * k1;
+    }
+    h ^= h >> 33;
+    h *= k2;
+    h ^= h >> 29;
+    return h;
+}
+
+static void ImDrawDataWrite(ImVector<unsigned char>* buf, const void* data, size_t size)
+{
+    const int offset = buf->Size;
+    buf->resize(buf->Size + (int)size);
+    memcpy(buf->Data + offset, data, size);
+}
+
+template<typename T>
+static void ImDrawDataWriteValue(ImVector<unsigned char>* buf, T v)
+{
+    ImDrawDataWrite(buf, &v, sizeof(T));
+}
+
+template<typename T>
+static void ImDrawDataPatchValue(ImVector<unsigned char>* buf, int offset, T v)
+{
+    memcpy(buf->Data + offset, &v, sizeof(T));
+}
+
+struct ImDrawDataReader
+{
+    const unsigned char*    P;
+    const unsigned char*    End;
+
+    ImDrawDataReader(const void* data, size_t size) { P = (const unsigned char*)data; End = P + size; }
+    bool Read(void* dst, size_t size)
+    {
+        if ((size_t)(End - P) < size)
+            return false;
+        memcpy(dst, P, size);
+        P += size;
+        return true;
+    }
+    template<typename T> bool ReadValue(T* v) { return Read(v, sizeof(T)); }
+};
+
+//-----------------------------------------------------------------------------
+// ImDrawDataEncoder
+//-----------------------------------------------------------------------------
+
+ImDrawDataEncoder::ImDrawDataEncoder()
+{
+    FrameCount = 0;
+    StatListsCount = StatListsSent = StatFullSize = StatTexturesSize = StatEncodedSize = 0;
+    StatCompactVtx = false;
+    ListsNextID = 0;
+    TexturesNextID = 0;
+    WantFullFrame = true;
+    LastCompactVtx = false;
+}
+
+ImDrawDataEncoder::~ImDrawDataEncoder()
+{
+    Reset();
+}
+
+void ImDrawDataEncoder::Reset()
+{
+    for (ImDrawDataEncoderList* list : Lists)
+        IM_DELETE(list);
+    Lists.clear();
+    ListsMap.Clear();
+    WantFullFrame = true;
+}
+
+// Write buffer as ranges of elements which blocks content changed since last call, and update block hashes.
+// Return true if anything changed.
+static bool ImDrawDataEncodeBuffer(ImVector<unsigned char>* out_buf, int* prev_count, ImVector<ImU64>* block_hashes, ImVector<int>* ranges, const void* data, int count, int elem_size)
+{
+    const int block_elems = ImMax(1, IMGUI_REMOTE_DRAWDATA_BLOCK_SIZE / elem_size);
+    const int blocks_count = (count + block_elems - 1) / block_elems;
+    const int prev_blocks_count = block_hashes->Size;
+    block_hashes->resize(blocks_count);
+    ranges->resize(0);
+    for (int block_n = 0; block_n < blocks_count; block_n++)
+    {
+        const int elem_begin = block_n * block_elems;
+        const int elem_end = ImMin(elem_begin + block_elems, count);
+        const ImU64 hash = ImHashBlock64((const unsigned char*)data + (size_t)elem_begin * elem_size, (size_t)(elem_end - elem_begin) * elem_size); // Size is hashed, so a partial last block won't match a full one
+        if (block_n < prev_blocks_count && (*block_hashes)[block_n] == hash)
+            continue;
+        (*block_hashes)[block_n] = hash;
+        if (ranges->Size > 0 && ranges->back() == elem_begin)
+            ranges->back() = elem_end; // Extend previous range
+        else
+        {
+            ranges->push_back(elem_begin);
+            ranges->push_back(elem_end);
+        }
+    }
+
+    ImDrawDataWriteValue<ImU32>(out_buf, (ImU32)count);
+    ImDrawDataWriteValue<ImU32>(out_buf, (ImU32)(ranges->Size / 2));
+    for (int range_n = 0; range_n < ranges->Size; range_n += 2)
+    {
+        const int elem_begin = (*ranges)[range_n];
+        const int elem_end = (*ranges)[range_n + 1];
+        ImDrawDataWriteValue<ImU32>(out_buf, (ImU32)elem_begin);
+        ImDrawDataWriteValue<ImU32>(out_buf, (ImU32)(elem_end - elem_begin));
+        ImDrawDataWrite(out_buf, (const unsigned char*)data + (size_t)elem_begin * elem_size, (size_t)(elem_end - elem_begin) * elem_size);
+    }
+    const bool changed = (ranges->Size > 0 || count != *prev_count);
+    *prev_count = count;
+    return changed;
+}
+
+static void ImDrawDataEncodeTextureRect(ImVector<unsigned char>* out_buf, ImTextureData* tex, int x, int y, int w, int h)
+{
+    const int row_size = w * tex->BytesPerPixel;
+    for (int row_n = 0; row_n < h; row_n++)
+        ImDrawDataWrite(out_buf, tex->GetPixelsAt(x, y + row_n), (size_t)row_size);
+}
+
+void ImDrawDataEncoder::Encode(ImDrawData* draw_data, ImVector<unsigned char>* out_buf)
+{
+    const bool full_frame = WantFullFrame;
+    if (full_frame)
+        Reset();
+    WantFullFrame = false;
+    FrameCount++;
+
+    // Send compact vertices when Render() could convert all of them (see ImGuiBackendFlags_RendererHasCompactVtx).
+    // When switching format, forget block hashes of vertex buffers so they are sent in full.
+    const bool compact_vtx = (draw_data->TotalVtxCount > 0 && draw_data->CompactVtxBuffer.Size == draw_data->TotalVtxCount);
+    if (compact_vtx != LastCompactVtx)
+        for (ImDrawDataEncoderList* list : Lists)
+        {
+            list->Counts[1] = -1;
+            list->BlockHashes[1].resize(0);
+        }
+    LastCompactVtx = StatCompactVtx = compact_vtx;
+
+    // Header
+    const int msg_start = out_buf->Size;
+    ImDrawDataWriteValue<ImU32>(out_buf, IMGUI_REMOTE_DRAWDATA_MAGIC);
+    ImDrawDataWriteValue<ImU8>(out_buf, IMGUI_REMOTE_DRAWDATA_VERSION);
+    ImDrawDataWriteValue<ImU8>(out_buf, (ImU8)sizeof(ImDrawVert));
+    ImDrawDataWriteValue<ImU8>(out_buf, (ImU8)sizeof(ImDrawIdx));
+    ImDrawDataWriteValue<ImU8>(out_buf, (ImU8)((full_frame ? ImDrawDataWireFlags_FullFrame : 0) | (compact_vtx ? ImDrawDataWireFlags_CompactVtx : 0)));
+    const int msg_size_offset = out_buf->Size;
+    ImDrawDataWriteValue<ImU32>(out_buf, 0); // Patched below
+    ImDrawDataWriteValue<ImVec2>(out_buf, draw_data->DisplayPos);
+    ImDrawDataWriteValue<ImVec2>(out_buf, draw_data->DisplaySize);
+    ImDrawDataWriteValue<ImVec2>(out_buf, draw_data->FramebufferScale);
+    if (compact_vtx)
+    {
+        ImDrawDataWriteValue<ImVec2>(out_buf, draw_data->CompactVtxOrigin);
+        ImDrawDataWriteValue<float>(out_buf, IM_DRAWVERT_COMPACT_POS_SCALE);
+    }
+
+    // Textures
+    // We behave like a renderer backend, honoring requests and assigning TexID. On a full frame we also send existing textures.
+    const int tex_start = out_buf->Size;
+    const int tex_ops_count_offset = out_buf->Size;
+    ImDrawDataWriteValue<ImU32>(out_buf, 0); // Patched below
+    ImU32 tex_ops_count = 0;
+    if (draw_data->Textures != NULL)
+        for (ImTextureData* tex : *draw_data->Textures)
+        {
+            if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+            {
+                if (tex->TexID != ImTextureID_Invalid)
+                {
+                    ImDrawDataWriteValue<ImU8>(out_buf, ImDrawDataWireTexOp_Destroy);
+                    ImDrawDataWriteValue<ImU64>(out_buf, ImTextureIDToWire(tex->TexID));
+                    tex_ops_count++;
+                }
+                tex->SetTexID(ImTextureID_Invalid);
+                tex->SetStatus(ImTextureStatus_Destroyed);
+                continue;
+            }
+            if (tex->Status == ImTextureStatus_WantCreate)
+                tex->SetTexID(ImTextureIDFromWire(++TexturesNextID));
+            if (tex->Status == ImTextureStatus_WantCreate || (full_frame && (tex->Status == ImTextureStatus_OK || tex->Status == ImTextureStatus_WantUpdates)))
+            {
+                ImDrawDataWriteValue<ImU8>(out_buf, ImDrawDataWireTexOp_Create);
+                ImDrawDataWriteValue<ImU64>(out_buf, ImTextureIDToWire(tex->TexID));
+                ImDrawDataWriteValue<ImU8>(out_buf, (ImU8)tex->Format);
+                ImDrawDataWriteValue<ImU16>(out_buf, (ImU16)tex->Width);
+                ImDrawDataWriteValue<ImU16>(out_buf, (ImU16)tex->Height);
+                ImDrawDataEncodeTextureRect(out_buf, tex, 0, 0, tex->Width, tex->Height);
+                tex->SetStatus(ImTextureStatus_OK);
+                tex_ops_count++;
+            }
+            else if (tex->Status == ImTextureStatus_WantUpdates)
+            {
+                for (const ImTextureRect& r : tex->Updates)
+                {
+                    ImDrawDataWriteValue<ImU8>(out_buf, ImDrawDataWireTexOp_Update);
+                    ImDrawDataWriteValue<ImU64>(out_buf, ImTextureIDToWire(tex->TexID));
+                    ImDrawDataWriteValue<ImTextureRect>(out_buf, r);
+                    ImDrawDataEncodeTextureRect(out_buf, tex, r.x, r.y, r.w, r.h);
+                    tex_ops_count++;
+                }
+                tex->SetStatus(ImTextureStatus_OK);
+            }
+        }
+    ImDrawDataPatchValue<ImU32>(out_buf, tex_ops_count_offset, tex_ops_count);
+    StatTexturesSize = out_buf->Size - tex_start;
+
+    // Draw lists
+    StatListsCount = draw_data->CmdListsCount;
+    StatListsSent = 0;
+    StatFullSize = 0;
+    ImDrawDataWriteValue<ImU32>(out_buf, (ImU32)draw_data->CmdListsCount);
+    const int vtx_size = compact_vtx ? (int)sizeof(ImDrawVertCompact) : (int)sizeof(ImDrawVert);
+    int global_vtx_offset = 0;
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        const void* vtx_data = compact_vtx ? (const void*)(draw_data->CompactVtxBuffer.Data + global_vtx_offset) : (const void*)draw_list->VtxBuffer.Data;
+        global_vtx_offset += draw_list->VtxBuffer.Size;
+
+        // Find or create state for this draw list
+        const ImGuiID key = ImHashData(&draw_list, sizeof(draw_list));
+        const int list_idx = ListsMap.GetInt(key, 0) - 1;
+        ImDrawDataEncoderList* list = (list_idx >= 0 && Lists[list_idx]->DrawList == draw_list) ? Lists[list_idx] : NULL;
+        if (list == NULL)
+        {
+            list = IM_NEW(ImDrawDataEncoderList)();
+            list->DrawList = draw_list;
+            list->ID = ++ListsNextID;
+            for (int& count : list->Counts)
+                count = -1;
+            Lists.push_back(list);
+            ListsMap.SetInt(key, Lists.Size);
+        }
+        list->LastFrameUsed = FrameCount;
+
+        // Serialize commands
+        TempCmdData.resize(0);
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            if (cmd.UserCallback != NULL && cmd.UserCallback != ImDrawCallback_ResetRenderState)
+                continue;
+            ImDrawDataWireCmd wire_cmd;
+            memset((void*)&wire_cmd, 0, sizeof(wire_cmd));
+            wire_cmd.ClipRect = cmd.ClipRect;
+            if (cmd.UserCallback == NULL)
+                wire_cmd.TexID = ImTextureIDToWire(cmd.GetTexID());
+            wire_cmd.VtxOffset = cmd.VtxOffset;
+            wire_cmd.IdxOffset = cmd.IdxOffset;
+            wire_cmd.ElemCount = cmd.ElemCount;
+            wire_cmd.InstOffset = cmd.InstOffset;
+            wire_cmd.InstCount = cmd.InstCount;
+            wire_cmd.Flags = (cmd.TexRef._TexData != NULL ? ImDrawDataWireCmdFlags_TexData : 0) | (cmd.UserCallback == ImDrawCallback_ResetRenderState ? ImDrawDataWireCmdFlags_ResetRenderState : 0);
+            TempCmdData.push_back(wire_cmd);
+        }
+
+        // Write buffers, or a single byte if unchanged
+        const int list_start = out_buf->Size;
+        ImDrawDataWriteValue<ImU32>(out_buf, list->ID);
+        ImDrawDataWriteValue<ImU8>(out_buf, 1);
+        bool changed = false;
+        changed |= ImDrawDataEncodeBuffer(out_buf, &list->Counts[0], &list->BlockHashes[0], &TempRanges, TempCmdData.Data, TempCmdData.Size, (int)sizeof(ImDrawDataWireCmd));
+        changed |= ImDrawDataEncodeBuffer(out_buf, &list->Counts[1], &list->BlockHashes[1], &TempRanges, vtx_data, draw_list->VtxBuffer.Size, vtx_size);
+        changed |= ImDrawDataEncodeBuffer(out_buf, &list->Counts[2], &list->BlockHashes[2], &TempRanges, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size, (int)sizeof(ImDrawIdx));
+        changed |= ImDrawDataEncodeBuffer(out_buf, &list->Counts[3], &list->BlockHashes[3], &TempRanges, draw_list->InstBuffer.Data, draw_list->InstBuffer.Size, (int)sizeof(ImDrawInstance));
+        if (!changed)
+        {
+            out_buf->resize(list_start);
+            ImDrawDataWriteValue<ImU32>(out_buf, list->ID);
+            ImDrawDataWriteValue<ImU8>(out_buf, 0);
+        }
+        StatListsSent += changed ? 1 : 0;
+        StatFullSize += 5 + 4 * 4 + TempCmdData.size_in_bytes() + draw_list->VtxBuffer.Size * vtx_size + draw_list->IdxBuffer.size_in_bytes() + draw_list->InstBuffer.size_in_bytes();
+    }
+    ImDrawDataPatchValue<ImU32>(out_buf, msg_size_offset, (ImU32)(out_buf->Size - msg_start));
+    StatEncodedSize = out_buf->Size - msg_start;
+
+    // Garbage collect state of draw lists which were not rendered this frame. The decoder does the same.
+    int lists_write_n = 0;
+    for (ImDrawDataEncoderList* list : Lists)
+        if (list->LastFrameUsed == FrameCount)
+            Lists[lists_write_n++] = list;
+        else
+            IM_DELETE(list);
+    if (lists_write_n < Lists.Size)
+    {
+        Lists.resize(lists_write_n);
+        ListsMap.Clear();
+        for (int list_n = 0; list_n < Lists.Size; list_n++)
+            ListsMap.SetInt(ImHashData(&Lists[list_n]->DrawList, sizeof(ImDrawList*)), list_n + 1);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// ImDrawDataDecoder
+//-----------------------------------------------------------------------------
+
+ImDrawDataDecoder::ImDrawDataDecoder()
+{
+    FrameCount = 0;
+    WantFullFrame = true;
+}
+
+ImDrawDataDecoder::~ImDrawDataDecoder()
+{
+    Clear();
+    for (ImTextureData* tex : Textures)
+        IM_DELETE(tex);
+    Textures.clear();
+    TexturesWireIDs.clear();
+}
+
+// Release draw lists and request destruction of all textures.
+void ImDrawDataDecoder::Clear()
+{
+    for (ImDrawDataDecoderList* list : Lists)
+    {
+        IM_DELETE(list->DrawList);
+        IM_DELETE(list);
+    }
+    Lists.clear();
+    ListsMap.Clear();
+    for (ImTextureData* tex : Textures)
+        if (tex->Status != ImTextureStatus_Destroyed && tex->Status != ImTextureStatus_WantDestroy)
+        {
+            tex->Status = ImTextureStatus_WantDestroy;
+            tex->UnusedFrames = 1;
+        }
+    DrawData.Clear();
+    DrawData.Textures = &Textures; // Allow renderer backend to process texture requests even without any draw list
+    WantFullFrame = true;
+}
+
+static ImTextureData* ImDrawDataDecoderFindTexture(ImDrawDataDecoder* decoder, ImU64 wire_id)
+{
+    for (int tex_n = 0; tex_n < decoder->Textures.Size; tex_n++)
+        if (decoder->TexturesWireIDs[tex_n] == wire_id && decoder->Textures[tex_n]->Status != ImTextureStatus_WantDestroy && decoder->Textures[tex_n]->Status != ImTextureStatus_Destroyed)
+            return decoder->Textures[tex_n];
+    return NULL;
+}
+
+static bool ImDrawDataDecodeTextureRect(ImDrawDataReader* r, ImTextureData* tex, int x, int y, int w, int h)
+{
+    if (x + w > tex->Width || y + h > tex->Height)
+        return false;
+    for (int row_n = 0; row_n < h; row_n++)
+        if (!r->Read(tex->GetPixelsAt(x, y + row_n), (size_t)(w * tex->BytesPerPixel)))
+            return false;
+    return true;
+}
+
+template<typename T>
+static bool ImDrawDataDecodeBuffer(ImDrawDataReader* r, ImVector<T>* buf)
+{
+    ImU32 count, ranges_count;
+    if (!r->ReadValue(&count) || !r->ReadValue(&ranges_count) || count > 0x7FFFFFFF / sizeof(T))
+        return false;
+    buf->resize((int)count); // Keep existing contents
+    for (ImU32 range_n = 0; range_n < ranges_count; range_n++)
+    {
+        ImU32 elem_begin, elem_count;
+        if (!r->ReadValue(&elem_begin) || !r->ReadValue(&elem_count) || elem_begin > count || elem_count > count - elem_begin)
+            return false;
+        if (!r->Read(buf->Data + elem_begin, elem_count * sizeof(T)))
+            return false;
+    }
+    return true;
+}
+
+static void ImDrawDataDecodeCompactVtx(ImDrawDataDecoderList* list, ImVec2 origin, float scale)
+{
+    ImVector<ImDrawVert>& vtx_buffer = list->DrawList->VtxBuffer;
+    vtx_buffer.resize(list->CompactVtxData.Size);
+    const float inv_scale = 1.0f / scale;
+    ImDrawVert* vtx_write = vtx_buffer.Data;
+    for (const ImDrawVertCompact& v : list->CompactVtxData)
+    {
+        vtx_write->pos = ImVec2(origin.x + v.pos[0] * inv_scale, origin.y + v.pos[1] * inv_scale);
+        vtx_write->uv = ImVec2(v.uv[0] * (1.0f / 65535.0f), v.uv[1] * (1.0f / 65535.0f));
+        vtx_write->col = v.col;
+        vtx_write++;
+    }
+    list->CompactVtxOrigin = origin;
+    list->CompactVtxScale = scale;
+}
+
+bool ImDrawDataDecoder::Decode(const void* data, size_t data_size)
+{
+    ImDrawDataReader r(data, data_size);
+
+    // Header
+    ImU32 magic, msg_size;
+    ImU8 version, sizeof_vert, sizeof_idx, flags;
+    ImVec2 display_pos, display_size, framebuffer_scale, compact_vtx_origin;
+    float compact_vtx_scale = 0.0f;
+    if (!r.ReadValue(&magic) || !r.ReadValue(&version) || !r.ReadValue(&sizeof_vert) || !r.ReadValue(&sizeof_idx) || !r.ReadValue(&flags) || !r.ReadValue(&msg_size))
+        return Clear(), false;
+    if (magic != IMGUI_REMOTE_DRAWDATA_MAGIC || version != IMGUI_REMOTE_DRAWDATA_VERSION || sizeof_vert != sizeof(ImDrawVert) || sizeof_idx != sizeof(ImDrawIdx) || msg_size > data_size)
+        return Clear(), false;
+    if (!r.ReadValue(&display_pos) || !r.ReadValue(&display_size) || !r.ReadValue(&framebuffer_scale))
+        return Clear(), false;
+    const bool compact_vtx = (flags & ImDrawDataWireFlags_CompactVtx) != 0;
+    if (compact_vtx && (!r.ReadValue(&compact_vtx_origin) || !r.ReadValue(&compact_vtx_scale) || !(compact_vtx_scale > 0.0f)))
+        return Clear(), false;
+    if (msg_size < (size_t)(r.P - (const unsigned char*)data))
+        return Clear(), false;
+    r.End = (const unsigned char*)data + msg_size;
+
+    const bool full_frame = (flags & ImDrawDataWireFlags_FullFrame) != 0;
+    if (full_frame)
+        Clear();
+    else if (WantFullFrame)
+        return false; // Waiting for a full frame after an error
+    FrameCount++;
+
+    // Release textures destroyed by renderer backend (or which never reached it)
+    for (int tex_n = 0; tex_n < Textures.Size; tex_n++)
+    {
+        ImTextureData* tex = Textures[tex_n];
+        if (tex->Status == ImTextureStatus_WantDestroy)
+            tex->UnusedFrames++;
+        if (tex->Status == ImTextureStatus_Destroyed || (tex->Status == ImTextureStatus_WantDestroy && tex->TexID == ImTextureID_Invalid && tex->BackendUserData == NULL))
+        {
+            IM_DELETE(tex);
+            Textures.erase(Textures.Data + tex_n);
+            TexturesWireIDs.erase(TexturesWireIDs.Data + tex_n);
+            tex_n--;
+        }
+    }
+
+    // Textures
+    ImU32 tex_ops_count;
+    if (!r.ReadValue(&tex_ops_count))
+        return Clear(), false;
+    for (ImU32 tex_op_n = 0; tex_op_n < tex_ops_count; tex_op_n++)
+    {
+        ImU8 op;
+        ImU64 wire_id;
+        if (!r.ReadValue(&op) || !r.ReadValue(&wire_id))
+            return Clear(), false;
+        ImTextureData* tex = ImDrawDataDecoderFindTexture(this, wire_id);
+        if (op == ImDrawDataWireTexOp_Create)
+        {
+            ImU8 format;
+            ImU16 w, h;
+            if (tex != NULL || !r.ReadValue(&format) || !r.ReadValue(&w) || !r.ReadValue(&h) || (format != ImTextureFormat_RGBA32 && format != ImTextureFormat_Alpha8))
+                return Clear(), false;
+            tex = IM_NEW(ImTextureData)();
+            tex->Create((ImTextureFormat)format, w, h);
+            tex->UniqueID = (int)wire_id;
+            tex->UsedRect.w = w;
+            tex->UsedRect.h = h;
+            tex->RefCount = 1;
+            tex->Status = ImTextureStatus_WantCreate;
+            Textures.push_back(tex);
+            TexturesWireIDs.push_back(wire_id);
+            if (!ImDrawDataDecodeTextureRect(&r, tex, 0, 0, w, h))
+                return Clear(), false;
+        }
+        else if (op == ImDrawDataWireTexOp_Update)
+        {
+            ImTextureRect req;
+            if (tex == NULL || !r.ReadValue(&req) || !ImDrawDataDecodeTextureRect(&r, tex, req.x, req.y, req.w, req.h))
+                return Clear(), false;
+            if (tex->Status == ImTextureStatus_OK)
+            {
+                tex->Updates.resize(0);
+                tex->UpdateRect.x = tex->UpdateRect.y = (unsigned short)~0;
+                tex->UpdateRect.w = tex->UpdateRect.h = 0;
+            }
+            if (tex->Status == ImTextureStatus_OK || tex->Status == ImTextureStatus_WantUpdates) // No need to queue if status is _WantCreate
+            {
+                const int new_x1 = ImMax(tex->UpdateRect.w == 0 ? 0 : tex->UpdateRect.x + tex->UpdateRect.w, req.x + req.w);
+                const int new_y1 = ImMax(tex->UpdateRect.h == 0 ? 0 : tex->UpdateRect.y + tex->UpdateRect.h, req.y + req.h);
+                tex->UpdateRect.x = ImMin(tex->UpdateRect.x, req.x);
+                tex->UpdateRect.y = ImMin(tex->UpdateRect.y, req.y);
+                tex->UpdateRect.w = (unsigned short)(new_x1 - tex->UpdateRect.x);
+                tex->UpdateRect.h = (unsigned short)(new_y1 - tex->UpdateRect.y);
+                tex->Updates.push_back(req);
+                tex->Status = ImTextureStatus_WantUpdates;
+            }
+        }
+        else if (op == ImDrawDataWireTexOp_Destroy)
+        {
+            if (tex == NULL)
+                return Clear(), false;
+            tex->Status = ImTextureStatus_WantDestroy;
+            tex->UnusedFrames = 1;
+        }
+        else
+        {
+            return Clear(), false;
+        }
+    }
+
+    // Draw lists
+    ImU32 lists_count;
+    if (!r.ReadValue(&lists_count))
+        return Clear(), false;
+    DrawData.Clear();
+    for (ImU32 list_n = 0; list_n < lists_count; list_n++)
+    {
+        ImU32 id;
+        ImU8 changed;
+        if (!r.ReadValue(&id) || !r.ReadValue(&changed))
+            return Clear(), false;
+        const int list_idx = ListsMap.GetInt((ImGuiID)id, 0) - 1;
+        ImDrawDataDecoderList* list = (list_idx >= 0) ? Lists[list_idx] : NULL;
+        if (list == NULL)
+        {
+            if (!changed)
+                return Clear(), false;
+            list = IM_NEW(ImDrawDataDecoderList)();
+            list->ID = id;
+            list->DrawList = IM_NEW(ImDrawList)(NULL);
+            list->CompactVtxScale = 0.0f;
+            Lists.push_back(list);
+            ListsMap.SetInt((ImGuiID)id, Lists.Size);
+        }
+        list->LastFrameUsed = FrameCount;
+
+        ImDrawList* draw_list = list->DrawList;
+        if (changed)
+        {
+            if (!ImDrawDataDecodeBuffer(&r, &list->CmdData))
+                return Clear(), false;
+            if (compact_vtx ? !ImDrawDataDecodeBuffer(&r, &list->CompactVtxData) : !ImDrawDataDecodeBuffer(&r, &draw_list->VtxBuffer))
+                return Clear(), false;
+            if (!ImDrawDataDecodeBuffer(&r, &draw_list->IdxBuffer) || !ImDrawDataDecodeBuffer(&r, &draw_list->InstBuffer))
+                return Clear(), false;
+            if (!compact_vtx)
+                list->CompactVtxData.resize(0);
+
+            // Rebuild commands
+            draw_list->CmdBuffer.resize(list->CmdData.Size);
+            for (int cmd_n = 0; cmd_n < list->CmdData.Size; cmd_n++)
+            {
+                const ImDrawDataWireCmd& wire_cmd = list->CmdData[cmd_n];
+                ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+                memset((void*)&cmd, 0, sizeof(cmd));
+                cmd.ClipRect = wire_cmd.ClipRect;
+                if (wire_cmd.Flags & ImDrawDataWireCmdFlags_TexData)
+                {
+                    if ((cmd.TexRef._TexData = ImDrawDataDecoderFindTexture(this, wire_cmd.TexID)) == NULL)
+                        return Clear(), false;
+                }
+                else
+                {
+                    cmd.TexRef._TexID = ImTextureIDFromWire(wire_cmd.TexID);
+                }
+                cmd.VtxOffset = wire_cmd.VtxOffset;
+                cmd.IdxOffset = wire_cmd.IdxOffset;
+                cmd.ElemCount = wire_cmd.ElemCount;
+                cmd.InstOffset = wire_cmd.InstOffset;
+                cmd.InstCount = wire_cmd.InstCount;
+                if (wire_cmd.Flags & ImDrawDataWireCmdFlags_ResetRenderState)
+                    cmd.UserCallback = ImDrawCallback_ResetRenderState;
+                if (cmd.IdxOffset > (ImU32)draw_list->IdxBuffer.Size || cmd.ElemCount > (ImU32)draw_list->IdxBuffer.Size - cmd.IdxOffset)
+                    return Clear(), false;
+                if (cmd.InstOffset > (ImU32)draw_list->InstBuffer.Size || cmd.InstCount > (ImU32)draw_list->InstBuffer.Size - cmd.InstOffset)
+                    return Clear(), false;
+            }
+        }
+
+        // Expand compact vertices. Unchanged lists also need it when origin moved: their vertices moved along with it on the sender.
+        if (compact_vtx && (changed || list->CompactVtxOrigin.x != compact_vtx_origin.x || list->CompactVtxOrigin.y != compact_vtx_origin.y || list->CompactVtxScale != compact_vtx_scale))
+        {
+            if (!changed && list->CompactVtxData.Size != draw_list->VtxBuffer.Size)
+                return Clear(), false;
+            ImDrawDataDecodeCompactVtx(list, compact_vtx_origin, compact_vtx_scale);
+        }
+        DrawData.CmdLists.push_back(draw_list);
+        DrawData.TotalVtxCount += draw_list->VtxBuffer.Size;
+        DrawData.TotalIdxCount += draw_list->IdxBuffer.Size;
+        DrawData.TotalInstCount += draw_list->InstBuffer.Size;
+    }
+    if (r.P != r.End)
+        return Clear(), false;
+
+    // Release draw lists which were not sent this frame. The encoder does the same.
+    int lists_write_n = 0;
+    for (ImDrawDataDecoderList* list : Lists)
+        if (list->LastFrameUsed == FrameCount)
+            Lists[lists_write_n++] = list;
+        else
+        {
+            IM_DELETE(list->DrawList);
+            IM_DELETE(list);
+        }
+    if (lists_write_n < Lists.Size)
+    {
+        Lists.resize(lists_write_n);
+        ListsMap.Clear();
+        for (int list_n = 0; list_n < Lists.Size; list_n++)
+            ListsMap.SetInt((ImGuiID)Lists[list_n]->ID, list_n + 1);
+    }
+
+    DrawData.Valid = true;
+    DrawData.CmdListsCount = DrawData.CmdLists.Size;
+    DrawData.DisplayPos = display_pos;
+    DrawData.DisplaySize = display_size;
+    DrawData.FramebufferScale = framebuffer_scale;
+    DrawData.Textures = &Textures;
+    WantFullFrame = false;
+    return true;
+}
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,124 @@
+// dear imgui: draw data serializer for remote rendering
+// (headers)
+
+// Encode ImDrawData into a binary stream, sending only what changed since the previous frame, and decode it back into an ImDrawData on another machine.
+// This is designed for streaming a UI to thin clients: the receiver only needs a regular renderer backend.
+
+// Usage (sender, which has no renderer backend):
+//   io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset; // Advertise capabilities of the receiver
+//   io.BackendFlags |= ImGuiBackendFlags_RendererHasCompactVtx; // Optional: send 12 bytes vertices (any receiver can decode them)
+//   ImDrawDataEncoder encoder;
+//   ImVector<unsigned char> buf;
+//   [...] ImGui::Render();
+//   encoder.Encode(ImGui::GetDrawData(), &buf); // Also honors texture requests, like a renderer backend would.
+//   send(buf.Data, buf.Size);
+// Usage (receiver):
+//   ImDrawDataDecoder decoder;
+//   if (decoder.Decode(data, size))
+//       ImGui_ImplXXXX_RenderDrawData(&decoder.DrawData);
+// Call encoder.Reset() when a new receiver connects: the next frame will be encoded in full (including textures).
+
+// Protocol:
+// - Each frame is a self-delimited message. Messages need to be decoded in order, without gaps, except for a full frame which resets the decoder.
+// - Draw lists are identified across frames by their ImDrawList* pointer on the sender (one per window).
+//   A draw list whose content didn't change is sent as a few bytes. For others, we send the command, vertex, index and instance
+//   buffers as blocks which content hash changed since previous frame (see IMGUI_REMOTE_DRAWDATA_BLOCK_SIZE).
+// - When ImDrawData::CompactVtxBuffer is valid (see ImGuiBackendFlags_RendererHasCompactVtx), vertices are sent as 12 bytes ImDrawVertCompact
+//   instead of ImDrawVert. The decoder expands them back to ImDrawVert, so the receiver doesn't need to support compact vertices.
+//   On frames where some vertices don't fit (see ImDrawVertCompact), regular vertices are sent.
+// - Textures are sent in full on creation, then only updated regions.
+// - Command user callbacks are not transmitted, except ImDrawCallback_ResetRenderState.
+// - Data is sent in native layout: both sides need the same endianness, ImDrawVert layout and ImDrawIdx size (this is checked).
+// - Decode() validates message structure and command ranges, but not index values: only connect to trusted senders.
+
+#pragma once
+#include "imgui.h"      // IMGUI_API
+#ifndef IMGUI_DISABLE
+
+// Size in bytes of the blocks hashed and sent when changed. Smaller blocks send less redundant data but add more overhead.
+#ifndef IMGUI_REMOTE_DRAWDATA_BLOCK_SIZE
+#define IMGUI_REMOTE_DRAWDATA_BLOCK_SIZE    512
+#endif
+
+// [Internal] Serialized ImDrawCmd
+struct ImDrawDataWireCmd
+{
+    ImVec4              ClipRect;
+    ImU64               TexID;                  // ImTextureData identifier on the wire when Flags & 1, otherwise user ImTextureID
+    ImU32               VtxOffset;
+    ImU32               IdxOffset;
+    ImU32               ElemCount;
+    ImU32               InstOffset;
+    ImU32               InstCount;
+    ImU32               Flags;
+};
+
+// [Internal] Per draw list state, for each of the 4 buffers (commands, vertices, indices, instances).
+struct ImDrawDataEncoderList
+{
+    ImDrawList*         DrawList;
+    ImU32               ID;
+    int                 LastFrameUsed;
+    int                 Counts[4];
+    ImVector<ImU64>     BlockHashes[4];
+};
+
+struct ImDrawDataDecoderList
+{
+    ImU32               ID;
+    int                 LastFrameUsed;
+    ImDrawList*         DrawList;
+    ImVector<ImDrawDataWireCmd> CmdData;
+    ImVector<ImDrawVertCompact> CompactVtxData; // Received vertices, when sent as ImDrawVertCompact
+    ImVec2              CompactVtxOrigin;       // Origin and scale CompactVtxData[] was expanded with
+    float               CompactVtxScale;
+};
+
+// Sender side
+struct ImDrawDataEncoder
+{
+    // Statistics for last encoded frame
+    int                 FrameCount;
+    int                 StatListsCount;         // Number of draw lists
+    int                 StatListsSent;          // Number of draw lists which changed
+    int                 StatFullSize;           // Size in bytes a full encoding of draw lists would take
+    int                 StatTexturesSize;       // Size in bytes of texture updates
+    int                 StatEncodedSize;        // Size in bytes of the message
+    bool                StatCompactVtx;         // Vertices were sent as ImDrawVertCompact
+
+    IMGUI_API ImDrawDataEncoder();
+    IMGUI_API ~ImDrawDataEncoder();
+    IMGUI_API void      Encode(ImDrawData* draw_data, ImVector<unsigned char>* out_buf);  // Append message for this frame to 'out_buf'. Honors draw_data->Textures[] requests (created textures are given an identifier on the wire).
+    IMGUI_API void      Reset();                                                         // Next message will be a full frame. Use when a receiver connects.
+
+    // [Internal]
+    ImVector<ImDrawDataEncoderList*> Lists;
+    ImGuiStorage        ListsMap;               // ImDrawList* hash -> index in Lists[] + 1
+    ImU32               ListsNextID;
+    ImU32               TexturesNextID;
+    bool                WantFullFrame;
+    bool                LastCompactVtx;         // Vertices format of previous frame
+    ImVector<ImDrawDataWireCmd> TempCmdData;
+    ImVector<int>       TempRanges;
+};
+
+// Receiver side
+struct ImDrawDataDecoder
+{
+    ImDrawData          DrawData;               // Output. Only valid after a successful Decode(), until the next one.
+    ImVector<ImTextureData*> Textures;          // Textures created by the sender. Pointed to by DrawData.Textures: your renderer backend will create/update/destroy them when rendering DrawData.
+    int                 FrameCount;
+
+    IMGUI_API ImDrawDataDecoder();
+    IMGUI_API ~ImDrawDataDecoder();             // Textures are not destroyed on the GPU: use your renderer backend first if needed.
+    IMGUI_API bool      Decode(const void* data, size_t data_size); // Return false on a malformed or incompatible message. In this case DrawData is cleared and the decoder waits for a full frame.
+    IMGUI_API void      Clear();
+
+    // [Internal]
+    ImVector<ImDrawDataDecoderList*> Lists;
+    ImGuiStorage        ListsMap;               // ID -> index in Lists[] + 1
+    ImVector<ImU64>     TexturesWireIDs;        // Parallel to Textures[]
+    bool                WantFullFrame;
+};
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,452 @@
+// dear imgui: sorting helper for large tables
+// (code)
+
+// See imgui_table_sort.h for usage.
+
+// Implementation:
+// - Numeric values are converted once into unsigned integers which sort in the same order ("radix keys"): sign bit is flipped
+//   for signed integers, and all bits are flipped for negative floating-point values. Descending order is obtained by flipping all bits.
+// - We sort keys from least significant to most significant, each with a stable sort, which results in a stable multi-key sort.
+//   Numeric keys use a LSD radix sort on 8-bit digits, skipping passes where all rows have the same digit.
+//   String keys use a merge sort.
+// - All threads run the same code on their own range of rows, and synchronize between phases (histogram, offsets, scatter).
+//   Output doesn't depend on the number of threads.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_table_sort.h"
+#include "imgui_internal.h"     // ImSwap, ImClamp, ImMax
+#include <string.h>             // memset, strcmp
+#include <algorithm>            // std::stable_sort, std::merge
+
+#ifndef IMGUI_TABLE_SORT_DISABLE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
+
+static inline const void* ImGuiTableSorter_GetValuePtr(const ImGuiTableSorterColumn* column, int row_n)
+{
+    if (column->Getter)
+        return column->Getter(column->UserData, row_n);
+    return (const char*)column->Data + column->Stride * (size_t)row_n;
+}
+
+static int ImGuiTableSorter_GetKeySize(ImGuiDataType data_type)
+{
+    switch (data_type)
+    {
+    case ImGuiDataType_S8: case ImGuiDataType_U8: case ImGuiDataType_Bool: return 1;
+    case ImGuiDataType_S16: case ImGuiDataType_U16: return 2;
+    case ImGuiDataType_S32: case ImGuiDataType_U32: case ImGuiDataType_Float: return 4;
+    case ImGuiDataType_S64: case ImGuiDataType_U64: case ImGuiDataType_Double: return 8;
+    }
+    return 0;
+}
+
+// Convert a value into an unsigned integer which compares in the same order
+static ImU64 ImGuiTableSorter_GetRadixKey(ImGuiDataType data_type, const void* p)
+{
+    switch (data_type)
+    {
+    case ImGuiDataType_S8:      return (ImU8)(*(const ImS8*)p) ^ 0x80;
+    case ImGuiDataType_U8:      return *(const ImU8*)p;
+    case ImGuiDataType_S16:     return (ImU16)(*(const ImS16*)p) ^ 0x8000;
+    case ImGuiDataType_U16:     return *(const ImU16*)p;
+    case ImGuiDataType_S32:     return (ImU32)(*(const ImS32*)p) ^ 0x80000000;
+    case ImGuiDataType_U32:     return *(const ImU32*)p;
+    case ImGuiDataType_S64:     return (ImU64)(*(const ImS64*)p) ^ ((ImU64)1 << 63);
+    case ImGuiDataType_U64:     return *(const ImU64*)p;
+    case ImGuiDataType_Bool:    return *(const bool*)p ? 1 : 0;
+    case ImGuiDataType_Float:
+    {
+        ImU32 bits;
+        memcpy(&bits, p, sizeof(bits));
+        return (bits & 0x80000000) ? (ImU32)~bits : (bits | 0x80000000);
+    }
+    case ImGuiDataType_Double:
+    {
+        ImU64 bits;
+        memcpy(&bits, p, sizeof(bits));
+        return (bits & ((ImU64)1 << 63)) ? ~bits : (bits | ((ImU64)1 << 63));
+    }
+    }
+    IM_ASSERT(0);
+    return 0;
+}
+
+struct ImGuiTableSorterStringLess
+{
+    bool operator()(const ImGuiTableSorterString& a, const ImGuiTableSorterString& b) const { return strcmp(a.Str, b.Str) < 0; }
+};
+struct ImGuiTableSorterStringGreater
+{
+    bool operator()(const ImGuiTableSorterString& a, const ImGuiTableSorterString& b) const { return strcmp(a.Str, b.Str) > 0; }
+};
+
+static void ImGuiTableSorter_ReverseInts(int* begin, int* end)
+{
+    for (end--; begin < end; begin++, end--)
+        ImSwap(*begin, *end);
+}
+
+//-----------------------------------------------------------------------------
+// Sorting job, shared by all threads
+//-----------------------------------------------------------------------------
+
+struct ImGuiTableSorterJob
+{
+    ImGuiTableSorter*   Sorter;
+    int                 RowsCount;
+    int                 ThreadsCount;
+    bool                SkipPass;           // Written by thread 0 between two barriers
+#ifndef IMGUI_TABLE_SORT_DISABLE_THREADS
+    std::mutex          BarrierMutex;
+    std::condition_variable BarrierCond;
+    int                 BarrierWaiting;
+    int                 BarrierGeneration;
+#endif
+
+    // Wait for all threads to reach this point
+    void Barrier()
+    {
+#ifndef IMGUI_TABLE_SORT_DISABLE_THREADS
+        if (ThreadsCount == 1)
+            return;
+        std::unique_lock<std::mutex> lock(BarrierMutex);
+        const int generation = BarrierGeneration;
+        if (++BarrierWaiting == ThreadsCount)
+        {
+            BarrierWaiting = 0;
+            BarrierGeneration++;
+            BarrierCond.notify_all();
+            return;
+        }
+        BarrierCond.wait(lock, [&] { return BarrierGeneration != generation; });
+#endif
+    }
+
+    int GetRowsBound(int thread_n) const { return (int)((ImS64)RowsCount * thread_n / ThreadsCount); }
+};
+
+// Stable sort on a numeric key
+static void ImGuiTableSorter_SortRadix(ImGuiTableSorterJob* job, int thread_n, int key_n)
+{
+    ImGuiTableSorter* sorter = job->Sorter;
+    const ImGuiTableSorterKey* key = &sorter->Keys[key_n];
+    const int key_size = ImGuiTableSorter_GetKeySize(sorter->Columns[key->ColumnIndex].DataType);
+    const ImU64 key_xor = (key->SortDirection == ImGuiSortDirection_Descending) ? ((key_size == 8) ? ~(ImU64)0 : (((ImU64)1 << (key_size * 8)) - 1)) : 0;
+    const ImU64* values = sorter->KeysValues.Data + (size_t)key_n * job->RowsCount;
+    const int rows_count = job->RowsCount;
+    const int row_begin = job->GetRowsBound(thread_n);
+    const int row_end = job->GetRowsBound(thread_n + 1);
+    int* indices = sorter->Indices.Data;
+
+    // Gather keys in current order, so radix passes read memory sequentially
+    ImGuiTableSorterPair* src = sorter->TempPairs.Data;
+    ImGuiTableSorterPair* dst = sorter->TempPairs.Data + rows_count;
+    for (int n = row_begin; n < row_end; n++)
+    {
+        src[n].Key = values[indices[n]] ^ key_xor;
+        src[n].Index = indices[n];
+    }
+
+    int* histogram = sorter->TempHistograms.Data + thread_n * 256;
+    for (int pass = 0; pass < key_size; pass++)
+    {
+        const int shift = pass * 8;
+        memset(histogram, 0, 256 * sizeof(int));
+        for (int n = row_begin; n < row_end; n++)
+            histogram[(src[n].Key >> shift) & 0xFF]++;
+        job->Barrier();
+
+        // Convert counts into output offsets, ordered by digit then by thread to preserve order of equal digits.
+        if (thread_n == 0)
+        {
+            job->SkipPass = false;
+            int offset = 0;
+            for (int digit = 0; digit < 256; digit++)
+                for (int other_thread_n = 0; other_thread_n < job->ThreadsCount; other_thread_n++)
+                {
+                    int* p_count = &sorter->TempHistograms.Data[other_thread_n * 256 + digit];
+                    const int count = *p_count;
+                    if (count == rows_count)
+                        job->SkipPass = true; // All rows have the same digit
+                    *p_count = offset;
+                    offset += count;
+                }
+        }
+        job->Barrier();
+
+        if (!job->SkipPass)
+        {
+            for (int n = row_begin; n < row_end; n++)
+                dst[histogram[(src[n].Key >> shift) & 0xFF]++] = src[n];
+            ImSwap(src, dst);
+        }
+        job->Barrier();
+    }
+
+    for (int n = row_begin; n < row_end; n++)
+        indices[n] = src[n].Index;
+    job->Barrier();
+}
+
+// Stable sort on a string key
+static void ImGuiTableSorter_SortStrings(ImGuiTableSorterJob* job, int thread_n, int key_n)
+{
+    ImGuiTableSorter* sorter = job->Sorter;
+    const ImGuiTableSorterKey* key = &sorter->Keys[key_n];
+    const ImGuiTableSorterColumn* column = &sorter->Columns[key->ColumnIndex];
+    const bool descending = (key->SortDirection == ImGuiSortDirection_Descending);
+    const int rows_count = job->RowsCount;
+    const int row_begin = job->GetRowsBound(thread_n);
+    const int row_end = job->GetRowsBound(thread_n + 1);
+    int* indices = sorter->Indices.Data;
+
+    ImGuiTableSorterString* src = sorter->TempStrings.Data;
+    ImGuiTableSorterString* dst = sorter->TempStrings.Data + rows_count;
+    for (int n = row_begin; n < row_end; n++)
+    {
+        src[n].Str = (const char*)ImGuiTableSorter_GetValuePtr(column, indices[n]);
+        src[n].Index = indices[n];
+    }
+    if (descending)
+        std::stable_sort(src + row_begin, src + row_end, ImGuiTableSorterStringGreater());
+    else
+        std::stable_sort(src + row_begin, src + row_end, ImGuiTableSorterStringLess());
+    job->Barrier();
+
+    // Merge sorted ranges of each thread, pairwise
+    for (int width = 1; width < job->ThreadsCount; width *= 2)
+    {
+        if ((thread_n % (width * 2)) == 0)
+        {
+            ImGuiTableSorterString* a = src + row_begin;
+            ImGuiTableSorterString* m = src + job->GetRowsBound(ImMin(thread_n + width, job->ThreadsCount));
+            ImGuiTableSorterString* b = src + job->GetRowsBound(ImMin(thread_n + width * 2, job->ThreadsCount));
+            if (descending)
+                std::merge(a, m, m, b, dst + row_begin, ImGuiTableSorterStringGreater());
+            else
+                std::merge(a, m, m, b, dst + row_begin, ImGuiTableSorterStringLess());
+        }
+        ImSwap(src, dst);
+        job->Barrier();
+    }
+
+    for (int n = row_begin; n < row_end; n++)
+        indices[n] = src[n].Index;
+    job->Barrier();
+}
+
+static void ImGuiTableSorter_RunJob(ImGuiTableSorterJob* job, int thread_n)
+{
+    ImGuiTableSorter* sorter = job->Sorter;
+    const int rows_count = job->RowsCount;
+    const int row_begin = job->GetRowsBound(thread_n);
+    const int row_end = job->GetRowsBound(thread_n + 1);
+
+    // Convert numeric values into radix keys
+    for (int key_n = 0; key_n < sorter->Keys.Size; key_n++)
+    {
+        const ImGuiTableSorterColumn* column = &sorter->Columns[sorter->Keys[key_n].ColumnIndex];
+        if (column->DataType == ImGuiDataType_String)
+            continue;
+        ImU64* values = sorter->KeysValues.Data + (size_t)key_n * rows_count;
+        for (int row_n = row_begin; row_n < row_end; row_n++)
+            values[row_n] = ImGuiTableSorter_GetRadixKey(column->DataType, ImGuiTableSorter_GetValuePtr(column, row_n));
+    }
+    for (int row_n = row_begin; row_n < row_end; row_n++)
+        sorter->Indices.Data[row_n] = row_n;
+    job->Barrier();
+
+    // Stable sort on each key, from least significant to most significant
+    for (int key_n = sorter->Keys.Size - 1; key_n >= 0; key_n--)
+    {
+        if (sorter->Columns[sorter->Keys[key_n].ColumnIndex].DataType == ImGuiDataType_String)
+            ImGuiTableSorter_SortStrings(job, thread_n, key_n);
+        else
+            ImGuiTableSorter_SortRadix(job, thread_n, key_n);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiTableSorter
+//-----------------------------------------------------------------------------
+
+ImGuiTableSorter::ImGuiTableSorter()
+{
+    ThreadsCount = 1;
+    Dirty = true;
+}
+
+void ImGuiTableSorter::SetColumn(int column_n, ImGuiDataType data_type, const void* data, size_t stride)
+{
+    IM_ASSERT(column_n >= 0 && data_type >= 0 && data_type < ImGuiDataType_COUNT);
+    if (Columns.Size <= column_n)
+        Columns.resize(column_n + 1, ImGuiTableSorterColumn());
+    ImGuiTableSorterColumn* column = &Columns[column_n];
+    *column = ImGuiTableSorterColumn();
+    column->DataType = data_type;
+    column->Data = data;
+    column->Stride = stride;
+    Dirty = true;
+}
+
+void ImGuiTableSorter::SetColumnGetter(int column_n, ImGuiDataType data_type, const void* (*getter)(void* user_data, int row_n), void* user_data)
+{
+    IM_ASSERT(column_n >= 0 && data_type >= 0 && data_type < ImGuiDataType_COUNT && getter != NULL);
+    if (Columns.Size <= column_n)
+        Columns.resize(column_n + 1, ImGuiTableSorterColumn());
+    ImGuiTableSorterColumn* column = &Columns[column_n];
+    *column = ImGuiTableSorterColumn();
+    column->DataType = data_type;
+    column->Getter = getter;
+    column->UserData = user_data;
+    Dirty = true;
+}
+
+// Compare rows on keys [key_begin, key_end)
+static bool ImGuiTableSorter_RowsEqual(const ImGuiTableSorter* sorter, int rows_count, int key_begin, int key_end, int row_a, int row_b)
+{
+    for (int key_n = key_begin; key_n < key_end; key_n++)
+    {
+        const ImGuiTableSorterColumn* column = &sorter->Columns[sorter->Keys[key_n].ColumnIndex];
+        if (column->DataType == ImGuiDataType_String)
+        {
+            if (strcmp((const char*)ImGuiTableSorter_GetValuePtr(column, row_a), (const char*)ImGuiTableSorter_GetValuePtr(column, row_b)) != 0)
+                return false;
+        }
+        else
+        {
+            const ImU64* values = sorter->KeysValues.Data + (size_t)key_n * rows_count;
+            if (values[row_a] != values[row_b])
+                return false;
+        }
+    }
+    return true;
+}
+
+bool ImGuiTableSorter::Sort(const ImGuiTableSortSpecs* sort_specs, int rows_count)
+{
+    IM_ASSERT(rows_count >= 0);
+
+    // Gather sort keys, ignoring columns without accessor
+    ImVector<ImGuiTableSorterKey> new_keys;
+    for (int spec_n = 0; sort_specs != NULL && spec_n < sort_specs->SpecsCount; spec_n++)
+    {
+        const ImGuiTableColumnSortSpecs* spec = &sort_specs->Specs[spec_n];
+        const bool has_accessor = (spec->ColumnIndex < Columns.Size && Columns[spec->ColumnIndex].DataType != -1);
+        IM_ASSERT(has_accessor && "Missing call to SetColumn() or SetColumnGetter() for this column!");
+        if (!has_accessor)
+            continue;
+        ImGuiTableSorterKey key;
+        key.ColumnIndex = spec->ColumnIndex;
+        key.SortDirection = spec->SortDirection;
+        new_keys.push_back(key);
+    }
+
+    // Incremental update when keys are the same as previous call and only directions flipped,
+    // e.g. from key N onward: rows equal on keys 0..N-1 form groups which we can reverse.
+    if (!Dirty && rows_count == Indices.Size && new_keys.Size == Keys.Size)
+    {
+        int first_flipped_key = -1;
+        bool can_flip = true;
+        for (int key_n = 0; key_n < Keys.Size && can_flip; key_n++)
+        {
+            if (new_keys[key_n].ColumnIndex != Keys[key_n].ColumnIndex)
+                can_flip = false;
+            else if (new_keys[key_n].SortDirection != Keys[key_n].SortDirection && first_flipped_key == -1)
+                first_flipped_key = key_n;
+            else if (new_keys[key_n].SortDirection == Keys[key_n].SortDirection && first_flipped_key != -1)
+                can_flip = false;
+        }
+        if (can_flip && first_flipped_key == -1)
+            return false;
+        if (can_flip)
+        {
+            int* indices = Indices.Data;
+            for (int group_begin = 0; group_begin < rows_count; )
+            {
+                int group_end = group_begin + 1;
+                while (group_end < rows_count && ImGuiTableSorter_RowsEqual(this, rows_count, 0, first_flipped_key, indices[group_end - 1], indices[group_end]))
+                    group_end++;
+                ImGuiTableSorter_ReverseInts(indices + group_begin, indices + group_end);
+
+                // Rows equal on all keys are now in reverse order: reverse them back to preserve stability.
+                for (int run_begin = group_begin; run_begin < group_end; )
+                {
+                    int run_end = run_begin + 1;
+                    while (run_end < group_end && ImGuiTableSorter_RowsEqual(this, rows_count, first_flipped_key, Keys.Size, indices[run_end - 1], indices[run_end]))
+                        run_end++;
+                    ImGuiTableSorter_ReverseInts(indices + run_begin, indices + run_end);
+                    run_begin = run_end;
+                }
+                group_begin = group_end;
+            }
+            Keys.swap(new_keys);
+            return true;
+        }
+    }
+
+    // Full sort
+    Keys.swap(new_keys);
+    Dirty = false;
+    Indices.resize(rows_count);
+    if (rows_count == 0)
+        return true;
+
+    bool has_numeric_keys = false, has_string_keys = false;
+    for (const ImGuiTableSorterKey& key : Keys)
+        if (Columns[key.ColumnIndex].DataType == ImGuiDataType_String)
+            has_string_keys = true;
+        else
+            has_numeric_keys = true;
+
+    ImGuiTableSorterJob job;
+    job.Sorter = this;
+    job.RowsCount = rows_count;
+    job.ThreadsCount = 1;
+    job.SkipPass = false;
+#ifndef IMGUI_TABLE_SORT_DISABLE_THREADS
+    job.BarrierWaiting = job.BarrierGeneration = 0;
+    job.ThreadsCount = (ThreadsCount > 0) ? ThreadsCount : (int)std::thread::hardware_concurrency();
+    job.ThreadsCount = ImClamp(job.ThreadsCount, 1, ImMin(ImMax(rows_count / IMGUI_TABLE_SORT_MIN_ROWS_PER_THREAD, 1), IMGUI_TABLE_SORT_MAX_THREADS));
+#endif
+
+    KeysValues.resize(has_numeric_keys ? Keys.Size * rows_count : 0);
+    TempPairs.resize(has_numeric_keys ? rows_count * 2 : 0);
+    TempStrings.resize(has_string_keys ? rows_count * 2 : 0);
+    TempHistograms.resize(job.ThreadsCount * 256);
+
+#ifndef IMGUI_TABLE_SORT_DISABLE_THREADS
+    std::thread threads[IMGUI_TABLE_SORT_MAX_THREADS];
+    for (int thread_n = 1; thread_n < job.ThreadsCount; thread_n++)
+        threads[thread_n] = std::thread(ImGuiTableSorter_RunJob, &job, thread_n);
+    ImGuiTableSorter_RunJob(&job, 0);
+    for (int thread_n = 1; thread_n < job.ThreadsCount; thread_n++)
+        threads[thread_n].join();
+#else
+    ImGuiTableSorter_RunJob(&job, 0);
+#endif
+    return true;
+}
+
+void ImGuiTableSorter::Clear()
+{
+    Indices.clear();
+    Keys.clear();
+    KeysValues.clear();
+    TempPairs.clear();
+    TempStrings.clear();
+    TempHistograms.clear();
+    Dirty = true;
+}
+
+//-----------------------------------------------------------------------------
+
+#endif // #ifndef IMGUI_DISABLE
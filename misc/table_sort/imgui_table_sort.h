@@ -0,0 +1,94 @@
+// dear imgui: sorting helper for large tables
+// (headers)
+
+// Sort rows of a dataset according to the ImGuiTableSortSpecs of a table, producing a permutation of row indices.
+// - Stable and multi-key: rows which compare equal on all sort keys keep their original order.
+// - Integer, floating-point and bool keys are sorted with a LSD radix sort. String keys are sorted with a merge sort (strcmp order).
+// - Optionally multi-threaded (see ThreadsCount).
+// - Incremental: when only sort directions flipped since the previous call (e.g. clicking on the header of a sorted column),
+//   the permutation is updated in linear time without sorting again.
+// Your data is never moved: display row Indices[n] at position n, e.g. using ImGuiListClipper.
+
+// Usage:
+//   static ImGuiTableSorter sorter;
+//   sorter.SetColumn(0, ImGuiDataType_S32, &items[0].ID, sizeof(items[0]));          // Values in an array of structures
+//   sorter.SetColumn(1, ImGuiDataType_Float, &prices[0], sizeof(float));             // Values in an array
+//   sorter.SetColumn(2, ImGuiDataType_String, &items[0].Name[0], sizeof(items[0]));  // Inline char arrays
+//   sorter.SetColumnGetter(3, ImGuiDataType_String, [](void* user_data, int row_n) -> const void* { return ((MyItem*)user_data)[row_n].Desc.c_str(); }, items);
+//   [...]
+//   if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs())
+//       if (sort_specs->SpecsDirty)
+//       {
+//           sorter.Sort(sort_specs, items_count);
+//           sort_specs->SpecsDirty = false;
+//       }
+//   [...]
+//   for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+//       DisplayItem(items[sorter.Indices[row_n]]);
+// Columns are identified by their index (ImGuiTableColumnSortSpecs::ColumnIndex), not by their user id.
+// When your data changes, call sorter.SetDirty() and set sort_specs->SpecsDirty = true to sort again.
+
+#pragma once
+#include "imgui.h"      // IMGUI_API, ImGuiTableSortSpecs
+#ifndef IMGUI_DISABLE
+
+// Below this number of rows per thread, we use less threads.
+#ifndef IMGUI_TABLE_SORT_MIN_ROWS_PER_THREAD
+#define IMGUI_TABLE_SORT_MIN_ROWS_PER_THREAD    16384
+#endif
+#define IMGUI_TABLE_SORT_MAX_THREADS            64
+
+// Accessor for the values of a column
+struct ImGuiTableSorterColumn
+{
+    ImGuiDataType       DataType;       // ImGuiDataType_S8 to ImGuiDataType_String, -1 if not set. For ImGuiDataType_String the value is the zero-terminated string itself.
+    const void*         Data;           // Pointer to value of row 0, when Getter is NULL
+    size_t              Stride;         // Distance in bytes between values of two consecutive rows, when Getter is NULL
+    const void*         (*Getter)(void* user_data, int row_n); // Return pointer to value of a given row
+    void*               UserData;
+
+    ImGuiTableSorterColumn()    { memset(this, 0, sizeof(*this)); DataType = -1; }
+};
+
+// [Internal] Sort key, as used for the previous Sort() call
+struct ImGuiTableSorterKey
+{
+    int                 ColumnIndex;
+    ImGuiSortDirection  SortDirection;
+};
+
+// [Internal] Temporary data for radix and merge sorts
+struct ImGuiTableSorterPair
+{
+    ImU64               Key;
+    int                 Index;
+};
+struct ImGuiTableSorterString
+{
+    const char*         Str;
+    int                 Index;
+};
+
+struct ImGuiTableSorter
+{
+    ImVector<int>                       Indices;        // Output: Indices[n] is the index of the row to display at position n. Valid after Sort().
+    int                                 ThreadsCount;   // Maximum number of threads used to sort, including the calling thread. Default to 1. 0 = use std::thread::hardware_concurrency().
+    ImVector<ImGuiTableSorterColumn>    Columns;        // Accessors, indexed by column index. Use SetColumn()/SetColumnGetter().
+
+    // [Internal]
+    bool                                Dirty;
+    ImVector<ImGuiTableSorterKey>       Keys;           // Sort keys of the previous Sort() call, most significant first
+    ImVector<ImU64>                     KeysValues;     // [Keys.Size][rows count] numeric values converted to unsigned radix keys (ascending order)
+    ImVector<ImGuiTableSorterPair>      TempPairs;
+    ImVector<ImGuiTableSorterString>    TempStrings;
+    ImVector<int>                       TempHistograms;
+
+    IMGUI_API ImGuiTableSorter();
+    IMGUI_API void  SetColumn(int column_n, ImGuiDataType data_type, const void* data, size_t stride);
+    IMGUI_API void  SetColumnGetter(int column_n, ImGuiDataType data_type, const void* (*getter)(void* user_data, int row_n), void* user_data);
+    void            SetDirty()  { Dirty = true; }   // Call when data changed, so next Sort() call does a full sort.
+    IMGUI_API bool  Sort(const ImGuiTableSortSpecs* sort_specs, int rows_count); // Return true if Indices changed.
+    IMGUI_API void  Clear();    // Free all memory
+};
+
+#endif // #ifndef IMGUI_DISABLE